@@ -36,6 +36,15 @@ static void *lba_to_address(const struct device *dev, uint32_t lba)
 	return &config->buf[lba * config->sector_size];
 }
 
+static void disk_ram_latency(uint32_t count)
+{
+	uint32_t us = CONFIG_DISK_RAM_CMD_LATENCY_US + count * CONFIG_DISK_RAM_SECTOR_LATENCY_US;
+
+	if (us > 0) {
+		k_busy_wait(us);
+	}
+}
+
 static int disk_ram_access_status(struct disk_info *disk)
 {
 	return DISK_STATUS_OK;
@@ -54,6 +63,7 @@ static int disk_ram_access_read(struct disk_info *disk, uint8_t *buff,
 		return -EIO;
 	}
 
+	disk_ram_latency(count);
 	memcpy(buff, lba_to_address(dev, sector), count * config->sector_size);
 
 	return 0;
@@ -72,6 +82,7 @@ static int disk_ram_access_write(struct disk_info *disk, const uint8_t *buff,
 		return -EIO;
 	}
 
+	disk_ram_latency(count);
 	memcpy(lba_to_address(dev, sector), buff, count * config->sector_size);
 
 	return 0;
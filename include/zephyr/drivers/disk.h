@@ -97,6 +97,10 @@ struct disk_info {
 	const struct device *dev;
 	/** Internally used disk reference count */
 	uint16_t refcnt;
+#if defined(CONFIG_DISK_CACHE) || defined(__DOXYGEN__)
+	/** Internally used sector count of a cached disk, 0 if not cached */
+	uint32_t cache_sectors;
+#endif
 };
 
 /**
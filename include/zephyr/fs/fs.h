@@ -10,7 +10,9 @@
 
 #include <sys/types.h>
 
+#include <zephyr/sys/atomic.h>
 #include <zephyr/sys/dlist.h>
+#include <zephyr/sys/slist.h>
 #include <zephyr/fs/fs_interface.h>
 
 #ifdef __cplusplus
@@ -106,6 +108,10 @@ struct fs_mount_t {
 	const struct fs_file_system_t *fs;
 	/** Mount flags */
 	uint8_t flags;
+	/** Entry for the mount point index */
+	sys_snode_t index_node;
+	/** Number of path operations in progress on the mount point */
+	atomic_t refs;
 };
 
 /**
@@ -566,6 +572,11 @@ int fs_mount(struct fs_mount_t *mp);
  * calling the file system specific unmount function and removing
  * the mount point from mounted file system list.
  *
+ * The mount point is not found by path operations anymore once the
+ * unmount starts, and the path operations in progress on it complete
+ * before the file system specific unmount function is called. Files
+ * and directories opened on the file system should be closed first.
+ *
  * @param mp Pointer to the fs_mount_t structure
  *
  * @retval 0 on success;
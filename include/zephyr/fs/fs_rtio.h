@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+#define ZEPHYR_INCLUDE_FS_FS_RTIO_H_
+
+#include <zephyr/fs/fs.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/mpsc_lockfree.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Asynchronous file I/O with RTIO
+ * @defgroup file_system_rtio File System RTIO
+ * @ingroup file_system_api
+ * @{
+ */
+
+/**
+ * @brief Sync the file, for a @c RTIO_OP_NOP submission
+ *
+ * Set in the @c iodev_flags of a submission by @ref fs_rtio_sqe_prep_sync.
+ */
+#define FS_RTIO_SYNC BIT(0)
+
+/**
+ * @brief File I/O device
+ *
+ * Submissions to @c iodev of an initialized file I/O device operate on the
+ * file it was initialized with, from the current position of the file:
+ *
+ * - @c RTIO_OP_RX reads from the file, with a buffer given by the submission
+ *   or taken from the RTIO context memory pool.
+ * - @c RTIO_OP_TX and @c RTIO_OP_TINY_TX write to the file.
+ * - @c RTIO_OP_NOP does nothing or, with @ref FS_RTIO_SYNC, syncs the file.
+ * - @c RTIO_OP_CALLBACK calls the callback, e.g. to seek the file.
+ *
+ * The completion result is the number of bytes read or written, 0 for the
+ * other operations, or a negative errno code.
+ *
+ * The operations run on the RTIO work queue threads, in submission order for
+ * each file. The file must stay open until all its submissions complete.
+ *
+ * A submission to a file with no operation in progress completes with
+ * -ENOMEM, from rtio_submit(), when none of the
+ * @kconfig{CONFIG_RTIO_WORKQ_POOL_ITEMS} work items is free. The following
+ * submissions to a file run on the work queue thread of the previous one
+ * when no work item is free.
+ */
+struct fs_rtio_file {
+	/** I/O device of the file, to use in the submissions */
+	struct rtio_iodev iodev;
+
+	/** @cond INTERNAL_HIDDEN */
+	struct fs_file_t *zfp;
+	struct mpsc io_q;
+	struct k_spinlock lock;
+	bool busy;
+	/** @endcond */
+};
+
+/**
+ * @brief Initialize a file I/O device
+ *
+ * @param file File I/O device
+ * @param zfp Open file the submissions operate on
+ */
+void fs_rtio_file_init(struct fs_rtio_file *file, struct fs_file_t *zfp);
+
+/**
+ * @brief Prepare a file sync submission
+ *
+ * @param sqe Submission to prepare
+ * @param file File I/O device
+ * @param prio Priority of the operation
+ * @param userdata User data returned in the completion
+ */
+static inline void fs_rtio_sqe_prep_sync(struct rtio_sqe *sqe, struct fs_rtio_file *file,
+					 int8_t prio, void *userdata)
+{
+	rtio_sqe_prep_nop(sqe, &file->iodev, userdata);
+	sqe->prio = prio;
+	sqe->iodev_flags = FS_RTIO_SYNC;
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_FS_FS_RTIO_H_ */
@@ -10,6 +10,7 @@
 #include <zephyr/types.h>
 #include <zephyr/kernel.h>
 #include <zephyr/storage/flash_map.h>
+#include <zephyr/fs/fs.h>
 
 #include <lfs.h>
 
@@ -33,6 +34,63 @@ extern "C" {
  */
 #define FS_LITTLEFS_DISK_VERSION_MINOR_GET(disk_version) FIELD_GET(GENMASK(15, 0), disk_version)
 
+/** @brief Special lookahead size of @ref fs_littlefs_profile tracking all the blocks */
+#define FS_LITTLEFS_LOOKAHEAD_ALL UINT32_MAX
+
+/**
+ * @brief Runtime cache profile of a littlefs mount, see fs_littlefs_profile_set().
+ *
+ * A zero value keeps the size of the configuration.
+ */
+struct fs_littlefs_profile {
+	/** Size of the read and program caches, and of the cache of each open file, in bytes */
+	lfs_size_t cache_size;
+	/** Size of the lookahead bitmap in bytes, or @ref FS_LITTLEFS_LOOKAHEAD_ALL */
+	lfs_size_t lookahead_size;
+	/** Number of erase cycles before moving data to another block */
+	int32_t block_cycles;
+	/** Fill the lookahead bitmap in the background once mounted */
+	bool background_scan;
+};
+
+/** @brief Operations of the littlefs block access statistics */
+enum fs_littlefs_op {
+	/** Mount and format */
+	FS_LITTLEFS_OP_MOUNT,
+	/** File open and close */
+	FS_LITTLEFS_OP_OPEN,
+	/** File read */
+	FS_LITTLEFS_OP_READ,
+	/** File write and truncate */
+	FS_LITTLEFS_OP_WRITE,
+	/** File seek and tell */
+	FS_LITTLEFS_OP_SEEK,
+	/** File sync */
+	FS_LITTLEFS_OP_SYNC,
+	/** Directory operations, unlink and rename */
+	FS_LITTLEFS_OP_DIR,
+	/** Stat and statvfs */
+	FS_LITTLEFS_OP_STAT,
+	/** Background lookahead scan */
+	FS_LITTLEFS_OP_SCAN,
+	/** Number of operations */
+	FS_LITTLEFS_OP_COUNT,
+};
+
+/** @brief Block accesses of an operation, see fs_littlefs_stats_get(). */
+struct fs_littlefs_op_stats {
+	/** Number of operations */
+	uint32_t count;
+	/** Number of block reads */
+	uint32_t reads;
+	/** Number of bytes read */
+	uint32_t read_bytes;
+	/** Number of block programs */
+	uint32_t progs;
+	/** Number of block erases */
+	uint32_t erases;
+};
+
 /** @brief Filesystem info structure for LittleFS mount */
 struct fs_littlefs {
 	/* Defaulted in driver, customizable before mount. */
@@ -53,6 +111,23 @@ struct fs_littlefs {
 	struct lfs lfs;
 	void *backend;
 	struct k_mutex mutex;
+
+#ifdef CONFIG_FS_LITTLEFS_PROFILE
+	/* Set with fs_littlefs_profile_set(), applied at mount. */
+	struct fs_littlefs_profile profile;
+	/* Configuration the profile was applied to, restored at unmount. */
+	struct lfs_config base_cfg;
+	/* Caches of the profile, allocated from the file cache pool. */
+	void *pool_buffer;
+	struct k_work scan_work;
+	bool profile_applied;
+#endif
+
+#ifdef CONFIG_FS_LITTLEFS_STATS
+	/* Cleared at mount, see fs_littlefs_stats_get(). */
+	struct fs_littlefs_op_stats stats[FS_LITTLEFS_OP_COUNT];
+	enum fs_littlefs_op op;
+#endif
 };
 
 /** @brief Define a littlefs configuration with customized size
@@ -117,6 +192,56 @@ struct fs_littlefs {
 					  CONFIG_FS_LITTLEFS_CACHE_SIZE, \
 					  CONFIG_FS_LITTLEFS_LOOKAHEAD_SIZE)
 
+/**
+ * @brief Set the cache profile of a littlefs file system.
+ *
+ * The profile applies from the next mount of the file system, until it is unmounted. The
+ * read, program and lookahead buffers of a profile changing their size are allocated from the
+ * file cache pool, see @kconfig{CONFIG_FS_LITTLEFS_FC_HEAP_SIZE}, instead of using the buffers of
+ * the configuration. The cache of each file opened on the mount has the cache size of the
+ * profile, and is allocated from the same pool.
+ *
+ * littlefs fills the lookahead bitmap by traversing the whole file system on the first block
+ * allocation after mount, and again each time the blocks tracked by the bitmap are used up.
+ * A bitmap of @ref FS_LITTLEFS_LOOKAHEAD_ALL tracks all the blocks of the partition, so that a
+ * single traversal is needed, and @ref fs_littlefs_profile.background_scan moves it off the
+ * first write after mount to the system work queue.
+ *
+ * The cache size must be a multiple of the read and program sizes, and divide the block size.
+ * When the block size is only known once mounted, the mount fails with -EINVAL otherwise.
+ *
+ * Requires @kconfig{CONFIG_FS_LITTLEFS_PROFILE}.
+ *
+ * @param mp Pointer to the mount point of the file system.
+ * @param profile Pointer to the profile, or NULL to use the configuration again.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the mount point is not a littlefs one or the profile is invalid.
+ * @retval -EBUSY if the file system is mounted.
+ * @retval -ENOTSUP if the background scan is not supported by littlefs.
+ */
+int fs_littlefs_profile_set(struct fs_mount_t *mp, const struct fs_littlefs_profile *profile);
+
+/**
+ * @brief Get the block access statistics of a mounted littlefs file system.
+ *
+ * The statistics count the block reads, programs and erases made by each operation since the
+ * file system was mounted, for example the reads of @ref FS_LITTLEFS_OP_MOUNT are the cost of
+ * the mount.
+ *
+ * Requires @kconfig{CONFIG_FS_LITTLEFS_STATS}.
+ *
+ * @param mp Pointer to the mount point of the file system.
+ * @param stats Array the statistics of each operation are copied to.
+ * @param reset Clear the statistics after copying them.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the mount point is not a littlefs one.
+ * @retval -ENODEV if the file system is not mounted.
+ */
+int fs_littlefs_stats_get(struct fs_mount_t *mp,
+			  struct fs_littlefs_op_stats stats[FS_LITTLEFS_OP_COUNT], bool reset);
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,6 +33,22 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief Garbage collection and write latency statistics, see nvs_gc_stats_get().
+ */
+struct nvs_gc_stats {
+	/** Longest time spent in nvs_write() or nvs_write_batch(), in cycles */
+	uint32_t write_max_cycles;
+	/** Number of calls to nvs_write() and nvs_write_batch() */
+	uint32_t write_count;
+	/** Number of garbage collections run inside a write */
+	uint32_t inline_gc_count;
+	/** Number of entries moved by background garbage collection */
+	uint32_t bg_move_count;
+	/** Number of sectors erased by background garbage collection */
+	uint32_t bg_erase_count;
+};
+
 /**
  * @brief Non-volatile Storage File system structure
  */
@@ -62,6 +78,36 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_NVS_GC_BACKGROUND
+#if CONFIG_NVS_GC_BACKGROUND_WORKQUEUE
+	/** Work item running background garbage collection */
+	struct k_work gc_work;
+#endif
+	/** Sector being drained by background garbage collection */
+	uint32_t gc_bg_sector;
+	/** Next allocation table entry to examine in the drained sector */
+	uint32_t gc_bg_addr;
+	/** Last allocation table entry of the drained sector */
+	uint32_t gc_bg_stop;
+	/** Sector erased ahead of garbage collection */
+	uint32_t gc_bg_erased;
+#endif
+#if CONFIG_NVS_GC_STATS
+	/** Garbage collection statistics */
+	struct nvs_gc_stats gc_stats;
+#endif
+};
+
+/**
+ * @brief Entry of a batch write, see nvs_write_batch().
+ */
+struct nvs_batch_entry {
+	/** Id of the entry */
+	uint16_t id;
+	/** Number of bytes to be written, 0 deletes the entry */
+	uint16_t len;
+	/** Pointer to the data to be written */
+	const void *data;
 };
 
 /**
@@ -101,6 +147,9 @@ int nvs_clear(struct nvs_fs *fs);
  * @p 0 will return error.@n It is not possible to distinguish between deleted entry and entry
  * with data of length 0.
  *
+ * @note With CONFIG_NVS_CHECKPOINT or CONFIG_NVS_WRITE_BATCH, id 0xFFFF is reserved and
+ * -EINVAL is returned for it.
+ *
  * @param fs Pointer to file system
  * @param id Id of the entry to be written
  * @param data Pointer to the data to be written
@@ -115,6 +164,8 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len);
 /**
  * @brief Delete an entry from the file system
  *
+ * @note Id 0xFFFF is reserved as for nvs_write().
+ *
  * @param fs Pointer to file system
  * @param id Id of the entry to be deleted
  * @retval 0 Success
@@ -122,6 +173,31 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len);
  */
 int nvs_delete(struct nvs_fs *fs, uint16_t id);
 
+/**
+ * @brief Write several entries to the file system as one atomic update.
+ *
+ * The data of all entries is written first, followed by a single batch
+ * allocation table entry (ATE) that commits them, and then by the ATEs of the
+ * entries. When power is lost before the batch ATE is written none of the
+ * entries is updated, when it is lost afterwards nvs_mount() completes the
+ * batch. As with nvs_write(), entries identical to the stored ones are skipped.
+ * An id present several times in the batch is written with its last entry.
+ * All entries of a batch are written in the same sector.
+ *
+ * @note Requires CONFIG_NVS_WRITE_BATCH. Id 0xFFFF is reserved.
+ *
+ * @param fs Pointer to file system
+ * @param entries Array of entries to be written
+ * @param count Number of entries, at most CONFIG_NVS_WRITE_BATCH_MAX_ENTRIES
+ *
+ * @return Number of entries written. On success, it will be equal to the number of entries
+ * that differ from the stored ones. On error, returns negative value of errno.h defined error
+ * codes: -EINVAL if the batch does not fit in a sector, -ENOSPC if there is not enough free
+ * space.
+ */
+ssize_t nvs_write_batch(struct nvs_fs *fs, const struct nvs_batch_entry *entries,
+			size_t count);
+
 /**
  * @brief Read an entry from the file system.
  *
@@ -188,6 +264,32 @@ size_t nvs_sector_max_data_size(struct nvs_fs *fs);
  */
 int nvs_sector_use_next(struct nvs_fs *fs);
 
+/**
+ * @brief Do an increment of background garbage collection.
+ *
+ * Moves the valid entries of the sector that is garbage collected next to the
+ * current sector, at most @kconfig{CONFIG_NVS_GC_BACKGROUND_STEPS} entries per
+ * call, and erases the sector once it is drained. A later write that fills the
+ * current sector then only needs to close it. This is done from the system
+ * work queue when @kconfig{CONFIG_NVS_GC_BACKGROUND_WORKQUEUE} is enabled, the
+ * routine can also be called from an idle loop.
+ *
+ * @param fs Pointer to the file system.
+ *
+ * @return 1 if there is more work to do, 0 if there is nothing to do. On error, returns negative
+ * value of errno.h defined error codes.
+ */
+int nvs_gc_step(struct nvs_fs *fs);
+
+/**
+ * @brief Get the garbage collection and write latency statistics.
+ *
+ * @param fs Pointer to the file system.
+ * @param stats Pointer to the structure the statistics are copied to.
+ * @param reset Clear the statistics after copying them.
+ */
+void nvs_gc_stats_get(struct nvs_fs *fs, struct nvs_gc_stats *stats, bool reset);
+
 /**
  * @}
  */
@@ -31,6 +31,22 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief Garbage collection and write latency statistics, see zms_gc_stats_get().
+ */
+struct zms_gc_stats {
+	/** Longest time spent in zms_write() or zms_write_batch(), in cycles */
+	uint32_t write_max_cycles;
+	/** Number of calls to zms_write() and zms_write_batch() */
+	uint32_t write_count;
+	/** Number of garbage collections run inside a write */
+	uint32_t inline_gc_count;
+	/** Number of entries moved by background garbage collection */
+	uint32_t bg_move_count;
+	/** Number of sectors erased by background garbage collection */
+	uint32_t bg_erase_count;
+};
+
 /** Zephyr Memory Storage file system structure */
 struct zms_fs {
 	/** File system offset in flash */
@@ -65,6 +81,36 @@ struct zms_fs {
 	/** Lookup table used to cache ATE addresses of written IDs */
 	uint64_t lookup_cache[CONFIG_ZMS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_ZMS_GC_BACKGROUND
+#if CONFIG_ZMS_GC_BACKGROUND_WORKQUEUE
+	/** Work item running background garbage collection */
+	struct k_work gc_work;
+#endif
+	/** Sector being drained by background garbage collection */
+	uint64_t gc_bg_sector;
+	/** Next ATE to examine in the drained sector */
+	uint64_t gc_bg_addr;
+	/** Last ATE of the drained sector */
+	uint64_t gc_bg_stop;
+	/** Sector erased ahead of garbage collection */
+	uint64_t gc_bg_erased;
+	/** Cycle counter of the drained sector */
+	uint8_t gc_bg_cycle;
+#endif
+#if CONFIG_ZMS_GC_STATS
+	/** Garbage collection statistics */
+	struct zms_gc_stats gc_stats;
+#endif
+};
+
+/** Entry of a batch write, see zms_write_batch() */
+struct zms_batch_entry {
+	/** ID of the entry */
+	uint32_t id;
+	/** Number of bytes to be written, 0 deletes the entry */
+	size_t len;
+	/** Pointer to the data to be written */
+	const void *data;
 };
 
 /**
@@ -128,6 +174,32 @@ int zms_clear(struct zms_fs *fs);
  */
 ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len);
 
+/**
+ * @brief Write several entries to the file system as one atomic update.
+ *
+ * The data of all entries is written first, followed by a single batch Allocation Table Entry
+ * (ATE) that commits them, and then by the ATEs of the entries.
+ * When power is lost before the batch ATE is written none of the entries is updated, when it
+ * is lost afterwards zms_mount() completes the batch.
+ * An ID present several times in the batch is written with its last entry.
+ * All entries of a batch are written in the same sector.
+ *
+ * @note Requires `CONFIG_ZMS_WRITE_BATCH`.
+ *
+ * @param fs Pointer to the file system.
+ * @param entries Array of entries to be written.
+ * @param count Number of entries, at most `CONFIG_ZMS_WRITE_BATCH_MAX_ENTRIES`.
+ *
+ * @return Number of entries written. With `CONFIG_ZMS_NO_DOUBLE_WRITE` enabled, entries
+ * identical to the stored ones are not written and not counted.
+ * @retval -EACCES if ZMS is still not initialized.
+ * @retval -ENXIO if there is a device error.
+ * @retval -EIO if there is a memory read/write error.
+ * @retval -EINVAL if an entry is invalid or the batch does not fit in a sector.
+ * @retval -ENOSPC if no space is left on the device.
+ */
+ssize_t zms_write_batch(struct zms_fs *fs, const struct zms_batch_entry *entries, size_t count);
+
 /**
  * @brief Delete an entry from the file system
  *
@@ -236,6 +308,33 @@ size_t zms_active_sector_free_space(struct zms_fs *fs);
  */
 int zms_sector_use_next(struct zms_fs *fs);
 
+/**
+ * @brief Do an increment of background garbage collection.
+ *
+ * Moves the valid entries of the sector that is garbage collected next to the current
+ * sector, at most @kconfig{CONFIG_ZMS_GC_BACKGROUND_STEPS} ATEs per call, and erases the
+ * sector once it is drained. This is done from the system work queue when
+ * @kconfig{CONFIG_ZMS_GC_BACKGROUND_WORKQUEUE} is enabled, the function can also be called
+ * from an idle loop.
+ *
+ * @param fs Pointer to the file system.
+ *
+ * @retval 1 There is more work to do.
+ * @retval 0 There is nothing to do.
+ * @retval -EACCES If @p fs is not mounted.
+ * @retval -EIO If there is an internal error.
+ */
+int zms_gc_step(struct zms_fs *fs);
+
+/**
+ * @brief Get the garbage collection and write latency statistics.
+ *
+ * @param fs Pointer to the file system.
+ * @param stats Pointer to the structure the statistics are copied to.
+ * @param reset Clear the statistics after copying them.
+ */
+void zms_gc_stats_get(struct zms_fs *fs, struct zms_gc_stats *stats, bool reset);
+
 /**
  * @}
  */
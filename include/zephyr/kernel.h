@@ -2145,6 +2145,33 @@ int k_queue_merge_slist(struct k_queue *queue, sys_slist_t *list);
  */
 __syscall void *k_queue_get(struct k_queue *queue, k_timeout_t timeout);
 
+/**
+ * @brief Get several elements from a queue.
+ *
+ * This routine removes up to @a max_items data items from the head of
+ * @a queue under a single lock acquisition and stores their addresses in
+ * @a items, in queue order. The first word of each data item is reserved
+ * for the kernel's use.
+ *
+ * If the queue is empty the routine waits for the first data item to be
+ * added, so a successful wait returns exactly one item.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue Address of the queue.
+ * @param items Array receiving the addresses of the data items.
+ * @param max_items Number of entries in @a items.
+ * @param timeout Waiting period to obtain a data item when the queue is
+ *                empty, or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items removed; 0 if returned without waiting,
+ * waiting period timed out or the wait was cancelled.
+ */
+__syscall uint32_t k_queue_get_many(struct k_queue *queue, void **items, uint32_t max_items,
+				    k_timeout_t timeout);
+
 /**
  * @brief Remove an element from a queue.
  *
@@ -2662,6 +2689,37 @@ struct k_fifo {
 	fg_ret; \
 	})
 
+/**
+ * @brief Get several elements from a FIFO queue.
+ *
+ * This routine removes up to @a max_items data items from @a fifo in a
+ * "first in, first out" manner under a single lock acquisition. The first
+ * word of each data item is reserved for the kernel's use.
+ *
+ * If the FIFO is empty the routine waits for the first data item to be
+ * added, so a successful wait returns exactly one item.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param fifo Address of the FIFO queue.
+ * @param items Array receiving the addresses of the data items.
+ * @param max_items Number of entries in @a items.
+ * @param timeout Waiting period to obtain a data item when the FIFO is empty,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of data items removed; 0 if returned without waiting,
+ * waiting period timed out or the wait was cancelled.
+ */
+#define k_fifo_get_many(fifo, items, max_items, timeout) \
+	({ \
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_fifo, get_many, fifo, timeout); \
+	uint32_t fgm_ret = k_queue_get_many(&(fifo)->_queue, items, max_items, timeout); \
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_fifo, get_many, fifo, timeout, fgm_ret); \
+	fgm_ret; \
+	})
+
 /**
  * @brief Query a FIFO queue to see if it has data available.
  *
@@ -3005,6 +3063,7 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 
 struct k_work;
 struct k_work_q;
+struct k_work_q_worker;
 struct k_work_queue_config;
 extern struct k_work_q k_sys_work_q;
 
@@ -3580,6 +3639,40 @@ void k_work_queue_start(struct k_work_q *queue,
 			k_thread_stack_t *stack, size_t stack_size,
 			int prio, const struct k_work_queue_config *cfg);
 
+/** @brief Add a thread to a work queue.
+ *
+ * This turns the work queue into a pool of threads that process its work
+ * items in parallel.  Every thread of the pool has its own list of work
+ * items, a thread that runs out of work takes work items from the lists of
+ * the other threads.  Work items submitted from a thread of the pool go to
+ * the list of that thread, others are distributed in turn.
+ *
+ * Submission, flush, cancellation and drain behave as for a queue with a
+ * single thread, and a work item never runs concurrently with itself.
+ * Distinct work items, however, are no longer processed in the order they
+ * were submitted.
+ *
+ * The thread uses the priority and options of the queue thread.  Workers
+ * should be added right after k_work_queue_start(), before any work item is
+ * submitted to the queue.
+ *
+ * @note @kconfig{CONFIG_WORKQUEUE_POOL} must be selected for this function
+ * to be available.
+ *
+ * @param queue pointer to the started queue structure.
+ *
+ * @param worker pointer to the worker structure.
+ *
+ * @param stack pointer to the worker thread stack area.
+ *
+ * @param stack_size size of the worker thread stack area, in bytes.
+ *
+ * @param cpu CPU the worker thread is pinned to when
+ * @kconfig{CONFIG_SCHED_CPU_MASK} is selected, or -1 to leave it unpinned.
+ */
+void k_work_queue_add_worker(struct k_work_q *queue, struct k_work_q_worker *worker,
+			     k_thread_stack_t *stack, size_t stack_size, int cpu);
+
 /** @brief Access the thread that animates a work queue.
  *
  * This is necessary to grant a work queue thread access to things the work
@@ -4083,6 +4176,14 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Work item being flushed when the queue has workers.  The flusher
+	 * is then put on a list of pending flushes rather than on the queue,
+	 * and its K_WORK_RUNNING and K_WORK_QUEUED flags record the
+	 * instances of the work item it still waits for.
+	 */
+	struct k_work *target;
+#endif
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -4154,6 +4255,23 @@ struct k_work_queue_config {
 	bool essential;
 };
 
+/** @brief A structure holding an additional thread of a work queue.
+ *
+ * See k_work_queue_add_worker().
+ */
+struct k_work_q_worker {
+	/* The thread that animates the work. */
+	struct k_thread thread;
+
+	/* List of k_work items handed to this thread, accessed only while
+	 * the work module spinlock is held.
+	 */
+	sys_slist_t pending;
+
+	/* Node in the list of workers of the queue. */
+	sys_snode_t node;
+};
+
 /** @brief A structure used to hold work until it can be processed. */
 struct k_work_q {
 	/* The thread that animates the work. */
@@ -4174,6 +4292,22 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* List of k_work_q_worker added to the queue. */
+	sys_slist_t workers;
+
+	/* Worker receiving the next work item submitted from outside the
+	 * queue, NULL for the queue thread.
+	 */
+	struct k_work_q_worker *next;
+
+	/* Number of work items being processed. */
+	uint16_t running;
+
+	/* Number of threads that have not exited after a stop request. */
+	uint16_t threads;
+#endif
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4738,6 +4872,67 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send several messages to a message queue.
+ *
+ * This routine sends up to @a num_msgs consecutive messages from @a data to
+ * message queue @a msgq under a single lock acquisition. Threads waiting to
+ * receive are served first, the remaining messages are copied to the ring
+ * buffer while there is room. Waiting threads are woken and the scheduler
+ * is invoked at most once per call.
+ *
+ * If the queue is full the routine waits for room for the first message, so
+ * a successful wait sends exactly one message.
+ *
+ * @note The message content is copied from @a data into @a msgq and the
+ * @a data pointer is not retained.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to @a num_msgs messages.
+ * @param num_msgs Number of messages to send.
+ * @param timeout Waiting period to add a message when the queue is full, or
+ *                one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of messages sent, 0 only if @a num_msgs is 0.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_put_many(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+			      k_timeout_t timeout);
+
+/**
+ * @brief Receive several messages from a message queue.
+ *
+ * This routine receives up to @a num_msgs messages from message queue
+ * @a msgq into consecutive slots of @a data, in a "first in, first out"
+ * manner, under a single lock acquisition. The freed room is refilled from
+ * threads waiting to send, which are woken with a single reschedule.
+ *
+ * If the queue is empty the routine waits for the first message, so a
+ * successful wait receives exactly one message.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold @a num_msgs messages.
+ * @param num_msgs Maximum number of messages to receive.
+ * @param timeout Waiting period to receive a message when the queue is
+ *                empty, or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages received, 0 only if @a num_msgs is 0.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_get_many(struct k_msgq *msgq, void *data, uint32_t num_msgs,
+			      k_timeout_t timeout);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -4830,6 +5025,235 @@ static inline uint32_t z_impl_k_msgq_num_used_get(struct k_msgq *msgq)
 
 /** @} */
 
+/**
+ * @defgroup chan_apis Channel APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Channel Structure
+ */
+struct k_chan {
+	/** Threads waiting for a message */
+	_wait_q_t get_wait_q;
+	/** Threads waiting for a free slot */
+	_wait_q_t put_wait_q;
+	/** Lock, only taken when a thread has to wait or be woken up */
+	struct k_spinlock lock;
+	/** Slots holding the messages */
+	uint8_t *buffer;
+	/** Message size */
+	size_t msg_size;
+	/** Number of slots, a power of two */
+	uint32_t max_msgs;
+	/** Position of the next slot claimed for writing */
+	atomic_t head;
+	/** Position of the next slot claimed for reading */
+	atomic_t tail;
+	/** Sides of the channel threads are waiting on */
+	atomic_t waiting;
+
+	Z_DECL_POLL_EVENT
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/* Each slot starts with its sequence number, padded so that messages are
+ * aligned to 8 bytes.
+ */
+#define Z_CHAN_HDR_SIZE 8U
+
+#define Z_CHAN_SLOT_SIZE(msg_size) (Z_CHAN_HDR_SIZE + ROUND_UP(msg_size, 8U))
+
+#define Z_CHAN_INITIALIZER(obj, c_buffer, c_msg_size, c_max_msgs) \
+	{ \
+	.get_wait_q = Z_WAIT_Q_INIT(&obj.get_wait_q), \
+	.put_wait_q = Z_WAIT_Q_INIT(&obj.put_wait_q), \
+	.buffer = c_buffer, \
+	.msg_size = c_msg_size, \
+	.max_msgs = c_max_msgs, \
+	Z_POLL_EVENT_OBJ_INIT(obj) \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Size of the buffer of a channel.
+ *
+ * @param msg_size Message size (in bytes).
+ * @param max_msgs Maximum number of messages the channel holds.
+ */
+#define K_CHAN_BUF_SIZE(msg_size, max_msgs) ((max_msgs) * Z_CHAN_SLOT_SIZE(msg_size))
+
+/**
+ * @brief Statically define and initialize a channel.
+ *
+ * The channel can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_chan <name>; @endcode
+ *
+ * The buffer of the channel is only accessible from supervisor mode, see
+ * k_chan_init() for channels used by user mode threads.
+ *
+ * @param name Name of the channel.
+ * @param msg_size Message size (in bytes).
+ * @param max_msgs Maximum number of messages the channel holds, a power of
+ *        two of at least 2.
+ */
+#define K_CHAN_DEFINE(name, msg_size, max_msgs)				\
+	BUILD_ASSERT(((max_msgs) >= 2) && IS_POWER_OF_TWO(max_msgs),	\
+		     "channel size must be a power of two of at least 2"); \
+	static uint8_t __aligned(8)					\
+		_k_chan_buf_##name[K_CHAN_BUF_SIZE(msg_size, max_msgs)];	\
+	STRUCT_SECTION_ITERABLE(k_chan, name) =				\
+		Z_CHAN_INITIALIZER(name, _k_chan_buf_##name,		\
+				   (msg_size), (max_msgs))
+
+/**
+ * @brief Initialize a channel.
+ *
+ * A channel passes fixed size messages between any number of producers and
+ * consumers, threads or ISRs. Messages are written and read in place, in
+ * the buffer of the channel: a producer claims a slot, fills it and commits
+ * it, a consumer claims the oldest committed message and finishes it once
+ * done with it, which frees the slot.
+ *
+ * Claiming and releasing slots is lock-free. The channel lock is only taken
+ * when the channel is empty or full and a thread has to wait, or when such a
+ * thread has to be woken up.
+ *
+ * Since messages are accessed in place, the buffer of a channel used by user
+ * mode threads must be accessible to them, for instance by placing it in a
+ * memory partition. The sequence numbers the channel keeps in each slot are
+ * then writable by those threads too: a user thread with access to the
+ * buffer can corrupt them and lose or duplicate messages, so the buffer must
+ * only be shared with threads trusted with the channel.
+ *
+ * @param chan Address of the channel.
+ * @param buffer Buffer of the channel, of @ref K_CHAN_BUF_SIZE bytes and
+ *        aligned to 8 bytes.
+ * @param msg_size Message size (in bytes).
+ * @param max_msgs Maximum number of messages the channel holds, a power of
+ *        two of at least 2.
+ *
+ * @retval 0 Channel initialized.
+ * @retval -EINVAL @p max_msgs is not a power of two of at least 2 or the
+ *         buffer is misaligned.
+ */
+__syscall int k_chan_init(struct k_chan *chan, void *buffer, size_t msg_size,
+			  uint32_t max_msgs);
+
+/**
+ * @brief Claim a slot of a channel for writing a message.
+ *
+ * Every claimed slot must be committed with k_chan_put_commit(). Consumers
+ * reach messages in the order slots were claimed, so an uncommitted slot
+ * holds back the messages claimed after it.
+ *
+ * @funcprops \isr_ok
+ *
+ * @note @p timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @param chan Address of the channel.
+ * @param data Set to the address of the claimed slot.
+ * @param timeout Waiting period for a free slot, or one of the special
+ *        values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Slot claimed.
+ * @retval -ENOMSG Returned without waiting, the channel is full.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_chan_put_claim(struct k_chan *chan, void **data, k_timeout_t timeout);
+
+/**
+ * @brief Commit a message written in a claimed slot.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param chan Address of the channel.
+ * @param data Address of the slot returned by k_chan_put_claim().
+ *
+ * @retval 0 Message committed.
+ * @retval -EINVAL @p data is not a slot of @p chan claimed for writing.
+ */
+__syscall int k_chan_put_commit(struct k_chan *chan, void *data);
+
+/**
+ * @brief Claim the oldest message of a channel.
+ *
+ * Every claimed message must be finished with k_chan_get_finish().
+ *
+ * @funcprops \isr_ok
+ *
+ * @note @p timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @param chan Address of the channel.
+ * @param data Set to the address of the claimed message.
+ * @param timeout Waiting period for a message, or one of the special values
+ *        K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message claimed.
+ * @retval -ENOMSG Returned without waiting, the channel is empty.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_chan_get_claim(struct k_chan *chan, void **data, k_timeout_t timeout);
+
+/**
+ * @brief Release a claimed message, freeing its slot.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param chan Address of the channel.
+ * @param data Address of the message returned by k_chan_get_claim().
+ *
+ * @retval 0 Slot freed.
+ * @retval -EINVAL @p data is not a message of @p chan claimed for reading.
+ */
+__syscall int k_chan_get_finish(struct k_chan *chan, void *data);
+
+/**
+ * @brief Copy a message to a channel.
+ *
+ * @funcprops \isr_ok
+ *
+ * @note @p timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @param chan Address of the channel.
+ * @param data Message of the size of the channel messages.
+ * @param timeout Waiting period for a free slot, or one of the special
+ *        values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message sent.
+ * @retval -ENOMSG Returned without waiting, the channel is full.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_chan_put(struct k_chan *chan, const void *data, k_timeout_t timeout);
+
+/**
+ * @brief Copy the oldest message out of a channel.
+ *
+ * @funcprops \isr_ok
+ *
+ * @note @p timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @param chan Address of the channel.
+ * @param data Buffer of the size of the channel messages.
+ * @param timeout Waiting period for a message, or one of the special values
+ *        K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message received.
+ * @retval -ENOMSG Returned without waiting, the channel is empty.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_chan_get(struct k_chan *chan, void *data, k_timeout_t timeout);
+
+/** @} */
+
 /**
  * @defgroup mailbox_apis Mailbox APIs
  * @ingroup kernel_apis
@@ -5563,12 +5987,34 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
  * @{
  */
 
+#ifdef CONFIG_K_HEAP_CPU_CACHE
+/* Per-CPU cache of free k_heap blocks, one stack per size class */
+struct z_heap_cpu_cache {
+	struct k_spinlock lock;
+	uint8_t count[CONFIG_K_HEAP_CPU_CACHE_CLASSES];
+	void *blocks[CONFIG_K_HEAP_CPU_CACHE_CLASSES][CONFIG_K_HEAP_CPU_CACHE_DEPTH];
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t frees;
+	uint32_t spills;
+#endif /* CONFIG_SYS_HEAP_RUNTIME_STATS */
+};
+#endif /* CONFIG_K_HEAP_CPU_CACHE */
+
 /* kernel synchronized heap struct */
 
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_K_HEAP_CPU_CACHE
+	struct z_heap_cpu_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+	atomic_t cache_waiters;
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	uint32_t cache_drains;
+#endif /* CONFIG_SYS_HEAP_RUNTIME_STATS */
+#endif /* CONFIG_K_HEAP_CPU_CACHE */
 };
 
 /**
@@ -5697,6 +6143,42 @@ void *k_heap_realloc(struct k_heap *h, void *ptr, size_t bytes, k_timeout_t time
  */
 void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 
+#if defined(CONFIG_K_HEAP_CPU_CACHE) && defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
+/**
+ * @brief Per-CPU cache statistics of a k_heap
+ *
+ * Counters are summed over all CPUs.
+ */
+struct k_heap_cache_stats {
+	/** Allocations served from a per-CPU cache */
+	uint32_t hits;
+	/** Cacheable allocations that had to go to the heap */
+	uint32_t misses;
+	/** Frees absorbed by a per-CPU cache */
+	uint32_t frees;
+	/** Cacheable frees returned to the heap because the cache was full */
+	uint32_t spills;
+	/** Number of times all caches were flushed to satisfy an allocation */
+	uint32_t drains;
+	/** Blocks currently held in the caches */
+	uint32_t cached_blocks;
+};
+
+/**
+ * @brief Get the per-CPU cache statistics of a k_heap
+ *
+ * Blocks held in the caches are accounted as allocated by
+ * sys_heap_runtime_stats_get().
+ *
+ * @param h Heap to query
+ * @param stats Pointer to the structure to fill
+ *
+ * @retval 0 Success
+ * @retval -EINVAL Any parameter points to NULL
+ */
+int k_heap_cache_stats_get(struct k_heap *h, struct k_heap_cache_stats *stats);
+#endif /* CONFIG_K_HEAP_CPU_CACHE && CONFIG_SYS_HEAP_RUNTIME_STATS */
+
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
@@ -5881,6 +6363,9 @@ enum _poll_types_bits {
 	/* pipe data availability */
 	_POLL_TYPE_PIPE_DATA_AVAILABLE,
 
+	/* channel message availability */
+	_POLL_TYPE_CHAN_DATA_AVAILABLE,
+
 	_POLL_NUM_TYPES
 };
 
@@ -5909,6 +6394,9 @@ enum _poll_states_bits {
 	/* data is available to read from a pipe */
 	_POLL_STATE_PIPE_DATA_AVAILABLE,
 
+	/* a message is available to read from a channel */
+	_POLL_STATE_CHAN_DATA_AVAILABLE,
+
 	_POLL_NUM_STATES
 };
 
@@ -5941,6 +6429,7 @@ enum _poll_states_bits {
 #define K_POLL_TYPE_FIFO_DATA_AVAILABLE K_POLL_TYPE_DATA_AVAILABLE
 #define K_POLL_TYPE_MSGQ_DATA_AVAILABLE Z_POLL_TYPE_BIT(_POLL_TYPE_MSGQ_DATA_AVAILABLE)
 #define K_POLL_TYPE_PIPE_DATA_AVAILABLE Z_POLL_TYPE_BIT(_POLL_TYPE_PIPE_DATA_AVAILABLE)
+#define K_POLL_TYPE_CHAN_DATA_AVAILABLE Z_POLL_TYPE_BIT(_POLL_TYPE_CHAN_DATA_AVAILABLE)
 
 /* public - polling modes */
 enum k_poll_modes {
@@ -5958,6 +6447,7 @@ enum k_poll_modes {
 #define K_POLL_STATE_FIFO_DATA_AVAILABLE K_POLL_STATE_DATA_AVAILABLE
 #define K_POLL_STATE_MSGQ_DATA_AVAILABLE Z_POLL_STATE_BIT(_POLL_STATE_MSGQ_DATA_AVAILABLE)
 #define K_POLL_STATE_PIPE_DATA_AVAILABLE Z_POLL_STATE_BIT(_POLL_STATE_PIPE_DATA_AVAILABLE)
+#define K_POLL_STATE_CHAN_DATA_AVAILABLE Z_POLL_STATE_BIT(_POLL_STATE_CHAN_DATA_AVAILABLE)
 #define K_POLL_STATE_CANCELLED Z_POLL_STATE_BIT(_POLL_STATE_CANCELLED)
 
 /* public - poll signal object */
@@ -6019,6 +6509,7 @@ struct k_poll_event {
 		struct k_queue *queue, *typed_K_POLL_TYPE_DATA_AVAILABLE;
 		struct k_msgq *msgq, *typed_K_POLL_TYPE_MSGQ_DATA_AVAILABLE;
 		struct k_pipe *pipe, *typed_K_POLL_TYPE_PIPE_DATA_AVAILABLE;
+		struct k_chan *chan, *typed_K_POLL_TYPE_CHAN_DATA_AVAILABLE;
 	};
 };
 
@@ -6167,6 +6658,86 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+/**
+ * @brief Persistent poll set
+ *
+ * A poll set keeps its events registered with their objects across waits,
+ * so waiting on a large set only costs the events that became ready.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - events signaled and not yet returned by a wait */
+	sys_dlist_t ready;
+
+	/** PRIVATE - events returned by a wait, re-armed by the next one */
+	sys_dlist_t rearm;
+
+	/** PRIVATE - threads waiting on the set */
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * @param set Poll set to initialize.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add an event to a poll set.
+ *
+ * The event is registered with its object until it is removed from the set
+ * with k_poll_set_remove(). An event ready when added is reported by the next
+ * wait. The event must have been initialized with k_poll_event_init() or one
+ * of the initializer macros, and must not be used with k_poll() or be a
+ * member of another set while in the set.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param set Poll set.
+ * @param event Event to add.
+ */
+void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove an event from a poll set.
+ *
+ * The event is unregistered from its object and is no longer reported by
+ * the set. An event must be removed before its object is destroyed.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param set Poll set the event was added to.
+ * @param event Event to remove.
+ */
+void k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to be ready.
+ *
+ * This routine returns the events of @a set that became ready, up to
+ * @a num_events of them, without touching the others. The state field of
+ * each returned event is set as with k_poll().
+ *
+ * Events are level-triggered: the events returned by a wait are checked
+ * again by the next wait on the set, and reported again if their condition
+ * still holds. Events left over because @a num_events was too small are
+ * reported by the next wait.
+ *
+ * @param set Poll set to wait on.
+ * @param events Array receiving the addresses of the ready events.
+ * @param num_events Number of entries in @a events.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of ready events stored in @a events, at least 1.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events, int num_events,
+		    k_timeout_t timeout);
+
 /** @} */
 
 /**
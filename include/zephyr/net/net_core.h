@@ -155,6 +155,15 @@ int net_send_data(struct net_pkt *pkt);
 #define NET_TC_COUNT 0
 #endif /* CONFIG_NET_TC_TX_COUNT && CONFIG_NET_TC_RX_COUNT */
 
+#if defined(CONFIG_NET_TC_RX_QUEUES)
+#define NET_TC_RX_QUEUES CONFIG_NET_TC_RX_QUEUES
+#else
+#define NET_TC_RX_QUEUES 1
+#endif
+
+/* Total number of RX queues, each with its own thread */
+#define NET_TC_RX_QUEUE_COUNT (NET_TC_RX_COUNT * NET_TC_RX_QUEUES)
+
 /**
  * @brief Registration information for a given L3 handler. Note that
  *        the layer number (L3) just refers to something that is on top
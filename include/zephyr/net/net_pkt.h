@@ -227,6 +227,11 @@ struct net_pkt {
 #if defined(CONFIG_NET_IP_FRAGMENT)
 	uint8_t ip_reassembled : 1; /* Packet is a reassembled IP packet. */
 #endif
+#if defined(CONFIG_NET_GRO)
+	uint8_t gro : 1; /* Packet went through software GRO, its TCP
+			  * checksum has already been verified.
+			  */
+#endif
 #if defined(CONFIG_NET_PKT_TIMESTAMP)
 	uint8_t tx_timestamping : 1; /** Timestamp transmitted packet */
 	uint8_t rx_timestamping : 1; /** Timestamp received packet */
@@ -988,6 +993,31 @@ static inline void net_pkt_set_ip_reassembled(struct net_pkt *pkt,
 }
 #endif /* CONFIG_NET_IP_FRAGMENT */
 
+#if defined(CONFIG_NET_GRO)
+static inline bool net_pkt_is_gro(struct net_pkt *pkt)
+{
+	return !!(pkt->gro);
+}
+
+static inline void net_pkt_set_gro(struct net_pkt *pkt, bool gro)
+{
+	pkt->gro = gro;
+}
+#else /* CONFIG_NET_GRO */
+static inline bool net_pkt_is_gro(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return false;
+}
+
+static inline void net_pkt_set_gro(struct net_pkt *pkt, bool gro)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(gro);
+}
+#endif /* CONFIG_NET_GRO */
+
 static inline uint8_t net_pkt_priority(struct net_pkt *pkt)
 {
 	return pkt->priority;
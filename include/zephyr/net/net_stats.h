@@ -357,6 +357,18 @@ struct net_stats_tc {
 };
 
 
+/**
+ * @brief RX queue statistics
+ */
+struct net_stats_rx_queue {
+	/** Number of packets steered to this queue */
+	net_stats_t pkts;
+	/** Number of packets dropped because the queue was full */
+	net_stats_t dropped;
+	/** Number of bytes steered to this queue */
+	net_stats_t bytes;
+};
+
 /**
  * @brief Power management statistics
  */
@@ -448,6 +460,11 @@ struct net_stats {
 	struct net_stats_tc tc;
 #endif
 
+#if NET_TC_RX_QUEUES > 1
+	/** Statistics of each RX queue, traffic class major */
+	struct net_stats_rx_queue rx_queue[NET_TC_RX_QUEUE_COUNT];
+#endif
+
 #if defined(CONFIG_NET_PKT_TXTIME_STATS)
 	/** Network packet TX time statistics */
 	struct net_stats_tx_time tx_time;
@@ -76,6 +76,8 @@ extern "C" {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmmsg: Turn on ZSOCK_MSG_DONTWAIT after the first message */
+#define ZSOCK_MSG_WAITFORONE 0x10000
 /** @} */
 
 /**
@@ -474,6 +476,31 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 __syscall ssize_t zsock_sendmsg(int sock, const struct msghdr *msg,
 				int flags);
 
+/**
+ * @brief Send several messages in one call
+ *
+ * @details
+ * Send up to @p vlen messages described by @p msgvec, as if by calling
+ * zsock_sendmsg() for each of them in turn, but paying the system call,
+ * socket lookup and socket lock cost only once. The number of bytes
+ * sent for each message is stored in its @c msg_len field.
+ *
+ * The call stops at the first message that cannot be sent. If at least
+ * one message was sent, the number of messages sent is returned and the
+ * error is left to be reported by the next call.
+ *
+ * This follows the Linux sendmmsg() call.
+ *
+ * @param sock Socket descriptor
+ * @param msgvec Array of messages to send
+ * @param vlen Number of entries in @p msgvec
+ * @param flags Flags applied to every message, as for zsock_sendmsg()
+ *
+ * @return Number of messages sent, or -1 with errno set if none was sent.
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
 /**
  * @brief Receive data from an arbitrary network address
  *
@@ -500,6 +527,73 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
 
+/**
+ * @brief Receive several messages in one call
+ *
+ * @details
+ * Receive up to @p vlen messages into @p msgvec, as if by calling
+ * zsock_recvmsg() for each of them in turn, but paying the system call,
+ * socket lookup and socket lock cost only once. The number of bytes
+ * received for each message is stored in its @c msg_len field.
+ *
+ * Every receive honours @p flags, so a blocking socket waits until all
+ * @p vlen messages have arrived. With @ref ZSOCK_MSG_WAITFORONE only the
+ * first receive may block, and the call returns whatever is queued
+ * after that. Unlike Linux recvmmsg(), there is no timeout argument;
+ * use @c SO_RCVTIMEO instead.
+ *
+ * @param sock Socket descriptor
+ * @param msgvec Array of messages to fill
+ * @param vlen Number of entries in @p msgvec
+ * @param flags Flags, as for zsock_recvmsg(), plus @ref ZSOCK_MSG_WAITFORONE
+ *
+ * @return Number of messages received, or -1 with errno set if none was
+ *         received.
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
+struct net_buf;
+
+/**
+ * @brief Receive data without copying it
+ *
+ * @details
+ * Like zsock_recvfrom(), but instead of copying the payload into a user
+ * buffer, the network buffers holding it are handed over to the caller
+ * as a fragment chain in @p frags. The caller owns that reference and
+ * must give it back with net_buf_unref() once done with the data. As the
+ * buffers come from the network RX pool, holding on to them for long
+ * stalls reception on every interface.
+ *
+ * For datagram sockets one call returns one whole datagram. For stream
+ * sockets one call returns the unread part of the oldest received
+ * segment, which may be shorter than what is queued. The only supported
+ * flag is @ref ZSOCK_MSG_DONTWAIT.
+ *
+ * When the buffers are shared with another user, a private copy is made,
+ * and the call fails with ENOBUFS if it cannot be allocated. Stream data is
+ * then kept queued for the next call, while the datagram is dropped.
+ *
+ * Only native TCP and UDP sockets support this call, other sockets fail
+ * with EOPNOTSUPP. The function is not a system call, as the buffers live
+ * in kernel memory, so it can only be used from supervisor threads.
+ *
+ * @kconfig_dep{CONFIG_NET_SOCKETS_RECV_ZC}
+ *
+ * @param sock Socket descriptor
+ * @param frags Set to the received fragment chain, or to NULL when
+ *              nothing was received
+ * @param flags Flags, only @ref ZSOCK_MSG_DONTWAIT is supported
+ * @param src_addr Source address of the data, can be NULL
+ * @param addrlen Length of @p src_addr, value-result argument
+ *
+ * @return Number of bytes received, 0 on end of stream, or -1 with errno
+ *         set on error.
+ */
+ssize_t zsock_recvfrom_zc(int sock, struct net_buf **frags, int flags,
+			  struct sockaddr *src_addr, socklen_t *addrlen);
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -922,6 +1016,8 @@ struct ifreq {
 #define TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define TCP_KEEPCNT 4
+/** Congestion control algorithm name (string) */
+#define TCP_CONGESTION 5
 
 /** @} */
 
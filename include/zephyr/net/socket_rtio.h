@@ -0,0 +1,116 @@
+/**
+ * @file
+ * @brief RTIO I/O device for BSD sockets
+ *
+ * Lets socket receive and send operations be submitted to an RTIO context
+ * and collected as completions, next to the I/O of other devices.
+ */
+
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_SOCKET_RTIO_H_
+#define ZEPHYR_INCLUDE_NET_SOCKET_RTIO_H_
+
+/**
+ * @brief RTIO I/O device for BSD sockets
+ * @defgroup bsd_socket_rtio BSD socket RTIO device
+ * @since 4.2
+ * @version 0.1.0
+ * @ingroup networking
+ * @{
+ */
+
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/net/socket.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief iodev_flags bit of an RTIO_OP_RX submission: lend the network
+ * buffers instead of copying, see zsock_rtio_sqe_prep_recv_zc().
+ */
+#define ZSOCK_RTIO_RECV_ZC BIT(0)
+
+/** @cond INTERNAL_HIDDEN */
+
+struct zsock_rtio_iodev_data {
+	int sock;
+};
+
+extern const struct rtio_iodev_api zsock_rtio_iodev_api;
+
+/** @endcond */
+
+/**
+ * @brief Define an RTIO I/O device for a socket
+ *
+ * The device is not bound to a socket until zsock_rtio_iodev_set_sock()
+ * is called.
+ *
+ * RTIO_OP_RX receives into the submission buffer (or an RTIO mempool
+ * buffer) as zsock_recv() would, RTIO_OP_TX and RTIO_OP_TINY_TX send as
+ * zsock_send() would. The result of the completion is the number of bytes
+ * transferred, or a negative errno value.
+ *
+ * @param name Name of the I/O device
+ */
+#define ZSOCK_RTIO_IODEV_DEFINE(name)						\
+	static struct zsock_rtio_iodev_data _zsock_rtio_data_##name = {		\
+		.sock = -1,							\
+	};									\
+	RTIO_IODEV_DEFINE(name, &zsock_rtio_iodev_api, &_zsock_rtio_data_##name)
+
+/**
+ * @brief Bind an RTIO socket I/O device to a socket
+ *
+ * Must not be called while submissions to the device are pending.
+ *
+ * @param iodev I/O device defined with ZSOCK_RTIO_IODEV_DEFINE()
+ * @param sock Socket descriptor, or -1 to unbind
+ */
+static inline void zsock_rtio_iodev_set_sock(struct rtio_iodev *iodev, int sock)
+{
+	struct zsock_rtio_iodev_data *data = iodev->data;
+
+	data->sock = sock;
+}
+
+/**
+ * @brief Prepare a zero-copy receive submission
+ *
+ * On completion the received fragment chain is stored in @p frags and
+ * the result is its length, as for zsock_recvfrom_zc(). The chain must be
+ * released with net_buf_unref().
+ *
+ * @kconfig_dep{CONFIG_NET_SOCKETS_RECV_ZC}
+ *
+ * @param sqe Submission to prepare
+ * @param iodev I/O device defined with ZSOCK_RTIO_IODEV_DEFINE()
+ * @param frags Where to store the received fragment chain
+ * @param userdata User data returned with the completion
+ */
+static inline void zsock_rtio_sqe_prep_recv_zc(struct rtio_sqe *sqe,
+					       const struct rtio_iodev *iodev,
+					       struct net_buf **frags,
+					       void *userdata)
+{
+	rtio_sqe_prep_read(sqe, iodev, RTIO_PRIO_NORM, (uint8_t *)frags,
+			   sizeof(*frags), userdata);
+	sqe->iodev_flags = ZSOCK_RTIO_RECV_ZC;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_SOCKET_RTIO_H_ */
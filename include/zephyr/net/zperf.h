@@ -46,6 +46,7 @@ struct zperf_upload_params {
 		int tcp_nodelay;
 		int priority;
 		uint32_t report_interval_ms;
+		uint16_t udp_batch;
 	} options;
 };
 
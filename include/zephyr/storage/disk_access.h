@@ -113,6 +113,35 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
  */
 int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buff);
 
+/**
+ * @brief Disk cache statistics
+ */
+struct disk_cache_stats {
+	/** Sectors read from the cache */
+	uint32_t read_hits;
+	/** Sectors requested by readers that were not in the cache */
+	uint32_t read_misses;
+	/** Sectors read ahead of the requests */
+	uint32_t read_ahead;
+	/** Read commands issued to the disks */
+	uint32_t disk_reads;
+	/** Write commands issued to the disks */
+	uint32_t disk_writes;
+	/** Sectors written to the disks */
+	uint32_t disk_written;
+};
+
+/**
+ * @brief Get the statistics of the disk cache
+ *
+ * Only available with @kconfig{CONFIG_DISK_CACHE}. The statistics cover all
+ * cached disks.
+ *
+ * @param[out] stats        Statistics
+ * @param[in] reset         Reset the statistics after reading them
+ */
+void disk_cache_stats_get(struct disk_cache_stats *stats, bool reset);
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,6 +25,9 @@
 
 #include <stdbool.h>
 #include <zephyr/drivers/flash.h>
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+#include <zephyr/kernel.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -71,6 +74,14 @@ struct stream_flash_ctx {
 #endif
 	size_t write_block_size;	/* Offset/size device write alignment */
 	uint8_t erase_value;
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	uint8_t *prog_buf;		/* Buffer programmed in the background */
+	size_t prog_bytes;		/* Number of bytes being programmed */
+	int prog_rc;			/* Result of the background programming */
+	int prog_err;			/* First background programming error */
+	struct k_work prog_work;
+	struct k_sem prog_done;		/* Available when not programming */
+#endif
 };
 
 /**
@@ -103,6 +114,60 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
  */
 size_t stream_flash_bytes_written(const struct stream_flash_ctx *ctx);
 
+/**
+ * @brief Read number of bytes accepted but not yet written to the flash.
+ *
+ * These are the bytes stored in the write buffer, and with double buffering
+ * the bytes being programmed in the background.
+ *
+ * @param ctx context
+ *
+ * @return Number of payload bytes not yet written to flash.
+ */
+size_t stream_flash_bytes_buffered(const struct stream_flash_ctx *ctx);
+
+/**
+ * @brief Program the write buffers of a context in the background.
+ *
+ * Once enabled, a filled write buffer is handed to the stream flash work
+ * queue to be programmed, together with the erase it needs and an erase
+ * ahead for the next buffer, while the next data is stored in the second
+ * buffer. A write waits only when both buffers are in use.
+ *
+ * The error of a background programming is returned by the next call to
+ * stream_flash_buffered_write(), and the data of that buffer is dropped.
+ * The following writes, flushes and waits fail with the same error until
+ * the context is initialized again.
+ * stream_flash_bytes_written() counts the data once its programming has
+ * completed, and a write with @p flush set waits for the programming to
+ * complete. The post-write callback runs on the work queue thread.
+ *
+ * A context with buffers being programmed must be flushed before it is
+ * re-initialized.
+ *
+ * Requires @kconfig{CONFIG_STREAM_FLASH_ASYNC}.
+ *
+ * @param ctx context, initialized with stream_flash_init() and not written to yet
+ * @param buf Second write buffer, of the length given to stream_flash_init()
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int stream_flash_async_enable(struct stream_flash_ctx *ctx, uint8_t *buf);
+
+/**
+ * @brief Wait for the background programming of a context to complete.
+ *
+ * Unlike a flush, the data stored in the write buffer is not written. This
+ * allows to re-initialize the context of an abandoned stream.
+ *
+ * Requires @kconfig{CONFIG_STREAM_FLASH_ASYNC}.
+ *
+ * @param ctx context
+ *
+ * @return non-negative on success, negative errno code of the programming on fail
+ */
+int stream_flash_async_wait(struct stream_flash_ctx *ctx);
+
 /**
  * @brief Process input buffers to be written to flash device in single blocks.
  * Will store remainder between calls.
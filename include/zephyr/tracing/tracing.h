@@ -1045,6 +1045,28 @@
  */
 #define sys_port_trace_k_queue_get_exit(queue, timeout, ret)
 
+/**
+ * @brief Trace Queue get many attempt enter
+ * @param queue Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_queue_get_many_enter(queue, timeout)
+
+/**
+ * @brief Trace Queue get many attempt blocking
+ * @param queue Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_queue_get_many_blocking(queue, timeout)
+
+/**
+ * @brief Trace Queue get many attempt outcome
+ * @param queue Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_queue_get_many_exit(queue, timeout, ret)
+
 /**
  * @brief Trace Queue remove enter
  * @param queue Queue object
@@ -1192,6 +1214,21 @@
  */
 #define sys_port_trace_k_fifo_get_exit(fifo, timeout, ret)
 
+/**
+ * @brief Trace FIFO Queue get many entry
+ * @param fifo FIFO object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_fifo_get_many_enter(fifo, timeout)
+
+/**
+ * @brief Trace FIFO Queue get many exit
+ * @param fifo FIFO object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_fifo_get_many_exit(fifo, timeout, ret)
+
 /**
  * @brief Trace FIFO Queue peek head entry
  * @param fifo FIFO object
@@ -1441,6 +1478,50 @@
  */
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)
 
+/**
+ * @brief Trace Message Queue put many attempt entry
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_put_many_enter(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue put many attempt blocking
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_put_many_blocking(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue put many attempt outcome
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_put_many_exit(msgq, timeout, ret)
+
+/**
+ * @brief Trace Message Queue get many attempt entry
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_get_many_enter(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue get many attempt blocking
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_get_many_blocking(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue get many attempt outcome
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_get_many_exit(msgq, timeout, ret)
+
 /**
  * @brief Trace Message Queue peek
  * @param msgq Message Queue object
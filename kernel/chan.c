@@ -0,0 +1,440 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Channels.
+ *
+ * A channel is a bounded queue of fixed size slots where every slot carries a
+ * sequence number, after Dmitry Vyukov's bounded MPMC queue. The sequence
+ * number of a slot tells whether it is free for the producer claiming it at a
+ * given position or holds a message committed for the consumer claiming it
+ * at that position, so claiming a slot is a single compare-and-swap of the
+ * head or tail position and no lock is needed unless a thread has to wait.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+
+#include <string.h>
+#include <ksched.h>
+#include <wait_q.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <kernel_internal.h>
+
+/* Sides of the channel threads are waiting on */
+#define CHAN_GET_WAITING BIT(0)
+#define CHAN_PUT_WAITING BIT(1)
+#define CHAN_POLL_WAITING BIT(2)
+
+static inline uint32_t chan_index(struct k_chan *chan, uint32_t pos)
+{
+	return pos & (chan->max_msgs - 1U);
+}
+
+static inline atomic_t *chan_slot(struct k_chan *chan, uint32_t pos)
+{
+	size_t offset = chan_index(chan, pos) * Z_CHAN_SLOT_SIZE(chan->msg_size);
+
+	return (atomic_t *)&chan->buffer[offset];
+}
+
+/* The sequence number of a slot is the position at which it can be claimed
+ * for writing, plus one once its message is committed. It is stored minus the
+ * index of the slot, so that a zeroed buffer is an empty channel.
+ */
+static inline uint32_t chan_seq(struct k_chan *chan, atomic_t *slot, uint32_t pos)
+{
+	return (uint32_t)atomic_get(slot) + chan_index(chan, pos);
+}
+
+/* Move the sequence number of a slot found by chan_slot_of() on by @p delta,
+ * unless another thread did it first.
+ */
+static inline bool chan_seq_add(atomic_t *slot, atomic_val_t seq, uint32_t delta)
+{
+	return atomic_cas(slot, seq, (atomic_val_t)((uint32_t)seq + delta));
+}
+
+/* Find the slot holding a message returned by a claim, NULL if @p data is not
+ * one of them or its slot is not claimed. A slot claimed at a position has the
+ * sequence number of that position plus @p ready, with @p posp moved past it.
+ * The sequence number the slot was found with is stored in @p seqp.
+ */
+static atomic_t *chan_slot_of(struct k_chan *chan, void *data, atomic_t *posp,
+			      uint32_t ready, atomic_val_t *seqp)
+{
+	size_t slot_size = Z_CHAN_SLOT_SIZE(chan->msg_size);
+	uintptr_t offset = (uintptr_t)data - (uintptr_t)chan->buffer - Z_CHAN_HDR_SIZE;
+	uint32_t index;
+	atomic_t *slot;
+	uint32_t pos;
+
+	if ((offset >= ((uintptr_t)chan->max_msgs * slot_size)) || ((offset % slot_size) != 0U)) {
+		return NULL;
+	}
+
+	index = offset / slot_size;
+	slot = (atomic_t *)&chan->buffer[offset];
+	*seqp = atomic_get(slot);
+	pos = (uint32_t)*seqp + index - ready;
+
+	if ((chan_index(chan, pos) != index) ||
+	    ((int32_t)((uint32_t)atomic_get(posp) - pos) <= 0)) {
+		return NULL;
+	}
+
+	return slot;
+}
+
+/* Claim the slot at the position @p posp if its sequence number is the
+ * position plus @p ready.
+ *
+ * @return the message of the slot, NULL if the channel is full when claiming
+ * for writing or empty when claiming for reading.
+ */
+static void *chan_claim(struct k_chan *chan, atomic_t *posp, uint32_t ready)
+{
+	uint32_t pos = (uint32_t)atomic_get(posp);
+
+	while (true) {
+		atomic_t *slot = chan_slot(chan, pos);
+		int32_t diff = (int32_t)(chan_seq(chan, slot, pos) - (pos + ready));
+		uint32_t next;
+
+		if (diff < 0) {
+			return NULL;
+		}
+
+		if ((diff == 0) &&
+		    atomic_cas(posp, (atomic_val_t)pos, (atomic_val_t)(pos + 1U))) {
+			return (uint8_t *)slot + Z_CHAN_HDR_SIZE;
+		}
+
+		/* Another thread claimed the slot first. The position must then
+		 * have moved, unless the sequence numbers were overwritten.
+		 */
+		next = (uint32_t)atomic_get(posp);
+		if ((diff > 0) && (next == pos)) {
+			return NULL;
+		}
+
+		pos = next;
+	}
+}
+
+/* The poll lock is only taken if a poller flagged itself as waiting, see
+ * z_chan_poll_check().
+ */
+static inline void handle_poll_events(struct k_chan *chan)
+{
+#ifdef CONFIG_POLL
+	if ((atomic_get(&chan->waiting) & CHAN_POLL_WAITING) == 0) {
+		return;
+	}
+
+	if (z_handle_obj_poll_events(&chan->poll_events, K_POLL_STATE_CHAN_DATA_AVAILABLE)) {
+		z_reschedule_unlocked();
+	}
+#else
+	ARG_UNUSED(chan);
+#endif /* CONFIG_POLL */
+}
+
+/* Wake up a thread waiting on one side of the channel, after the other side
+ * committed a message or freed a slot. The lock is only taken if a thread
+ * flagged itself as waiting.
+ */
+static void chan_wake(struct k_chan *chan, _wait_q_t *wait_q, atomic_val_t bit)
+{
+	k_spinlock_key_t key;
+	bool resched;
+
+	if ((atomic_get(&chan->waiting) & bit) == 0) {
+		return;
+	}
+
+	key = k_spin_lock(&chan->lock);
+
+	resched = z_sched_wake(wait_q, 0, NULL);
+	if (z_waitq_head(wait_q) == NULL) {
+		(void)atomic_and(&chan->waiting, ~bit);
+	}
+
+	if (resched) {
+		z_reschedule(&chan->lock, key);
+	} else {
+		k_spin_unlock(&chan->lock, key);
+	}
+}
+
+/* Claim a slot for writing when @p put is set, or a message otherwise,
+ * waiting up to @p timeout for one.
+ */
+static int chan_claim_wait(struct k_chan *chan, void **data, k_timeout_t timeout, bool put)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	atomic_t *posp = put ? &chan->head : &chan->tail;
+	_wait_q_t *wait_q = put ? &chan->put_wait_q : &chan->get_wait_q;
+	atomic_val_t bit = put ? CHAN_PUT_WAITING : CHAN_GET_WAITING;
+	uint32_t ready = put ? 0U : 1U;
+	k_spinlock_key_t key;
+	k_timepoint_t end;
+	k_timeout_t left;
+	void *msg;
+	int ret;
+
+	msg = chan_claim(chan, posp, ready);
+	if (msg != NULL) {
+		*data = msg;
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return -ENOMSG;
+	}
+
+	end = sys_timepoint_calc(timeout);
+
+	do {
+		key = k_spin_lock(&chan->lock);
+
+		/* Flag the wait before trying again: either the other side
+		 * sees the flag, or this sees its message or free slot.
+		 */
+		(void)atomic_or(&chan->waiting, bit);
+
+		msg = chan_claim(chan, posp, ready);
+		if (msg != NULL) {
+			k_spin_unlock(&chan->lock, key);
+			*data = msg;
+			return 0;
+		}
+
+		left = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(left, K_NO_WAIT)) {
+			k_spin_unlock(&chan->lock, key);
+			return -EAGAIN;
+		}
+
+		/* Woken up threads race with other claimers, so try again */
+		ret = z_pend_curr(&chan->lock, key, wait_q, left);
+	} while (ret == 0);
+
+	return ret;
+}
+
+#ifdef CONFIG_POLL
+static bool chan_data_available(struct k_chan *chan)
+{
+	uint32_t pos = (uint32_t)atomic_get(&chan->tail);
+
+	return chan_seq(chan, chan_slot(chan, pos), pos) == (pos + 1U);
+}
+
+bool z_chan_poll_check(struct k_chan *chan)
+{
+	/* Flag the poller before checking: either the producer committing a
+	 * message sees the flag, or this sees its message.
+	 */
+	(void)atomic_or(&chan->waiting, CHAN_POLL_WAITING);
+
+	return chan_data_available(chan);
+}
+
+void z_chan_poll_done(struct k_chan *chan)
+{
+	/* Pollers flag themselves under the poll lock, held by the caller */
+	if (sys_dlist_is_empty(&chan->poll_events)) {
+		(void)atomic_and(&chan->waiting, ~CHAN_POLL_WAITING);
+	}
+}
+#endif /* CONFIG_POLL */
+
+int z_impl_k_chan_init(struct k_chan *chan, void *buffer, size_t msg_size,
+		       uint32_t max_msgs)
+{
+	/* With a single slot, a committed message would also be free */
+	if ((max_msgs < 2U) || !IS_POWER_OF_TWO(max_msgs) || !IS_ALIGNED(buffer, Z_CHAN_HDR_SIZE)) {
+		return -EINVAL;
+	}
+
+	chan->buffer = buffer;
+	chan->msg_size = msg_size;
+	chan->max_msgs = max_msgs;
+	(void)atomic_set(&chan->head, 0);
+	(void)atomic_set(&chan->tail, 0);
+	(void)atomic_set(&chan->waiting, 0);
+
+	for (uint32_t i = 0; i < max_msgs; i++) {
+		(void)atomic_set(chan_slot(chan, i), 0);
+	}
+
+	z_waitq_init(&chan->get_wait_q);
+	z_waitq_init(&chan->put_wait_q);
+	chan->lock = (struct k_spinlock) {};
+#ifdef CONFIG_POLL
+	sys_dlist_init(&chan->poll_events);
+#endif /* CONFIG_POLL */
+
+	k_object_init(chan);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_chan_init(struct k_chan *chan, void *buffer, size_t msg_size,
+				     uint32_t max_msgs)
+{
+	size_t size = 0;
+	bool overflow = (msg_size > (SIZE_MAX / 2U)) ||
+			size_mul_overflow(Z_CHAN_SLOT_SIZE(msg_size), max_msgs, &size);
+
+	K_OOPS(K_SYSCALL_OBJ_INIT(chan, K_OBJ_CHAN));
+	K_OOPS(K_SYSCALL_VERIFY_MSG(!overflow, "channel buffer too large"));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(buffer, size));
+
+	return z_impl_k_chan_init(chan, buffer, msg_size, max_msgs);
+}
+#include <zephyr/syscalls/k_chan_init_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_chan_put_claim(struct k_chan *chan, void **data, k_timeout_t timeout)
+{
+	return chan_claim_wait(chan, data, timeout, true);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_chan_put_claim(struct k_chan *chan, void **data,
+					  k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(chan, K_OBJ_CHAN));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, sizeof(*data)));
+
+	return z_impl_k_chan_put_claim(chan, data, timeout);
+}
+#include <zephyr/syscalls/k_chan_put_claim_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_chan_put_commit(struct k_chan *chan, void *data)
+{
+	atomic_val_t seq;
+	atomic_t *slot = chan_slot_of(chan, data, &chan->head, 0U, &seq);
+
+	if ((slot == NULL) || !chan_seq_add(slot, seq, 1U)) {
+		return -EINVAL;
+	}
+
+	chan_wake(chan, &chan->get_wait_q, CHAN_GET_WAITING);
+	handle_poll_events(chan);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_chan_put_commit(struct k_chan *chan, void *data)
+{
+	K_OOPS(K_SYSCALL_OBJ(chan, K_OBJ_CHAN));
+
+	return z_impl_k_chan_put_commit(chan, data);
+}
+#include <zephyr/syscalls/k_chan_put_commit_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_chan_get_claim(struct k_chan *chan, void **data, k_timeout_t timeout)
+{
+	return chan_claim_wait(chan, data, timeout, false);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_chan_get_claim(struct k_chan *chan, void **data,
+					  k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(chan, K_OBJ_CHAN));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, sizeof(*data)));
+
+	return z_impl_k_chan_get_claim(chan, data, timeout);
+}
+#include <zephyr/syscalls/k_chan_get_claim_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_chan_get_finish(struct k_chan *chan, void *data)
+{
+	atomic_val_t seq;
+	atomic_t *slot = chan_slot_of(chan, data, &chan->tail, 1U, &seq);
+
+	/* Free for the producer claiming it one lap later */
+	if ((slot == NULL) || !chan_seq_add(slot, seq, chan->max_msgs - 1U)) {
+		return -EINVAL;
+	}
+
+	chan_wake(chan, &chan->put_wait_q, CHAN_PUT_WAITING);
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_chan_get_finish(struct k_chan *chan, void *data)
+{
+	K_OOPS(K_SYSCALL_OBJ(chan, K_OBJ_CHAN));
+
+	return z_impl_k_chan_get_finish(chan, data);
+}
+#include <zephyr/syscalls/k_chan_get_finish_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_chan_put(struct k_chan *chan, const void *data, k_timeout_t timeout)
+{
+	void *msg;
+	int ret = chan_claim_wait(chan, &msg, timeout, true);
+
+	if (ret == 0) {
+		(void)memcpy(msg, data, chan->msg_size);
+		(void)z_impl_k_chan_put_commit(chan, msg);
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_chan_put(struct k_chan *chan, const void *data,
+				    k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(chan, K_OBJ_CHAN));
+	K_OOPS(K_SYSCALL_MEMORY_READ(data, chan->msg_size));
+
+	return z_impl_k_chan_put(chan, data, timeout);
+}
+#include <zephyr/syscalls/k_chan_put_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_chan_get(struct k_chan *chan, void *data, k_timeout_t timeout)
+{
+	void *msg;
+	int ret = chan_claim_wait(chan, &msg, timeout, false);
+
+	if (ret == 0) {
+		(void)memcpy(data, msg, chan->msg_size);
+		(void)z_impl_k_chan_get_finish(chan, msg);
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_chan_get(struct k_chan *chan, void *data,
+				    k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(chan, K_OBJ_CHAN));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, chan->msg_size));
+
+	return z_impl_k_chan_get(chan, data, timeout);
+}
+#include <zephyr/syscalls/k_chan_get_mrsh.c>
+#endif /* CONFIG_USERSPACE */
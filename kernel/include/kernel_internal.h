@@ -223,6 +223,13 @@ void z_mem_manage_boot_finish(void);
 
 bool z_handle_obj_poll_events(sys_dlist_t *events, uint32_t state);
 
+/* Flag a channel as polled and check whether its oldest message is committed,
+ * and clear the flag once no poller is registered. Used by k_poll(), with the
+ * poll lock held.
+ */
+bool z_chan_poll_check(struct k_chan *chan);
+void z_chan_poll_done(struct k_chan *chan);
+
 #ifdef CONFIG_PM
 
 /* When the kernel is about to go idle, it calls this function to notify the
@@ -12,10 +12,192 @@
 #include <ksched.h>
 #include <wait_q.h>
 
+#ifdef CONFIG_K_HEAP_CPU_CACHE
+
+#define CACHE_MIN_SHIFT 4U
+#define CACHE_CLASSES   CONFIG_K_HEAP_CPU_CACHE_CLASSES
+#define CACHE_DEPTH     CONFIG_K_HEAP_CPU_CACHE_DEPTH
+
+#define CLASS_SIZE(cls) ((size_t)1 << (CACHE_MIN_SHIFT + (cls)))
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+#define CACHE_STAT_INC(cc, field) ((cc)->field++)
+#else
+#define CACHE_STAT_INC(cc, field) do { } while (false)
+#endif /* CONFIG_SYS_HEAP_RUNTIME_STATS */
+
+/* The CPU id is only a placement hint: each cache has its own lock,
+ * so a thread migrating between reading the id and taking the lock
+ * merely uses a neighbour's cache.  In the common case the lock is
+ * uncontended and never shared with another CPU.
+ */
+static inline struct z_heap_cpu_cache *cpu_cache(struct k_heap *heap)
+{
+	return &heap->cache[arch_curr_cpu()->id];
+}
+
+/* Smallest class whose blocks can hold @bytes, or -1 */
+static inline int alloc_class(size_t bytes)
+{
+	for (int cls = 0; cls < CACHE_CLASSES; cls++) {
+		if (bytes <= CLASS_SIZE(cls)) {
+			return cls;
+		}
+	}
+	return -1;
+}
+
+/* Largest class whose requests a block of @usable bytes can serve,
+ * or -1 when the block is too small or would waste too much space
+ * (more than twice the size of the largest class).
+ */
+static inline int free_class(size_t usable)
+{
+	if ((usable < CLASS_SIZE(0)) || (usable >= 2U * CLASS_SIZE(CACHE_CLASSES - 1))) {
+		return -1;
+	}
+
+	for (int cls = CACHE_CLASSES - 1; cls > 0; cls--) {
+		if (usable >= CLASS_SIZE(cls)) {
+			return cls;
+		}
+	}
+	return 0;
+}
+
+/* Blocks served by the cache come from sys_heap_alloc(), so only
+ * requests it would also satisfy (no more than pointer alignment)
+ * may use it.
+ */
+static inline bool cacheable_align(size_t align)
+{
+	return ((align & (align - 1)) == 0U) && (align <= sizeof(void *));
+}
+
+static void *cache_get(struct k_heap *heap, int cls)
+{
+	struct z_heap_cpu_cache *cc = cpu_cache(heap);
+	void *mem = NULL;
+	k_spinlock_key_t key = k_spin_lock(&cc->lock);
+
+	if (cc->count[cls] > 0U) {
+		mem = cc->blocks[cls][--cc->count[cls]];
+		CACHE_STAT_INC(cc, hits);
+	} else {
+		CACHE_STAT_INC(cc, misses);
+	}
+
+	k_spin_unlock(&cc->lock, key);
+	return mem;
+}
+
+static bool cache_put(struct k_heap *heap, void *mem)
+{
+	int cls = free_class(sys_heap_usable_size(&heap->heap, mem));
+	struct z_heap_cpu_cache *cc;
+	k_spinlock_key_t key;
+	bool cached = false;
+
+	if (cls < 0) {
+		return false;
+	}
+
+	cc = cpu_cache(heap);
+	key = k_spin_lock(&cc->lock);
+
+	/* Waiters are checked under the cache lock so that a free racing
+	 * with cache_drain() either lands before the drain or sees the
+	 * waiter and takes the locked path that wakes it.
+	 */
+	if (atomic_get(&heap->cache_waiters) == 0) {
+		if (cc->count[cls] < CACHE_DEPTH) {
+			cc->blocks[cls][cc->count[cls]++] = mem;
+			CACHE_STAT_INC(cc, frees);
+			cached = true;
+		} else {
+			CACHE_STAT_INC(cc, spills);
+		}
+	}
+
+	k_spin_unlock(&cc->lock, key);
+	return cached;
+}
+
+/* Return every cached block to the heap.  Called with heap->lock
+ * held; the lock order is always heap lock, then cache lock.
+ */
+static bool cache_drain(struct k_heap *heap)
+{
+	bool drained = false;
+
+	for (unsigned int cpu = 0; cpu < ARRAY_SIZE(heap->cache); cpu++) {
+		struct z_heap_cpu_cache *cc = &heap->cache[cpu];
+		k_spinlock_key_t key = k_spin_lock(&cc->lock);
+
+		for (int cls = 0; cls < CACHE_CLASSES; cls++) {
+			while (cc->count[cls] > 0U) {
+				sys_heap_free(&heap->heap, cc->blocks[cls][--cc->count[cls]]);
+				drained = true;
+			}
+		}
+
+		k_spin_unlock(&cc->lock, key);
+	}
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	if (drained) {
+		heap->cache_drains++;
+	}
+#endif /* CONFIG_SYS_HEAP_RUNTIME_STATS */
+
+	return drained;
+}
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+int k_heap_cache_stats_get(struct k_heap *heap, struct k_heap_cache_stats *stats)
+{
+	if ((heap == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	*stats = (struct k_heap_cache_stats) {};
+
+	k_spinlock_key_t key = k_spin_lock(&heap->lock);
+
+	stats->drains = heap->cache_drains;
+	for (unsigned int cpu = 0; cpu < ARRAY_SIZE(heap->cache); cpu++) {
+		struct z_heap_cpu_cache *cc = &heap->cache[cpu];
+		k_spinlock_key_t ckey = k_spin_lock(&cc->lock);
+
+		stats->hits += cc->hits;
+		stats->misses += cc->misses;
+		stats->frees += cc->frees;
+		stats->spills += cc->spills;
+		for (int cls = 0; cls < CACHE_CLASSES; cls++) {
+			stats->cached_blocks += cc->count[cls];
+		}
+
+		k_spin_unlock(&cc->lock, ckey);
+	}
+
+	k_spin_unlock(&heap->lock, key);
+	return 0;
+}
+#endif /* CONFIG_SYS_HEAP_RUNTIME_STATS */
+
+#endif /* CONFIG_K_HEAP_CPU_CACHE */
+
 void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 {
 	z_waitq_init(&heap->wait_q);
 	heap->lock = (struct k_spinlock) {};
+#ifdef CONFIG_K_HEAP_CPU_CACHE
+	(void)memset(heap->cache, 0, sizeof(heap->cache));
+	atomic_clear(&heap->cache_waiters);
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	heap->cache_drains = 0U;
+#endif /* CONFIG_SYS_HEAP_RUNTIME_STATS */
+#endif /* CONFIG_K_HEAP_CPU_CACHE */
 	sys_heap_init(&heap->heap, mem, bytes);
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
@@ -68,6 +250,28 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 {
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
+	size_t alloc_bytes = bytes;
+
+#ifdef CONFIG_K_HEAP_CPU_CACHE
+	bool cache_waiter = false;
+
+	if ((bytes > 0U) && cacheable_align(align)) {
+		int cls = alloc_class(bytes);
+
+		if (cls >= 0) {
+			ret = cache_get(heap, cls);
+			if (ret != NULL) {
+				SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, heap, timeout);
+				SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout,
+							       ret);
+				return ret;
+			}
+
+			/* Round up so the block is reusable by its whole class */
+			alloc_bytes = CLASS_SIZE(cls);
+		}
+	}
+#endif /* CONFIG_K_HEAP_CPU_CACHE */
 
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
@@ -78,7 +282,28 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 	bool blocked_alloc = false;
 
 	while (ret == NULL) {
-		ret = sys_heap_aligned_alloc(&heap->heap, align, bytes);
+		ret = sys_heap_aligned_alloc(&heap->heap, align, alloc_bytes);
+
+#ifdef CONFIG_K_HEAP_CPU_CACHE
+		if (ret == NULL) {
+			/* Never fail just because of the class rounding */
+			if (alloc_bytes != bytes) {
+				alloc_bytes = bytes;
+				continue;
+			}
+
+			/* Stop further frees from being cached, then give
+			 * back whatever the caches hold and try again.
+			 */
+			if (!cache_waiter) {
+				cache_waiter = true;
+				atomic_inc(&heap->cache_waiters);
+			}
+			if (cache_drain(heap)) {
+				continue;
+			}
+		}
+#endif /* CONFIG_K_HEAP_CPU_CACHE */
 
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
@@ -102,6 +327,12 @@ void *k_heap_aligned_alloc(struct k_heap *heap, size_t align, size_t bytes,
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, heap, timeout, ret);
 
+#ifdef CONFIG_K_HEAP_CPU_CACHE
+	if (cache_waiter) {
+		atomic_dec(&heap->cache_waiters);
+	}
+#endif /* CONFIG_K_HEAP_CPU_CACHE */
+
 	k_spin_unlock(&heap->lock, key);
 	return ret;
 }
@@ -168,6 +399,16 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+#ifdef CONFIG_K_HEAP_CPU_CACHE
+	/* The size of an allocated chunk is only ever changed by its
+	 * owner, so it can be read here without the heap lock.
+	 */
+	if ((mem != NULL) && cache_put(heap, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+		return;
+	}
+#endif /* CONFIG_K_HEAP_CPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
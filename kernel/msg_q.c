@@ -298,6 +298,209 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <zephyr/syscalls/k_msgq_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+/* copy num_msgs messages into the ring buffer, there must be room for them */
+static void msgq_ring_put(struct k_msgq *msgq, const char *data, uint32_t num_msgs)
+{
+	size_t len = (size_t)num_msgs * msgq->msg_size;
+	size_t chunk = MIN(len, (size_t)(msgq->buffer_end - msgq->write_ptr));
+
+	__ASSERT_NO_MSG(num_msgs <= (msgq->max_msgs - msgq->used_msgs));
+	__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+			msgq->write_ptr < msgq->buffer_end);
+
+	(void)memcpy(msgq->write_ptr, data, chunk);
+	msgq->write_ptr += chunk;
+	if (msgq->write_ptr == msgq->buffer_end) {
+		msgq->write_ptr = msgq->buffer_start;
+	}
+	if (chunk < len) {
+		/* wrap-around */
+		(void)memcpy(msgq->write_ptr, data + chunk, len - chunk);
+		msgq->write_ptr += len - chunk;
+	}
+	msgq->used_msgs += num_msgs;
+}
+
+/* copy num_msgs messages out of the ring buffer, they must be available */
+static void msgq_ring_get(struct k_msgq *msgq, char *data, uint32_t num_msgs)
+{
+	size_t len = (size_t)num_msgs * msgq->msg_size;
+	size_t chunk = MIN(len, (size_t)(msgq->buffer_end - msgq->read_ptr));
+
+	__ASSERT_NO_MSG(num_msgs <= msgq->used_msgs);
+
+	(void)memcpy(data, msgq->read_ptr, chunk);
+	msgq->read_ptr += chunk;
+	if (msgq->read_ptr == msgq->buffer_end) {
+		msgq->read_ptr = msgq->buffer_start;
+	}
+	if (chunk < len) {
+		/* wrap-around */
+		(void)memcpy(data + chunk, msgq->read_ptr, len - chunk);
+		msgq->read_ptr += len - chunk;
+	}
+	msgq->used_msgs -= num_msgs;
+}
+
+int z_impl_k_msgq_put_many(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+			   k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	const char *msg = data;
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t count = 0U;
+	uint32_t num_free;
+	int result;
+	bool resched = false;
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_many, msgq, timeout);
+
+	/* threads waiting to read only exist while the queue is empty */
+	while ((count < num_msgs) && (msgq->used_msgs < msgq->max_msgs)) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		/* give message to waiting thread */
+		(void)memcpy(pending_thread->base.swap_data, msg, msgq->msg_size);
+		msg += msgq->msg_size;
+		count++;
+
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		resched = true;
+	}
+
+	/* put what is left in the ring buffer */
+	num_free = msgq->max_msgs - msgq->used_msgs;
+	if ((count < num_msgs) && (num_free > 0U)) {
+		num_free = MIN(num_free, num_msgs - count);
+		msgq_ring_put(msgq, msg, num_free);
+		count += num_free;
+		resched = handle_poll_events(msgq) || resched;
+	}
+
+	if ((count > 0U) || (num_msgs == 0U)) {
+		result = (int)count;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for message space to become available */
+		result = -ENOMSG;
+	} else {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put_many, msgq, timeout);
+
+		/* wait for room for the first message, as k_msgq_put() does */
+		_current->base.swap_data = (void *)data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if (result == 0) {
+			result = 1;
+		}
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_many, msgq, timeout, result);
+		return result;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_many, msgq, timeout, result);
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_many(struct k_msgq *msgq, const void *data,
+					 uint32_t num_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_READ(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_put_many(msgq, data, num_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_put_many_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_k_msgq_get_many(struct k_msgq *msgq, void *data, uint32_t num_msgs,
+			   k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t count;
+	int result;
+	bool resched = false;
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get_many, msgq, timeout);
+
+	count = MIN(num_msgs, msgq->used_msgs);
+	if (count > 0U) {
+		/* take the first available messages from queue */
+		msgq_ring_get(msgq, data, count);
+
+		/* refill the room from threads waiting to write (if any) */
+		while (msgq->used_msgs < msgq->max_msgs) {
+			pending_thread = z_unpend_first_thread(&msgq->wait_q);
+			if (pending_thread == NULL) {
+				break;
+			}
+
+			msgq_ring_put(msgq, pending_thread->base.swap_data, 1U);
+
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			resched = true;
+		}
+		result = (int)count;
+	} else if ((num_msgs == 0U) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for a message to become available */
+		result = (num_msgs == 0U) ? 0 : -ENOMSG;
+	} else {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get_many, msgq, timeout);
+
+		/* wait for the first message, as k_msgq_get() does */
+		_current->base.swap_data = data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		if (result == 0) {
+			result = 1;
+		}
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_many, msgq, timeout, result);
+		return result;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_many, msgq, timeout, result);
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_many(struct k_msgq *msgq, void *data,
+					 uint32_t num_msgs, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_get_many(msgq, data, num_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_get_many_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
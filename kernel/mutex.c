@@ -102,11 +102,68 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+/* Wait for a locked mutex to be unlocked by spinning instead of pending,
+ * which is cheaper when the owner is running on another CPU and unlocks it
+ * soon. Give up once the owner stops running, another thread pends on the
+ * mutex (the owner then hands it over to that thread) or the spinning time
+ * is exhausted. Priority inheritance only matters when the owner is not
+ * running, so it is left to the pending path.
+ *
+ * Spinning must not outlast @p timeout, so the mutex is not spun on if the
+ * timeout expires before the spinning time does.
+ *
+ * Called with the lock held, which is released while spinning.
+ *
+ * @return the time left to pend on the mutex.
+ */
+static k_timeout_t mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key,
+			      k_timeout_t timeout)
+{
+	uint32_t start = k_cycle_get_32();
+	uint32_t limit = k_us_to_cyc_ceil32(CONFIG_MUTEX_ADAPTIVE_SPIN_US);
+	struct k_thread *owner = mutex->owner;
+	k_timepoint_t end;
+
+	if ((mutex->lock_count == 0U) || (owner == _current)) {
+		return timeout;
+	}
+
+	end = sys_timepoint_calc(timeout);
+	if (!K_TIMEOUT_EQ(timeout, K_FOREVER) &&
+	    (k_ticks_to_cyc_floor64(sys_timepoint_timeout(end).ticks) < limit)) {
+		return timeout;
+	}
+
+	while ((mutex->lock_count != 0U) && (owner != _current) &&
+	       (z_waitq_head(&mutex->wait_q) == NULL) &&
+	       z_thread_active_elsewhere(owner) &&
+	       ((k_cycle_get_32() - start) < limit)) {
+		k_spin_unlock(&lock, *key);
+
+		/* Leave the lock to the owner, it needs it to unlock */
+		while ((*(struct k_thread *volatile *)&mutex->owner == owner) &&
+		       ((k_cycle_get_32() - start) < limit)) {
+			unsigned int k = arch_irq_lock();
+
+			arch_spin_relax();
+			arch_irq_unlock(k);
+		}
+
+		*key = k_spin_lock(&lock);
+		owner = mutex->owner;
+	}
+
+	return sys_timepoint_timeout(end);
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
 	k_spinlock_key_t key;
 	bool resched = false;
+	k_timeout_t pend_timeout = timeout;
 
 	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
 
@@ -114,6 +171,12 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		pend_timeout = mutex_spin(mutex, &key, timeout);
+	}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
@@ -153,7 +216,7 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		resched = adjust_owner_prio(mutex, new_prio);
 	}
 
-	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, timeout);
+	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, pend_timeout);
 
 	LOG_DBG("on mutex %p got_mutex value: %d", mutex, got_mutex);
 
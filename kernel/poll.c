@@ -35,10 +35,11 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+static int signal_poll_set(struct k_poll_event *event, uint32_t state);
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -90,6 +91,13 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 	case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
 		*state = K_POLL_STATE_PIPE_DATA_AVAILABLE;
 		return true;
+	case K_POLL_TYPE_CHAN_DATA_AVAILABLE:
+		if (z_chan_poll_check(event->chan)) {
+			z_chan_poll_done(event->chan);
+			*state = K_POLL_STATE_CHAN_DATA_AVAILABLE;
+			return true;
+		}
+		break;
 	case K_POLL_TYPE_IGNORE:
 		break;
 	default:
@@ -111,7 +119,8 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 	struct k_poll_event *pending;
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
-	if ((pending == NULL) ||
+	if ((pending == NULL) || (poller->mode == MODE_SET) ||
+		(pending->poller->mode == MODE_SET) ||
 		(z_sched_prio_cmp(poller_thread(pending->poller),
 							   poller_thread(poller)) > 0)) {
 		sys_dlist_append(events, &event->_node);
@@ -119,8 +128,10 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		/* poll sets have no priority, threads queue up behind them */
+		if ((pending->poller->mode != MODE_SET) &&
+		    (z_sched_prio_cmp(poller_thread(poller),
+					poller_thread(pending->poller)) > 0)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -154,6 +165,10 @@ static inline void register_event(struct k_poll_event *event,
 		__ASSERT(event->pipe != NULL, "invalid pipe\n");
 		add_event(&event->pipe->poll_events, event, poller);
 		break;
+	case K_POLL_TYPE_CHAN_DATA_AVAILABLE:
+		__ASSERT(event->chan != NULL, "invalid channel\n");
+		add_event(&event->chan->poll_events, event, poller);
+		break;
 	case K_POLL_TYPE_IGNORE:
 		/* nothing to do */
 		break;
@@ -193,6 +208,13 @@ static inline void clear_event_registration(struct k_poll_event *event)
 		__ASSERT(event->pipe != NULL, "invalid pipe\n");
 		remove_event = true;
 		break;
+	case K_POLL_TYPE_CHAN_DATA_AVAILABLE:
+		__ASSERT(event->chan != NULL, "invalid channel\n");
+		if (sys_dnode_is_linked(&event->_node)) {
+			sys_dlist_remove(&event->_node);
+		}
+		z_chan_poll_done(event->chan);
+		break;
 	case K_POLL_TYPE_IGNORE:
 		/* nothing to do */
 		break;
@@ -408,6 +430,9 @@ static inline int z_vrfy_k_poll(struct k_poll_event *events,
 		case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
 			K_OOPS(K_SYSCALL_OBJ(e->pipe, K_OBJ_PIPE));
 			break;
+		case K_POLL_TYPE_CHAN_DATA_AVAILABLE:
+			K_OOPS(K_SYSCALL_OBJ(e->chan, K_OBJ_CHAN));
+			break;
 		default:
 			ret = -EINVAL;
 			goto out_free;
@@ -438,6 +463,8 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
 			retcode = signal_triggered_work(event, state);
+		} else if (poller->mode == MODE_SET) {
+			retcode = signal_poll_set(event, state);
 		} else {
 			/* Poller is not poll or triggered mode. No action needed.*/
 			;
@@ -559,6 +586,153 @@ static inline void z_vrfy_k_poll_signal_reset(struct k_poll_signal *sig)
 
 #endif /* CONFIG_USERSPACE */
 
+static struct k_poll_set *poller_set(struct z_poller *p)
+{
+	return CONTAINER_OF(p, struct k_poll_set, poller);
+}
+
+/* must be called with interrupts locked, returns true if a waiter was woken */
+static bool poll_set_wake(struct k_poll_set *set)
+{
+	struct k_thread *thread = z_unpend_first_thread(&set->wait_q);
+
+	if (thread == NULL) {
+		return false;
+	}
+
+	arch_thread_return_value_set(thread, 0);
+	z_ready_thread(thread);
+
+	return true;
+}
+
+/* must be called with interrupts locked, the event is off its object list */
+static int signal_poll_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set = poller_set(event->poller);
+
+	ARG_UNUSED(state);
+
+	sys_dlist_append(&set->ready, &event->_node);
+	(void)poll_set_wake(set);
+
+	return 0;
+}
+
+/* must be called with interrupts locked, returns true if the event is ready */
+static bool poll_set_arm(struct k_poll_set *set, struct k_poll_event *event)
+{
+	uint32_t state;
+
+	event->state = K_POLL_STATE_NOT_READY;
+
+	if (!is_condition_met(event, &state)) {
+		register_event(event, &set->poller);
+		return false;
+	}
+
+	set_event_ready(event, state);
+	sys_dlist_append(&set->ready, &event->_node);
+
+	return true;
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->ready);
+	sys_dlist_init(&set->rearm);
+	z_waitq_init(&set->wait_q);
+}
+
+void k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	__ASSERT(event->mode == K_POLL_MODE_NOTIFY_ONLY,
+		 "only NOTIFY_ONLY mode is supported\n");
+
+	sys_dnode_init(&event->_node);
+
+	if (poll_set_arm(set, event) && poll_set_wake(set)) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+}
+
+void k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	ARG_UNUSED(set);
+
+	/* registered with its object, ready or waiting to be re-armed */
+	if (sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_remove(&event->_node);
+	}
+	event->poller = NULL;
+
+	if (event->type == K_POLL_TYPE_CHAN_DATA_AVAILABLE) {
+		z_chan_poll_done(event->chan);
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events, int num_events,
+		    k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct k_poll_event *event;
+	k_spinlock_key_t key;
+	int count = 0;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(num_events > 0, "no room for events\n");
+
+	key = k_spin_lock(&lock);
+
+	/* only the events returned last time need checking again */
+	while ((event = (struct k_poll_event *)sys_dlist_get(&set->rearm)) != NULL) {
+		(void)poll_set_arm(set, event);
+	}
+
+	while (sys_dlist_is_empty(&set->ready)) {
+		int swap_rc;
+
+		timeout = sys_timepoint_timeout(end);
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EAGAIN;
+		}
+
+		/* another waiter may have collected the events that woke us */
+		swap_rc = z_pend_curr(&lock, key, &set->wait_q, timeout);
+		if (swap_rc != 0) {
+			return swap_rc;
+		}
+
+		key = k_spin_lock(&lock);
+	}
+
+	while ((count < num_events) &&
+	       ((event = (struct k_poll_event *)sys_dlist_get(&set->ready)) != NULL)) {
+		sys_dlist_append(&set->rearm, &event->_node);
+		events[count++] = event;
+	}
+
+	/* hand what is left over to the next waiter */
+	if (!sys_dlist_is_empty(&set->ready) && poll_set_wake(set)) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return count;
+}
+
 static void triggered_work_handler(struct k_work *work)
 {
 	struct k_work_poll *twork =
@@ -369,6 +369,52 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 	return (ret != 0) ? NULL : _current->base.swap_data;
 }
 
+uint32_t z_impl_k_queue_get_many(struct k_queue *queue, void **items, uint32_t max_items,
+				 k_timeout_t timeout)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	uint32_t count = 0U;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, get_many, queue, timeout);
+
+	while ((count < max_items) && !sys_sflist_is_empty(&queue->data_q)) {
+		sys_sfnode_t *node;
+
+		node = sys_sflist_get_not_empty(&queue->data_q);
+		items[count++] = z_queue_node_peek(node, true);
+	}
+
+	if ((count > 0U) || (max_items == 0U)) {
+		k_spin_unlock(&queue->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get_many, queue, timeout, count);
+
+		return count;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_queue, get_many, queue, timeout);
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&queue->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get_many, queue, timeout, 0U);
+
+		return 0U;
+	}
+
+	int ret = z_pend_curr(&queue->lock, key, &queue->wait_q, timeout);
+
+	/* a cancelled wait hands over no data */
+	if ((ret == 0) && (_current->base.swap_data != NULL)) {
+		items[0] = _current->base.swap_data;
+		count = 1U;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_queue, get_many, queue, timeout, count);
+
+	return count;
+}
+
 bool k_queue_remove(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, remove, queue);
@@ -428,6 +474,16 @@ static inline void *z_vrfy_k_queue_get(struct k_queue *queue,
 }
 #include <zephyr/syscalls/k_queue_get_mrsh.c>
 
+static inline uint32_t z_vrfy_k_queue_get_many(struct k_queue *queue, void **items,
+					       uint32_t max_items, k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(items, max_items, sizeof(void *)));
+
+	return z_impl_k_queue_get_many(queue, items, max_items, timeout);
+}
+#include <zephyr/syscalls/k_queue_get_many_mrsh.c>
+
 static inline int z_vrfy_k_queue_is_empty(struct k_queue *queue)
 {
 	K_OOPS(K_SYSCALL_OBJ(queue, K_OBJ_QUEUE));
@@ -17,6 +17,13 @@
 static K_KERNEL_STACK_DEFINE(sys_work_q_stack,
 			     CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
 
+#if defined(CONFIG_SYSTEM_WORKQUEUE_WORKERS) && (CONFIG_SYSTEM_WORKQUEUE_WORKERS > 0)
+static K_KERNEL_STACK_ARRAY_DEFINE(sys_work_q_worker_stacks,
+				   CONFIG_SYSTEM_WORKQUEUE_WORKERS,
+				   CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE);
+static struct k_work_q_worker sys_work_q_workers[CONFIG_SYSTEM_WORKQUEUE_WORKERS];
+#endif
+
 struct k_work_q k_sys_work_q;
 
 static int k_sys_work_q_init(void)
@@ -31,6 +38,16 @@ static int k_sys_work_q_init(void)
 			    sys_work_q_stack,
 			    K_KERNEL_STACK_SIZEOF(sys_work_q_stack),
 			    CONFIG_SYSTEM_WORKQUEUE_PRIORITY, &cfg);
+
+#if defined(CONFIG_SYSTEM_WORKQUEUE_WORKERS) && (CONFIG_SYSTEM_WORKQUEUE_WORKERS > 0)
+	for (int i = 0; i < CONFIG_SYSTEM_WORKQUEUE_WORKERS; i++) {
+		k_work_queue_add_worker(&k_sys_work_q, &sys_work_q_workers[i],
+					sys_work_q_worker_stacks[i],
+					K_KERNEL_STACK_SIZEOF(sys_work_q_worker_stacks[i]),
+					(i + 1) % arch_num_cpus());
+	}
+#endif
+
 	return 0;
 }
 
@@ -14,7 +14,9 @@
 
 static uint64_t curr_tick;
 
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
@@ -40,6 +42,221 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+/*
+ * Hierarchical timing wheel.
+ *
+ * Level N has WHEEL_SLOTS slots, each spanning WHEEL_SLOTS^N ticks. A
+ * timeout expiring at tick E lives on level N when E and curr_tick agree
+ * on every bit above the first (N + 1) * WHEEL_BITS, i.e. N is the most
+ * significant base-WHEEL_SLOTS digit in which they differ, and in the slot
+ * given by that digit of E. Everything on level N therefore expires before
+ * anything on level N + 1, and slots within a level are ordered by expiry.
+ * The dticks field holds the absolute expiry tick instead of a delta.
+ *
+ * Once curr_tick enters a slot of level N > 0, the slot is cascaded down
+ * to where its entries now belong. This is done lazily, when the earliest
+ * timeout has to be looked up again, from the lowest level up: entries
+ * moved down are prepended to their new slot, as they were necessarily
+ * armed before anything already sitting there, and those coming from
+ * higher levels before those from lower ones. Timeouts sharing an expiry
+ * tick always share a slot and keep firing in the order they were armed.
+ *
+ * The earliest timeout is cached in wheel_head. Finding it again after it
+ * fires or is aborted takes a scan of at most one slot, everything else
+ * is O(1).
+ */
+#define WHEEL_BITS   5U
+#define WHEEL_SLOTS  BIT(WHEEL_BITS)
+#define WHEEL_MASK   (WHEEL_SLOTS - 1U)
+#define WHEEL_LEVELS CONFIG_TIMEOUT_WHEEL_LEVELS
+#define WHEEL_SHIFT(lvl) ((lvl) * WHEEL_BITS)
+
+/* Slot lists are only valid while their occupancy bit is set: a list is
+ * initialized when its bit gets set, and the bit is lazily cleared when
+ * a scan finds the list empty.
+ */
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint32_t wheel_occupied[WHEEL_LEVELS];
+
+/* Timeouts beyond the span of the top level, rehashed when it wraps */
+static sys_dlist_t wheel_overflow = SYS_DLIST_STATIC_INIT(&wheel_overflow);
+static uint64_t overflow_epoch;
+
+static struct _timeout *wheel_head;
+static bool wheel_head_valid = true;
+
+static uint64_t expiry(const struct _timeout *t)
+{
+#ifdef CONFIG_TIMEOUT_64BIT
+	return (uint64_t)t->dticks;
+#else
+	/* Only the low 32 bits fit, but a pending timeout never lies more
+	 * than INT32_MAX ticks past curr_tick.
+	 */
+	return curr_tick + (uint32_t)((uint32_t)t->dticks - (uint32_t)curr_tick);
+#endif /* CONFIG_TIMEOUT_64BIT */
+}
+
+static void wheel_insert(struct _timeout *t, uint64_t when, bool prepend)
+{
+	sys_dlist_t *list = &wheel_overflow;
+
+	for (unsigned int lvl = 0; lvl < WHEEL_LEVELS; lvl++) {
+		unsigned int shift = WHEEL_SHIFT(lvl + 1U);
+
+		if ((when >> shift) == (curr_tick >> shift)) {
+			unsigned int slot = (when >> WHEEL_SHIFT(lvl)) & WHEEL_MASK;
+
+			list = &wheel[lvl][slot];
+			if ((wheel_occupied[lvl] & BIT(slot)) == 0U) {
+				sys_dlist_init(list);
+				wheel_occupied[lvl] |= BIT(slot);
+			}
+			break;
+		}
+	}
+
+	if (prepend) {
+		sys_dlist_prepend(list, &t->node);
+	} else {
+		sys_dlist_append(list, &t->node);
+	}
+}
+
+/* Moves every entry of @list back into the wheel, keeping their order */
+static void wheel_reinsert(sys_dlist_t *list)
+{
+	sys_dnode_t *n;
+
+	while ((n = sys_dlist_peek_tail(list)) != NULL) {
+		struct _timeout *t = CONTAINER_OF(n, struct _timeout, node);
+
+		sys_dlist_remove(n);
+		wheel_insert(t, expiry(t), true);
+	}
+}
+
+/* Returns the first non-empty slot of @lvl at or after the current one */
+static sys_dlist_t *wheel_next_slot(unsigned int lvl)
+{
+	unsigned int cur = (curr_tick >> WHEEL_SHIFT(lvl)) & WHEEL_MASK;
+
+	while (wheel_occupied[lvl] != 0U) {
+		uint32_t occ = wheel_occupied[lvl];
+		uint32_t rot = (cur == 0U) ? occ :
+			((occ >> cur) | (occ << (WHEEL_SLOTS - cur)));
+		unsigned int slot = (cur + find_lsb_set(rot) - 1U) & WHEEL_MASK;
+
+		if (!sys_dlist_is_empty(&wheel[lvl][slot])) {
+			return &wheel[lvl][slot];
+		}
+		wheel_occupied[lvl] &= ~BIT(slot);
+	}
+
+	return NULL;
+}
+
+static struct _timeout *first(void)
+{
+	struct _timeout *head = NULL;
+	struct _timeout *t;
+	sys_dlist_t *list = NULL;
+	unsigned int lvl;
+
+	if (wheel_head_valid) {
+		return wheel_head;
+	}
+
+	/* An entry never moves down into the current slot of a level above
+	 * 0, so a single pass is enough.
+	 */
+	for (lvl = 1; lvl < WHEEL_LEVELS; lvl++) {
+		unsigned int cur = (curr_tick >> WHEEL_SHIFT(lvl)) & WHEEL_MASK;
+
+		if ((wheel_occupied[lvl] & BIT(cur)) != 0U) {
+			wheel_reinsert(&wheel[lvl][cur]);
+			wheel_occupied[lvl] &= ~BIT(cur);
+		}
+	}
+
+	if ((curr_tick >> WHEEL_SHIFT(WHEEL_LEVELS)) != overflow_epoch) {
+		sys_dlist_t pending = SYS_DLIST_STATIC_INIT(&pending);
+		sys_dnode_t *n;
+
+		/* Some entries may well land back on the overflow list */
+		while ((n = sys_dlist_get(&wheel_overflow)) != NULL) {
+			sys_dlist_append(&pending, n);
+		}
+
+		overflow_epoch = curr_tick >> WHEEL_SHIFT(WHEEL_LEVELS);
+		wheel_reinsert(&pending);
+	}
+
+	for (lvl = 0; (lvl < WHEEL_LEVELS) && (list == NULL); lvl++) {
+		list = wheel_next_slot(lvl);
+	}
+
+	if (list == NULL) {
+		list = &wheel_overflow;
+	}
+
+	if ((lvl == 1U) && (list != &wheel_overflow)) {
+		/* Level 0 slots hold a single expiry tick */
+		head = SYS_DLIST_PEEK_HEAD_CONTAINER(list, t, node);
+	} else {
+		SYS_DLIST_FOR_EACH_CONTAINER(list, t, node) {
+			if ((head == NULL) || (expiry(t) < expiry(head))) {
+				head = t;
+			}
+		}
+	}
+
+	wheel_head = head;
+	wheel_head_valid = true;
+
+	return head;
+}
+
+/* Ticks from curr_tick until @t expires */
+static k_ticks_t ticks_until(const struct _timeout *t)
+{
+	return (k_ticks_t)(expiry(t) - curr_tick);
+}
+
+/* to->dticks holds the delay relative to curr_tick on entry */
+static void insert_timeout(struct _timeout *to)
+{
+	uint64_t when = curr_tick + to->dticks;
+
+	to->dticks = when;
+	wheel_insert(to, when, false);
+
+	if (wheel_head_valid &&
+	    ((wheel_head == NULL) || (when < expiry(wheel_head)))) {
+		wheel_head = to;
+	}
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	if (t == wheel_head) {
+		wheel_head = NULL;
+		wheel_head_valid = false;
+	}
+
+	sys_dlist_remove(&t->node);
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	return ticks_until(timeout);
+}
+
+#else
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -54,6 +271,31 @@ static struct _timeout *next(struct _timeout *t)
 	return (n == NULL) ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
+/* Ticks from curr_tick until @t expires, @t must be first() */
+static k_ticks_t ticks_until(const struct _timeout *t)
+{
+	return t->dticks;
+}
+
+/* to->dticks holds the delay relative to curr_tick on entry */
+static void insert_timeout(struct _timeout *to)
+{
+	struct _timeout *t;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+}
+
 static void remove_timeout(struct _timeout *t)
 {
 	if (next(t) != NULL) {
@@ -63,6 +305,23 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -91,10 +350,10 @@ static int32_t next_timeout(void)
 	int32_t ret;
 
 	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	    ((int64_t)(ticks_until(to) - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, ticks_until(to) - ticks_elapsed);
 	}
 
 	return ret;
@@ -115,8 +374,6 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
-
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    (Z_TICK_ABS(timeout.ticks) >= 0)) {
 			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
@@ -126,18 +383,7 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			to->dticks = timeout.ticks + 1 + elapsed();
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
-
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
+		insert_timeout(to);
 
 		if (to == first() && announce_remaining == 0) {
 			sys_clock_set_timeout(next_timeout(), false);
@@ -164,21 +410,6 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
-}
-
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
@@ -237,9 +468,9 @@ void sys_clock_announce(int32_t ticks)
 	struct _timeout *t;
 
 	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
+	     (t != NULL) && (ticks_until(t) <= announce_remaining);
 	     t = first()) {
-		int dt = t->dticks;
+		int dt = ticks_until(t);
 
 		curr_tick += dt;
 		t->dticks = 0;
@@ -251,7 +482,8 @@ void sys_clock_announce(int32_t ticks)
 		announce_remaining -= dt;
 	}
 
-	if (t != NULL) {
+	/* Delta list heads are relative to curr_tick, rebase it */
+	if (!IS_ENABLED(CONFIG_TIMEOUT_QUEUE_WHEEL) && (t != NULL)) {
 		t->dticks -= announce_remaining;
 	}
 
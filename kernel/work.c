@@ -76,6 +76,11 @@ static inline void init_flusher(struct z_work_flusher *flusher)
 /* List of pending cancellations. */
 static sys_slist_t pending_cancels;
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/* List of pending flushes of work items on queues with workers. */
+static sys_slist_t pending_flushes;
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /* Initialize a canceler record and add it to the list of pending
  * cancels.
  *
@@ -147,6 +152,181 @@ static void finalize_cancel_locked(struct k_work *work)
 	}
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+static inline bool queue_is_pool(struct k_work_q *queue)
+{
+	return !sys_slist_is_empty(&queue->workers);
+}
+
+/* Find the list of work items of the current thread.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue the current thread may belong to
+ *
+ * @return the list of the current thread, or NULL if it isn't one of the
+ * threads of @p queue.
+ */
+static sys_slist_t *pool_current_pending(struct k_work_q *queue)
+{
+	struct k_work_q_worker *worker;
+
+	if (_current == &queue->thread) {
+		return &queue->pending;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (_current == &worker->thread) {
+			return &worker->pending;
+		}
+	}
+
+	return NULL;
+}
+
+/* Select the list a work item submitted to a pool goes to.
+ *
+ * Work submitted from a thread of the pool stays with that thread, other
+ * work is handed to the threads in turn.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to which work is submitted
+ * @param chained true if the submission comes from a thread of @p queue
+ */
+static sys_slist_t *pool_submit_pending(struct k_work_q *queue, bool chained)
+{
+	struct k_work_q_worker *worker = queue->next;
+
+	if (chained) {
+		return pool_current_pending(queue);
+	}
+
+	if (worker == NULL) {
+		queue->next = SYS_SLIST_PEEK_HEAD_CONTAINER(&queue->workers, worker, node);
+		return &queue->pending;
+	}
+
+	queue->next = SYS_SLIST_PEEK_NEXT_CONTAINER(worker, node);
+
+	return &worker->pending;
+}
+
+/* Take the first work item that isn't running from a list.
+ *
+ * A work item submitted again while it runs is left where it is until the
+ * thread running it completes, so a handler never runs concurrently with
+ * itself.
+ *
+ * Invoked with work lock held.
+ */
+static struct k_work *pending_get_locked(sys_slist_t *pending)
+{
+	struct k_work *work;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(pending, work, node) {
+		if (!flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+			sys_slist_remove(pending, prev, &work->node);
+			return work;
+		}
+		prev = &work->node;
+	}
+
+	return NULL;
+}
+
+/* Take the next work item for a thread of a pool, stealing it from the
+ * other threads of the pool if the thread has nothing left.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue the thread belongs to
+ * @param pending the list of work items of the thread
+ */
+static struct k_work *pool_get_locked(struct k_work_q *queue,
+				      sys_slist_t *pending)
+{
+	struct k_work_q_worker *worker;
+	struct k_work *work = pending_get_locked(pending);
+
+	if ((work == NULL) && (pending != &queue->pending)) {
+		work = pending_get_locked(&queue->pending);
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (work != NULL) {
+			break;
+		}
+		if (&worker->pending != pending) {
+			work = pending_get_locked(&worker->pending);
+		}
+	}
+
+	return work;
+}
+
+/* Release the flushers waiting for a work item.
+ *
+ * Invoked with work lock held.
+ *
+ * Reschedules.
+ *
+ * @param work the work item
+ * @param ran true if @p work completed a run, false if a queued instance
+ * of it was removed
+ */
+static void pool_flush_update_locked(struct k_work *work, bool ran)
+{
+	struct z_work_flusher *flusher, *tmp;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&pending_flushes, flusher, tmp, work.node) {
+		uint32_t *flagp = &flusher->work.flags;
+
+		if (flusher->target != work) {
+			prev = &flusher->work.node;
+			continue;
+		}
+
+		/* The instance running when the flush started completes
+		 * before the queued one can run.
+		 */
+		if (!ran || !flag_test_and_clear(flagp, K_WORK_RUNNING_BIT)) {
+			flag_clear(flagp, K_WORK_QUEUED_BIT);
+		}
+
+		if ((flags_get(flagp) & (K_WORK_QUEUED | K_WORK_RUNNING)) != 0U) {
+			prev = &flusher->work.node;
+			continue;
+		}
+
+		sys_slist_remove(&pending_flushes, prev, &flusher->work.node);
+		finalize_flush_locked(&flusher->work);
+	}
+}
+
+/* Remove a queued work item from the list of the pool thread holding it.
+ *
+ * Invoked with work lock held.
+ */
+static void pool_remove_locked(struct k_work_q *queue,
+			       struct k_work *work)
+{
+	struct k_work_q_worker *worker;
+
+	if (!sys_slist_find_and_remove(&queue->pending, &work->node)) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+			if (sys_slist_find_and_remove(&worker->pending, &work->node)) {
+				break;
+			}
+		}
+	}
+
+	pool_flush_update_locked(work, false);
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 void k_work_init(struct k_work *work,
 		  k_work_handler_t handler)
 {
@@ -190,6 +370,19 @@ static void queue_flusher_locked(struct k_work_q *queue,
 {
 	init_flusher(flusher);
 
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Another thread of a pool could process the flusher before the work
+	 * completes, so track the instances of the work instead.
+	 */
+	if (queue_is_pool(queue)) {
+		flusher->target = work;
+		flusher->work.flags |= flags_get(&work->flags)
+				       & (K_WORK_QUEUED | K_WORK_RUNNING);
+		sys_slist_append(&pending_flushes, &flusher->work.node);
+		return;
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 	if ((flags_get(&work->flags) & K_WORK_QUEUED) != 0U) {
 		sys_slist_insert(&queue->pending, &work->node,
 				 &flusher->work.node);
@@ -209,10 +402,81 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 				       struct k_work *work)
 {
 	if (flag_test_and_clear(&work->flags, K_WORK_QUEUED_BIT)) {
+#ifdef CONFIG_WORKQUEUE_POOL
+		if (queue_is_pool(queue)) {
+			pool_remove_locked(queue, work);
+			return;
+		}
+#endif /* CONFIG_WORKQUEUE_POOL */
 		(void)sys_slist_find_and_remove(&queue->pending, &work->node);
 	}
 }
 
+/* Check whether any work item is waiting on a queue.
+ *
+ * Invoked with work lock held.
+ */
+static bool queue_has_pending_locked(struct k_work_q *queue)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	struct k_work_q_worker *worker;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (!sys_slist_is_empty(&worker->pending)) {
+			return true;
+		}
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	return !sys_slist_is_empty(&queue->pending);
+}
+
+/* Take the next work item to be processed by a queue thread.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue the thread belongs to
+ * @param pending the list of work items of the thread
+ */
+static struct k_work *queue_get_locked(struct k_work_q *queue,
+				       sys_slist_t *pending)
+{
+	sys_snode_t *node;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	if (queue_is_pool(queue)) {
+		return pool_get_locked(queue, pending);
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	node = sys_slist_get(pending);
+
+	return (node != NULL) ? CONTAINER_OF(node, struct k_work, node) : NULL;
+}
+
+/* Account for a work item starting or completing on a queue, keeping
+ * K_WORK_QUEUE_BUSY set while any work item is being processed.
+ *
+ * Invoked with work lock held.
+ */
+static inline void queue_running_locked(struct k_work_q *queue, bool start)
+{
+#ifdef CONFIG_WORKQUEUE_POOL
+	if (start) {
+		queue->running++;
+	} else {
+		queue->running--;
+	}
+	start = (queue->running != 0U);
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	if (start) {
+		flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	} else {
+		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	}
+}
+
 /* Potentially notify a queue that it needs to look for pending work.
  *
  * This may make the work queue thread ready, but as the lock is held it
@@ -262,7 +526,11 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret;
+#ifdef CONFIG_WORKQUEUE_POOL
+	bool chained = (pool_current_pending(queue) != NULL) && !k_is_in_isr();
+#else
 	bool chained = (_current == &queue->thread) && !k_is_in_isr();
+#endif /* CONFIG_WORKQUEUE_POOL */
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -280,7 +548,15 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	} else if (plugged && !draining) {
 		ret = -EBUSY;
 	} else {
-		sys_slist_append(&queue->pending, &work->node);
+		sys_slist_t *pending = &queue->pending;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+		if (queue_is_pool(queue)) {
+			pending = pool_submit_pending(queue, chained);
+		}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+		sys_slist_append(pending, &work->node);
 		ret = 1;
 		(void)notify_queue_locked(queue);
 	}
@@ -602,46 +878,34 @@ bool k_work_cancel_sync(struct k_work *work,
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
+ * @param pending_ptr pointer to the list of work items of the thread
  */
-static void work_queue_main(void *workq_ptr, void *p2, void *p3)
+static void work_queue_main(void *workq_ptr, void *pending_ptr, void *p3)
 {
-	ARG_UNUSED(p2);
 	ARG_UNUSED(p3);
 
 	struct k_work_q *queue = (struct k_work_q *)workq_ptr;
+	sys_slist_t *pending = (sys_slist_t *)pending_ptr;
 
 	while (true) {
-		sys_snode_t *node;
-		struct k_work *work = NULL;
+		struct k_work *work;
 		k_work_handler_t handler = NULL;
 		k_spinlock_key_t key = k_spin_lock(&lock);
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
-		if (node != NULL) {
+		work = queue_get_locked(queue, pending);
+		if (work != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
-			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
-			work = CONTAINER_OF(node, struct k_work, node);
+			queue_running_locked(queue, true);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
 
-			/* Static code analysis tool can raise a false-positive violation
-			 * in the line below that 'work' is checked for null after being
-			 * dereferenced.
-			 *
-			 * The work is figured out by CONTAINER_OF, as a container
-			 * of type struct k_work that contains the node.
-			 * The only way for it to be NULL is if node would be a member
-			 * of struct k_work object that has been placed at address NULL,
-			 * which should never happen, even line 'if (work != NULL)'
-			 * ensures that.
-			 * This means that if node is not NULL, then work will not be NULL.
-			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
+		} else if (!flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT) &&
+			   flag_test_and_clear(&queue->flags,
 					       K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
@@ -656,6 +920,14 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		} else if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
 			/* User has requested that the queue stop. Clear the status flags and exit.
 			 */
+#ifdef CONFIG_WORKQUEUE_POOL
+			/* The last thread of a pool to exit does it */
+			queue->threads--;
+			if (queue->threads != 0U) {
+				k_spin_unlock(&lock, key);
+				return;
+			}
+#endif /* CONFIG_WORKQUEUE_POOL */
 			flags_set(&queue->flags, 0);
 			k_spin_unlock(&lock, key);
 			return;
@@ -697,8 +969,13 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		if (flag_test(&work->flags, K_WORK_CANCELING_BIT)) {
 			finalize_cancel_locked(work);
 		}
+#ifdef CONFIG_WORKQUEUE_POOL
+		if (queue_is_pool(queue)) {
+			pool_flush_update_locked(work, true);
+		}
+#endif /* CONFIG_WORKQUEUE_POOL */
 
-		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		queue_running_locked(queue, false);
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -739,6 +1016,13 @@ void k_work_queue_start(struct k_work_q *queue,
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
 
+#ifdef CONFIG_WORKQUEUE_POOL
+	sys_slist_init(&queue->workers);
+	queue->next = NULL;
+	queue->running = 0U;
+	queue->threads = 1U;
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
 	}
@@ -750,7 +1034,7 @@ void k_work_queue_start(struct k_work_q *queue,
 	flags_set(&queue->flags, flags);
 
 	(void)k_thread_create(&queue->thread, stack, stack_size,
-			      work_queue_main, queue, NULL, NULL,
+			      work_queue_main, queue, &queue->pending, NULL,
 			      prio, 0, K_FOREVER);
 
 	if ((cfg != NULL) && (cfg->name != NULL)) {
@@ -766,6 +1050,47 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+void k_work_queue_add_worker(struct k_work_q *queue, struct k_work_q_worker *worker,
+			     k_thread_stack_t *stack, size_t stack_size, int cpu)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(worker);
+	__ASSERT_NO_MSG(stack);
+	__ASSERT_NO_MSG(flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	k_spinlock_key_t key;
+
+	sys_slist_init(&worker->pending);
+
+	(void)k_thread_create(&worker->thread, stack, stack_size,
+			      work_queue_main, queue, &worker->pending, NULL,
+			      k_thread_priority_get(&queue->thread), 0, K_FOREVER);
+
+	if (IS_ENABLED(CONFIG_THREAD_NAME)) {
+		(void)k_thread_name_set(&worker->thread,
+					k_thread_name_get(&queue->thread));
+	}
+
+	worker->thread.base.user_options |= queue->thread.base.user_options & K_ESSENTIAL;
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	if (cpu >= 0) {
+		(void)k_thread_cpu_pin(&worker->thread, cpu);
+	}
+#else
+	ARG_UNUSED(cpu);
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+	key = k_spin_lock(&lock);
+	sys_slist_append(&queue->workers, &worker->node);
+	queue->threads++;
+	k_spin_unlock(&lock, key);
+
+	k_thread_start(&worker->thread);
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -780,7 +1105,7 @@ int k_work_queue_drain(struct k_work_q *queue,
 	if (((flags_get(&queue->flags)
 	      & (K_WORK_QUEUE_BUSY | K_WORK_QUEUE_DRAIN)) != 0U)
 	    || plug
-	    || !sys_slist_is_empty(&queue->pending)) {
+	    || queue_has_pending_locked(queue)) {
 		flag_set(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 		if (plug) {
 			flag_set(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
@@ -838,10 +1163,26 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	}
 
 	flag_set(&queue->flags, K_WORK_QUEUE_STOP_BIT);
-	notify_queue_locked(queue);
+	(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
 	k_spin_unlock(&lock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
-	if (k_thread_join(&queue->thread, timeout)) {
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct k_work_q_worker *worker;
+#endif /* CONFIG_WORKQUEUE_POOL */
+	int ret = k_thread_join(&queue->thread, timeout);
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (ret != 0) {
+			break;
+		}
+		ret = k_thread_join(&worker->thread, sys_timepoint_timeout(end));
+	}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+	if (ret != 0) {
 		key = k_spin_lock(&lock);
 		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
 		k_spin_unlock(&lock, key);
@@ -26,6 +26,8 @@
 
 struct stat;
 
+void zvfs_epoll_fd_closed(int fd);
+
 struct fd_entry {
 	void *obj;
 	const struct fd_op_vtable *vtable;
@@ -392,6 +394,11 @@ int zvfs_close(int fd)
 		return -1;
 	}
 
+	if (IS_ENABLED(CONFIG_ZVFS_EPOLL)) {
+		/* no epoll instance may keep waiting on the object */
+		zvfs_epoll_fd_closed(fd);
+	}
+
 	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
 	if (fdtable[fd].vtable->close != NULL) {
 		/* close() is optional - e.g. stdinout_fd_op_vtable */
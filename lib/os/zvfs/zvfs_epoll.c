@@ -0,0 +1,479 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/zvfs/epoll.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/fdtable.h>
+
+#define ZVFS_EPOLL_EVENTS     (ZVFS_EPOLLIN | ZVFS_EPOLLPRI | ZVFS_EPOLLOUT)
+#define ZVFS_EPOLL_EVENTS_SET (ZVFS_EPOLL_EVENTS | ZVFS_EPOLLERR | ZVFS_EPOLLHUP)
+
+/* a TLS socket may wait for its handshake besides the events of its transport */
+#define ZVFS_EPOLL_FD_EVENTS 3
+
+struct zvfs_epoll_entry {
+	struct k_poll_event pev[ZVFS_EPOLL_FD_EVENTS];
+	struct zvfs_epoll_event event;
+	/* linked while the descriptor is ready without any event to wait for */
+	sys_dnode_t always_node;
+	uint32_t seq;
+	int num_pev;
+	int fd;
+};
+
+struct zvfs_epoll {
+	struct k_poll_set set;
+	struct k_mutex lock;
+	sys_dlist_t always;
+	uint32_t seq;
+	struct zvfs_epoll_entry entries[CONFIG_ZVFS_EPOLL_MAX_FDS];
+};
+
+SYS_BITARRAY_DEFINE_STATIC(epolls_bitarray, CONFIG_ZVFS_EPOLL_MAX);
+static struct zvfs_epoll epolls[CONFIG_ZVFS_EPOLL_MAX];
+static const struct fd_op_vtable zvfs_epoll_fd_vtable;
+
+static struct zvfs_epoll_entry *zvfs_epoll_entry_find(struct zvfs_epoll *ep, int fd)
+{
+	ARRAY_FOR_EACH_PTR(ep->entries, entry) {
+		if (entry->fd == fd) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static struct zvfs_epoll_entry *zvfs_epoll_entry_of(struct zvfs_epoll *ep,
+						    struct k_poll_event *pev)
+{
+	size_t idx = ((uintptr_t)pev - (uintptr_t)ep->entries) / sizeof(ep->entries[0]);
+
+	__ASSERT_NO_MSG(idx < ARRAY_SIZE(ep->entries));
+
+	return &ep->entries[idx];
+}
+
+/* must be called with the instance locked */
+static void zvfs_epoll_entry_disarm(struct zvfs_epoll *ep, struct zvfs_epoll_entry *entry)
+{
+	for (int i = 0; i < entry->num_pev; i++) {
+		k_poll_set_remove(&ep->set, &entry->pev[i]);
+	}
+	entry->num_pev = 0;
+
+	if (sys_dnode_is_linked(&entry->always_node)) {
+		sys_dlist_remove(&entry->always_node);
+	}
+}
+
+/* must be called with the instance locked */
+static int zvfs_epoll_entry_arm(struct zvfs_epoll *ep, struct zvfs_epoll_entry *entry)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = entry->fd,
+		.events = entry->event.events & ZVFS_EPOLL_EVENTS,
+	};
+	struct k_poll_event *pev = entry->pev;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *ctx;
+	int result;
+
+	zvfs_epoll_entry_disarm(ep, entry);
+
+	ctx = zvfs_get_fd_obj_and_vtable(entry->fd, &vtable, &lock);
+	if (ctx == NULL) {
+		return -EBADF;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	result = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_PREPARE, &pfd, &pev,
+					 entry->pev + ARRAY_SIZE(entry->pev));
+	k_mutex_unlock(lock);
+
+	if (result == -EXDEV) {
+		/* offloaded sockets can only be polled by their offload driver */
+		return -EPERM;
+	} else if (result == -1) {
+		/* descriptors other than sockets report their errors in errno */
+		return -errno;
+	} else if (result < 0 && result != -EALREADY) {
+		return result;
+	}
+
+	entry->num_pev = pev - entry->pev;
+	for (int i = 0; i < entry->num_pev; i++) {
+		k_poll_set_add(&ep->set, &entry->pev[i]);
+	}
+
+	/* e.g. a socket at EOF, checked on every wait until it no longer is */
+	if (result == -EALREADY) {
+		sys_dlist_append(&ep->always, &entry->always_node);
+	}
+
+	return 0;
+}
+
+/*
+ * Must be called with the instance locked. Fills @p out and returns 1 if the
+ * descriptor has events to report, the events of the descriptor are armed
+ * again in any case. Each descriptor is checked once per wait.
+ */
+static int zvfs_epoll_entry_report(struct zvfs_epoll *ep, struct zvfs_epoll_entry *entry,
+				   struct zvfs_epoll_event *out, uint32_t seq)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = entry->fd,
+		.events = entry->event.events & ZVFS_EPOLL_EVENTS,
+	};
+	struct k_poll_event *pev = entry->pev;
+	const struct fd_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *ctx;
+	int result;
+
+	if ((entry->fd < 0) || (entry->seq == seq)) {
+		return 0;
+	}
+
+	entry->seq = seq;
+
+	ctx = zvfs_get_fd_obj_and_vtable(entry->fd, &vtable, &lock);
+	if (ctx == NULL) {
+		pfd.revents = ZVFS_EPOLLERR;
+	} else {
+		(void)k_mutex_lock(lock, K_FOREVER);
+		result = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_UPDATE, &pfd, &pev);
+		k_mutex_unlock(lock);
+
+		if ((result != 0) && (result != -EAGAIN)) {
+			pfd.revents |= ZVFS_EPOLLERR;
+		}
+	}
+
+	/*
+	 * Prepare the descriptor again rather than letting the poll set re-arm
+	 * its events, the objects to wait for may change with its state.
+	 */
+	if (zvfs_epoll_entry_arm(ep, entry) < 0) {
+		pfd.revents |= ZVFS_EPOLLERR;
+	}
+
+	if (pfd.revents == 0) {
+		return 0;
+	}
+
+	out->events = pfd.revents;
+	out->data = entry->event.data;
+
+	return 1;
+}
+
+/* must be called with the instance locked */
+static int zvfs_epoll_report_always(struct zvfs_epoll *ep, struct zvfs_epoll_event *events,
+				    int maxevents, uint32_t seq)
+{
+	struct zvfs_epoll_entry *entry;
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+	int count = 0;
+
+	/* reporting an entry links it again if it is still always ready */
+	sys_dlist_init(&pending);
+	while ((node = sys_dlist_get(&ep->always)) != NULL) {
+		sys_dlist_append(&pending, node);
+	}
+
+	while ((count < maxevents) && ((node = sys_dlist_get(&pending)) != NULL)) {
+		entry = CONTAINER_OF(node, struct zvfs_epoll_entry, always_node);
+		count += zvfs_epoll_entry_report(ep, entry, &events[count], seq);
+	}
+
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		sys_dlist_append(&ep->always, node);
+	}
+
+	return count;
+}
+
+static ssize_t zvfs_epoll_rw_op(void *obj, const void *buf, size_t sz)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buf);
+	ARG_UNUSED(sz);
+
+	errno = EINVAL;
+	return -1;
+}
+
+static ssize_t zvfs_epoll_read_op(void *obj, void *buf, size_t sz)
+{
+	return zvfs_epoll_rw_op(obj, buf, sz);
+}
+
+static int zvfs_epoll_close_op(void *obj)
+{
+	struct zvfs_epoll *ep = (struct zvfs_epoll *)obj;
+	int err;
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	ARRAY_FOR_EACH_PTR(ep->entries, entry) {
+		if (entry->fd >= 0) {
+			zvfs_epoll_entry_disarm(ep, entry);
+			entry->fd = -1;
+		}
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	err = sys_bitarray_free(&epolls_bitarray, 1, ep - epolls);
+	__ASSERT(err == 0, "sys_bitarray_free() failed: %d", err);
+
+	return 0;
+}
+
+static int zvfs_epoll_ioctl_op(void *obj, unsigned int request, va_list args)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(request);
+	ARG_UNUSED(args);
+
+	/* in particular, an epoll instance cannot be polled itself */
+	errno = EOPNOTSUPP;
+	return -1;
+}
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable = {
+	.read = zvfs_epoll_read_op,
+	.write = zvfs_epoll_rw_op,
+	.close = zvfs_epoll_close_op,
+	.ioctl = zvfs_epoll_ioctl_op,
+};
+
+/* called by zvfs_close() before the object of the descriptor goes away */
+void zvfs_epoll_fd_closed(int fd)
+{
+	int bit;
+
+	ARRAY_FOR_EACH(epolls, i) {
+		struct zvfs_epoll *ep = &epolls[i];
+		struct zvfs_epoll_entry *entry;
+
+		if ((sys_bitarray_test_bit(&epolls_bitarray, i, &bit) < 0) || (bit == 0)) {
+			continue;
+		}
+
+		(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+		entry = zvfs_epoll_entry_find(ep, fd);
+		if (entry != NULL) {
+			zvfs_epoll_entry_disarm(ep, entry);
+			entry->fd = -1;
+		}
+
+		k_mutex_unlock(&ep->lock);
+	}
+}
+
+/*
+ * Public-facing API
+ */
+
+int zvfs_epoll_create(int flags)
+{
+	struct zvfs_epoll *ep;
+	size_t offset;
+	int fd;
+
+	if (flags != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (sys_bitarray_alloc(&epolls_bitarray, 1, &offset) < 0) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ep = &epolls[offset];
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		sys_bitarray_free(&epolls_bitarray, 1, offset);
+		return -1;
+	}
+
+	k_poll_set_init(&ep->set);
+	k_mutex_init(&ep->lock);
+	sys_dlist_init(&ep->always);
+	ep->seq = 0;
+
+	ARRAY_FOR_EACH_PTR(ep->entries, entry) {
+		entry->fd = -1;
+		entry->num_pev = 0;
+		sys_dnode_init(&entry->always_node);
+	}
+
+	zvfs_finalize_fd(fd, ep, &zvfs_epoll_fd_vtable);
+
+	return fd;
+}
+
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *event)
+{
+	struct zvfs_epoll_entry *entry;
+	struct zvfs_epoll *ep;
+	int ret = 0;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if ((fd < 0) || (fd == epfd)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (op != ZVFS_EPOLL_CTL_DEL) {
+		if (event == NULL) {
+			errno = EFAULT;
+			return -1;
+		}
+
+		/* only level-triggered events are supported */
+		if ((event->events & ~ZVFS_EPOLL_EVENTS_SET) != 0) {
+			errno = EINVAL;
+			return -1;
+		}
+	}
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	entry = zvfs_epoll_entry_find(ep, fd);
+
+	switch (op) {
+	case ZVFS_EPOLL_CTL_ADD:
+		if (entry != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		entry = zvfs_epoll_entry_find(ep, -1);
+		if (entry == NULL) {
+			ret = -ENOSPC;
+			break;
+		}
+
+		entry->fd = fd;
+		entry->event = *event;
+		entry->seq = ep->seq;
+
+		ret = zvfs_epoll_entry_arm(ep, entry);
+		if (ret < 0) {
+			zvfs_epoll_entry_disarm(ep, entry);
+			entry->fd = -1;
+		}
+		break;
+	case ZVFS_EPOLL_CTL_MOD:
+		if (entry == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		entry->event = *event;
+		ret = zvfs_epoll_entry_arm(ep, entry);
+		break;
+	case ZVFS_EPOLL_CTL_DEL:
+		if (entry == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		zvfs_epoll_entry_disarm(ep, entry);
+		entry->fd = -1;
+		break;
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout_ms)
+{
+	struct k_poll_event *ready[CONFIG_ZVFS_EPOLL_MAX_FDS];
+	struct zvfs_epoll *ep;
+	k_timeout_t timeout;
+	k_timepoint_t end;
+	uint32_t seq;
+	int count;
+	int ret;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EINVAL);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if ((events == NULL) || (maxevents <= 0)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (timeout_ms < 0) {
+		timeout = K_FOREVER;
+	} else {
+		timeout = K_MSEC(timeout_ms);
+	}
+
+	end = sys_timepoint_calc(timeout);
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+	seq = ++ep->seq;
+	count = zvfs_epoll_report_always(ep, events, maxevents, seq);
+	k_mutex_unlock(&ep->lock);
+
+	while (count < maxevents) {
+		/* pick up what else is ready without waiting */
+		timeout = (count > 0) ? K_NO_WAIT : sys_timepoint_timeout(end);
+
+		ret = k_poll_set_wait(&ep->set, ready,
+				      MIN(maxevents - count, (int)ARRAY_SIZE(ready)), timeout);
+		if (ret == -EAGAIN) {
+			break;
+		} else if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+
+		(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+		for (int i = 0; (i < ret) && (count < maxevents); i++) {
+			/* the descriptor may have been removed in the meantime */
+			count += zvfs_epoll_entry_report(ep, zvfs_epoll_entry_of(ep, ready[i]),
+							 &events[count], seq);
+		}
+
+		k_mutex_unlock(&ep->lock);
+
+		if (count > 0) {
+			break;
+		}
+	}
+
+	return count;
+}
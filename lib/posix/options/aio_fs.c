@@ -0,0 +1,527 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "fs_priv.h"
+
+#include <errno.h>
+#include <signal.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs_rtio.h>
+#include <zephyr/posix/aio.h>
+#include <zephyr/posix/fcntl.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/sys/util.h>
+
+enum aio_op {
+	AIO_OP_READ,
+	AIO_OP_WRITE,
+	AIO_OP_SYNC,
+};
+
+struct aio_file {
+	struct fs_rtio_file rtio;
+	/* operations submitted and not yet completed */
+	int pending;
+};
+
+struct aio_req {
+	struct aiocb *aiocbp;
+	struct aio_file *file;
+	enum aio_op op;
+	ssize_t result;
+	/* EINPROGRESS until the operation completes */
+	int error;
+};
+
+/* one I/O device per file descriptor, the operations on a file descriptor run in order */
+static struct aio_file aio_files[CONFIG_ZVFS_OPEN_MAX];
+static struct aio_req aio_reqs[CONFIG_POSIX_AIO_MAX];
+
+/* The operations complete in aio_work(), the completion events are only needed
+ * for the submissions the work queue could not take, see aio_reap(). They are
+ * consumed on each submission, by then at most one event per outstanding
+ * operation and per work queue thread is pending.
+ */
+RTIO_DEFINE(aio_rtio, CONFIG_POSIX_AIO_MAX, CONFIG_POSIX_AIO_MAX + CONFIG_RTIO_WORKQ_THREADS_POOL);
+
+static K_MUTEX_DEFINE(aio_lock);
+static K_CONDVAR_DEFINE(aio_cond);
+
+static struct aio_req *aio_req_find(const struct aiocb *aiocbp)
+{
+	ARRAY_FOR_EACH_PTR(aio_reqs, req) {
+		if (req->aiocbp == aiocbp) {
+			return req;
+		}
+	}
+
+	return NULL;
+}
+
+static int aio_req_free_count(void)
+{
+	int count = 0;
+
+	ARRAY_FOR_EACH_PTR(aio_reqs, req) {
+		if (req->aiocbp == NULL) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+static bool aio_sigevent_valid(const struct sigevent *sig)
+{
+	switch (sig->sigev_notify) {
+	case SIGEV_NONE:
+		return true;
+	case SIGEV_THREAD:
+		return sig->sigev_notify_function != NULL;
+	default:
+		/* signal notification is not supported */
+		return false;
+	}
+}
+
+/* Complete an operation, with aio_lock held */
+static void aio_req_done(struct aio_req *req, ssize_t rc)
+{
+	if (rc < 0) {
+		req->error = -rc;
+		req->result = -1;
+	} else {
+		req->error = 0;
+		req->result = rc;
+	}
+	req->file->pending--;
+	k_condvar_broadcast(&aio_cond);
+}
+
+/* Consume the completion events, with aio_lock held. A submission that the
+ * work queue could not take completes with an error from rtio_submit(),
+ * without aio_work() being called, and is notified from the submitting thread.
+ */
+static void aio_reap(void)
+{
+	struct rtio_cqe *cqe;
+	struct aio_req *req;
+
+	while ((cqe = rtio_cqe_consume(&aio_rtio)) != NULL) {
+		req = cqe->userdata;
+		if ((cqe->result < 0) && (req->error == EINPROGRESS)) {
+			struct sigevent sig = req->aiocbp->aio_sigevent;
+
+			/* no resources to run the operation */
+			aio_req_done(req, -EAGAIN);
+
+			if (sig.sigev_notify == SIGEV_THREAD) {
+				sig.sigev_notify_function(sig.sigev_value);
+			}
+		}
+		rtio_cqe_release(&aio_rtio, cqe);
+	}
+}
+
+/* Runs on a RTIO work queue thread, in submission order for the file descriptor */
+static void aio_work(struct rtio *r, const struct rtio_sqe *sqe, void *arg0)
+{
+	struct aio_req *req = arg0;
+	struct aiocb *aiocbp = req->aiocbp;
+	struct fs_file_t *zfp = req->file->rtio.zfp;
+	struct sigevent sig = aiocbp->aio_sigevent;
+	ssize_t rc = 0;
+
+	ARG_UNUSED(r);
+	ARG_UNUSED(sqe);
+
+	switch (req->op) {
+	case AIO_OP_READ:
+		rc = fs_seek(zfp, aiocbp->aio_offset, FS_SEEK_SET);
+		if (rc == 0) {
+			rc = fs_read(zfp, (void *)aiocbp->aio_buf, aiocbp->aio_nbytes);
+		}
+		break;
+	case AIO_OP_WRITE:
+		/* files opened with O_APPEND are written at their end */
+		if ((zfp->flags & FS_O_APPEND) == 0) {
+			rc = fs_seek(zfp, aiocbp->aio_offset, FS_SEEK_SET);
+		}
+		if (rc == 0) {
+			rc = fs_write(zfp, (const void *)aiocbp->aio_buf, aiocbp->aio_nbytes);
+		}
+		break;
+	case AIO_OP_SYNC:
+		rc = fs_sync(zfp);
+		break;
+	}
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+	aio_req_done(req, rc);
+	k_mutex_unlock(&aio_lock);
+
+	if (sig.sigev_notify == SIGEV_THREAD) {
+		sig.sigev_notify_function(sig.sigev_value);
+	}
+}
+
+/* Queue an operation, with aio_lock held. Returns 0 or an errno code. */
+static int aio_enqueue(struct aiocb *aiocbp, enum aio_op op)
+{
+	struct fs_file_t *zfp;
+	struct aio_file *file;
+	struct aio_req *req;
+	struct rtio_sqe *sqe;
+
+	if (!aio_sigevent_valid(&aiocbp->aio_sigevent)) {
+		return EINVAL;
+	}
+
+	if ((op != AIO_OP_SYNC) && (aiocbp->aio_offset < 0)) {
+		return EINVAL;
+	}
+
+	zfp = posix_fs_file_get(aiocbp->aio_fildes);
+	if (zfp == NULL) {
+		return EBADF;
+	}
+
+	file = &aio_files[aiocbp->aio_fildes];
+	if (file->rtio.zfp != zfp) {
+		if (file->pending != 0) {
+			/* the descriptor was closed and reused with operations pending */
+			return EAGAIN;
+		}
+
+		fs_rtio_file_init(&file->rtio, zfp);
+	}
+
+	/* a control block that completed and was not returned is reused */
+	req = aio_req_find(aiocbp);
+	if ((req != NULL) && (req->error == EINPROGRESS)) {
+		return EINVAL;
+	}
+
+	if (req == NULL) {
+		req = aio_req_find(NULL);
+		if (req == NULL) {
+			return EAGAIN;
+		}
+	}
+
+	sqe = rtio_sqe_acquire(&aio_rtio);
+	if (sqe == NULL) {
+		return EAGAIN;
+	}
+
+	req->aiocbp = aiocbp;
+	req->file = file;
+	req->op = op;
+	req->result = -1;
+	req->error = EINPROGRESS;
+	file->pending++;
+
+	rtio_sqe_prep_callback(sqe, aio_work, req, req);
+	sqe->iodev = &file->rtio.iodev;
+
+	return 0;
+}
+
+/* Record the error of an operation that could not be queued, with aio_lock held */
+static void aio_req_fail(struct aiocb *aiocbp, int error)
+{
+	struct aio_req *req = aio_req_find(aiocbp);
+
+	if ((req != NULL) && (req->error == EINPROGRESS)) {
+		/* the control block is in use by another operation */
+		return;
+	}
+
+	if (req == NULL) {
+		req = aio_req_find(NULL);
+		if (req == NULL) {
+			return;
+		}
+	}
+
+	req->aiocbp = aiocbp;
+	req->file = NULL;
+	req->result = -1;
+	req->error = error;
+}
+
+static int aio_submit(struct aiocb *aiocbp, enum aio_op op)
+{
+	int ret;
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+	aio_reap();
+	ret = aio_enqueue(aiocbp, op);
+	if (ret == 0) {
+		rtio_submit(&aio_rtio, 0);
+		aio_reap();
+	}
+	k_mutex_unlock(&aio_lock);
+
+	if (ret != 0) {
+		errno = ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int aio_cancel(int fildes, struct aiocb *aiocbp)
+{
+	int ret = AIO_ALLDONE;
+
+	if (posix_fs_file_get(fildes) == NULL) {
+		return -1;
+	}
+
+	if ((aiocbp != NULL) && (aiocbp->aio_fildes != fildes)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	/* operations queued on the RTIO work queue are not canceled */
+	k_mutex_lock(&aio_lock, K_FOREVER);
+	ARRAY_FOR_EACH_PTR(aio_reqs, req) {
+		if ((req->aiocbp == NULL) || (req->error != EINPROGRESS)) {
+			continue;
+		}
+
+		if ((aiocbp == NULL) ? (req->aiocbp->aio_fildes == fildes)
+				     : (req->aiocbp == aiocbp)) {
+			ret = AIO_NOTCANCELED;
+			break;
+		}
+	}
+	k_mutex_unlock(&aio_lock);
+
+	return ret;
+}
+
+int aio_error(const struct aiocb *aiocbp)
+{
+	struct aio_req *req;
+	int ret;
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+	req = aio_req_find(aiocbp);
+	ret = (req != NULL) ? req->error : -1;
+	k_mutex_unlock(&aio_lock);
+
+	if (ret < 0) {
+		errno = EINVAL;
+	}
+
+	return ret;
+}
+
+int aio_fsync(int op, struct aiocb *aiocbp)
+{
+#if defined(O_SYNC) && defined(O_DSYNC)
+	if ((op != O_SYNC) && (op != O_DSYNC)) {
+		errno = EINVAL;
+		return -1;
+	}
+#else
+	/* O_SYNC and O_DSYNC both sync the file */
+	ARG_UNUSED(op);
+#endif
+
+	return aio_submit(aiocbp, AIO_OP_SYNC);
+}
+
+int aio_read(struct aiocb *aiocbp)
+{
+	return aio_submit(aiocbp, AIO_OP_READ);
+}
+
+ssize_t aio_return(struct aiocb *aiocbp)
+{
+	struct aio_req *req;
+	ssize_t ret = -1;
+	int err = EINVAL;
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+	req = aio_req_find(aiocbp);
+	if ((req != NULL) && (req->error != EINPROGRESS)) {
+		ret = req->result;
+		err = req->error;
+		req->aiocbp = NULL;
+	}
+	k_mutex_unlock(&aio_lock);
+
+	if (err != 0) {
+		errno = err;
+		return -1;
+	}
+
+	return ret;
+}
+
+/* Whether any of the operations completed, with aio_lock held */
+static bool aio_any_done(const struct aiocb *const list[], int nent)
+{
+	struct aio_req *req;
+
+	for (int i = 0; i < nent; i++) {
+		if (list[i] == NULL) {
+			continue;
+		}
+
+		req = aio_req_find(list[i]);
+		if ((req == NULL) || (req->error != EINPROGRESS)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int aio_suspend(const struct aiocb *const list[], int nent, const struct timespec *timeout)
+{
+	k_timeout_t wait = K_FOREVER;
+	k_timepoint_t end;
+	int ret = 0;
+
+	if (nent <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (timeout != NULL) {
+		if ((timeout->tv_sec < 0) || (timeout->tv_nsec < 0) ||
+		    (timeout->tv_nsec >= NSEC_PER_SEC)) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		wait = K_USEC((int64_t)timeout->tv_sec * USEC_PER_SEC +
+			      DIV_ROUND_UP(timeout->tv_nsec, NSEC_PER_USEC));
+	}
+
+	end = sys_timepoint_calc(wait);
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+	while (!aio_any_done(list, nent)) {
+		if (k_condvar_wait(&aio_cond, &aio_lock, sys_timepoint_timeout(end)) != 0) {
+			ret = aio_any_done(list, nent) ? 0 : EAGAIN;
+			break;
+		}
+	}
+	k_mutex_unlock(&aio_lock);
+
+	if (ret != 0) {
+		errno = ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int aio_write(struct aiocb *aiocbp)
+{
+	return aio_submit(aiocbp, AIO_OP_WRITE);
+}
+
+int lio_listio(int mode, struct aiocb *const ZRESTRICT list[], int nent,
+	       struct sigevent *ZRESTRICT sig)
+{
+	int count = 0;
+	int ret = 0;
+
+	if (((mode != LIO_WAIT) && (mode != LIO_NOWAIT)) || (nent <= 0) ||
+	    (nent > AIO_LISTIO_MAX)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	/* completion of the list is only reported by waiting for it */
+	if ((mode == LIO_NOWAIT) && (sig != NULL) && (sig->sigev_notify != SIGEV_NONE)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	k_mutex_lock(&aio_lock, K_FOREVER);
+	aio_reap();
+
+	/* the operations are queued all together, or none of them */
+	for (int i = 0; i < nent; i++) {
+		if ((list[i] == NULL) || (list[i]->aio_lio_opcode == LIO_NOP)) {
+			continue;
+		}
+
+		if ((list[i]->aio_lio_opcode != LIO_READ) &&
+		    (list[i]->aio_lio_opcode != LIO_WRITE)) {
+			ret = EINVAL;
+			break;
+		}
+
+		if (posix_fs_file_get(list[i]->aio_fildes) == NULL) {
+			ret = EIO;
+			break;
+		}
+
+		count++;
+	}
+
+	if ((ret == 0) && (count > aio_req_free_count())) {
+		ret = EAGAIN;
+	}
+
+	for (int i = 0; (ret == 0) && (i < nent); i++) {
+		if ((list[i] == NULL) || (list[i]->aio_lio_opcode == LIO_NOP)) {
+			continue;
+		}
+
+		ret = aio_enqueue(list[i], (list[i]->aio_lio_opcode == LIO_READ) ? AIO_OP_READ
+										  : AIO_OP_WRITE);
+		if (ret != 0) {
+			/* the operations already queued still run, the following ones
+			 * are not queued
+			 */
+			aio_req_fail(list[i], ret);
+			ret = EIO;
+		}
+	}
+
+	if (count > 0) {
+		rtio_submit(&aio_rtio, 0);
+		aio_reap();
+	}
+
+	if ((ret == 0) && (mode == LIO_WAIT)) {
+		for (int i = 0; i < nent; i++) {
+			struct aio_req *req;
+
+			if ((list[i] == NULL) || (list[i]->aio_lio_opcode == LIO_NOP)) {
+				continue;
+			}
+
+			req = aio_req_find(list[i]);
+			while ((req != NULL) && (req->error == EINPROGRESS)) {
+				k_condvar_wait(&aio_cond, &aio_lock, K_FOREVER);
+			}
+
+			if ((req != NULL) && (req->error != 0)) {
+				ret = EIO;
+			}
+		}
+	}
+
+	k_mutex_unlock(&aio_lock);
+
+	if (ret != 0) {
+		errno = ret;
+		return -1;
+	}
+
+	return 0;
+}
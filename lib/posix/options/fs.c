@@ -241,6 +241,23 @@ static struct fd_op_vtable fs_fd_op_vtable = {
 	.ioctl = fs_ioctl_vmeth,
 };
 
+struct fs_file_t *posix_fs_file_get(int fd)
+{
+	struct posix_fs_desc *ptr;
+
+	ptr = zvfs_get_fd_obj(fd, &fs_fd_op_vtable, EBADF);
+	if (ptr == NULL) {
+		return NULL;
+	}
+
+	if (ptr->is_dir) {
+		errno = EBADF;
+		return NULL;
+	}
+
+	return &ptr->file;
+}
+
 /**
  * @brief Open a directory stream.
  *
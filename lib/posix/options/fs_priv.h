@@ -20,4 +20,7 @@ struct posix_fs_desc {
 	bool used: 1;
 };
 
+/* Get the open file of a file descriptor, or NULL with errno set */
+struct fs_file_t *posix_fs_file_get(int fd);
+
 #endif
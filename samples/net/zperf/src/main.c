@@ -63,7 +63,7 @@ int main(void)
 #endif /* CONFIG_USB_DEVICE_STACK_NEXT */
 
 #ifdef CONFIG_NET_LOOPBACK_SIMULATE_PACKET_DROP
-	loopback_set_packet_drop_ratio(1);
+	loopback_set_packet_drop_ratio(CONFIG_NET_SAMPLE_LOOPBACK_DROP_PERMILLE / 1000.0f);
 #endif
 
 #if defined(CONFIG_NET_DHCPV4) && !defined(CONFIG_NET_CONFIG_SETTINGS)
@@ -92,6 +92,7 @@ from collections import OrderedDict
 kobjects = OrderedDict([
     ("k_mem_slab", (None, False, True)),
     ("k_msgq", (None, False, True)),
+    ("k_chan", (None, False, True)),
     ("k_mutex", (None, False, True)),
     ("k_pipe", (None, False, True)),
     ("k_queue", (None, False, True)),
@@ -56,12 +56,21 @@ BUILD_ASSERT((CONFIG_IMG_BLOCK_BUF_SIZE % FLASH_WRITE_BLOCK_SIZE == 0),
 #define FLASH_CHECK_ERASED_BUFFER_SIZE 16
 #define ERASED_VAL_32(x) (((x) << 24) | ((x) << 16) | ((x) << 8) | (x))
 
+#ifdef CONFIG_IMG_WRITE_ASYNC
+/* Context of the last upload started and not flushed, which may still be
+ * programming in the background. The contexts given to flash_img_init_id()
+ * need not be initialized, so their content cannot tell.
+ */
+static struct flash_img_context *upload_ctx;
+#endif
+
 static int scramble_mcuboot_trailer(struct flash_img_context *ctx)
 {
 	int rc = 0;
 
 #ifdef CONFIG_IMG_ERASE_PROGRESSIVELY
-	if (stream_flash_bytes_written(&ctx->stream) == 0) {
+	if ((stream_flash_bytes_written(&ctx->stream) +
+	     stream_flash_bytes_buffered(&ctx->stream)) == 0) {
 		off_t toff = boot_get_trailer_status_offset(ctx->flash_area->fa_size);
 		off_t offset;
 		size_t size;
@@ -129,6 +138,14 @@ int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 		return rc;
 	}
 
+#ifdef CONFIG_IMG_WRITE_ASYNC
+	/* Also when the flush failed, nothing is programmed past this point */
+	(void)stream_flash_async_wait(&ctx->stream);
+	if (upload_ctx == ctx) {
+		upload_ctx = NULL;
+	}
+#endif
+
 	flash_area_close(ctx->flash_area);
 	ctx->flash_area = NULL;
 
@@ -199,6 +216,14 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 	struct flash_sector sector_data;
 #endif
 
+#ifdef CONFIG_IMG_WRITE_ASYNC
+	/* An abandoned upload may still be programming in the background */
+	if (upload_ctx == ctx) {
+		(void)stream_flash_async_wait(&ctx->stream);
+		upload_ctx = NULL;
+	}
+#endif
+
 	rc = flash_area_open(area_id,
 			       (const struct flash_area **)&(ctx->flash_area));
 	if (rc) {
@@ -238,14 +263,25 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 		}
 	}
 
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf, CONFIG_IMG_BLOCK_BUF_SIZE,
-				 (ctx->flash_area->fa_off + sector_data.fs_size),
-				 (ctx->flash_area->fa_size - sector_data.fs_size), NULL);
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf, CONFIG_IMG_BLOCK_BUF_SIZE,
+			       (ctx->flash_area->fa_off + sector_data.fs_size),
+			       (ctx->flash_area->fa_size - sector_data.fs_size), NULL);
 #else
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
 			CONFIG_IMG_BLOCK_BUF_SIZE, ctx->flash_area->fa_off,
 			ctx->flash_area->fa_size, NULL);
 #endif
+
+#ifdef CONFIG_IMG_WRITE_ASYNC
+	if (rc == 0) {
+		rc = stream_flash_async_enable(&ctx->stream, ctx->prog_buf);
+	}
+	if (rc == 0) {
+		upload_ctx = ctx;
+	}
+#endif
+
+	return rc;
 }
 
 #ifdef CONFIG_MCUBOOT_BOOTLOADER_MODE_RAM_LOAD
@@ -18,6 +18,10 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(disk);
 
+#if defined(CONFIG_DISK_CACHE)
+#include "disk_cache.h"
+#endif
+
 /* list of mounted file systems */
 static sys_dlist_t disk_access_list = SYS_DLIST_STATIC_INIT(&disk_access_list);
 
@@ -66,6 +70,9 @@ int disk_access_init(const char *pdrv)
 			if (rc == 0) {
 				/* Increment reference count */
 				disk->refcnt++;
+#if defined(CONFIG_DISK_CACHE)
+				disk_cache_attach(disk);
+#endif
 			}
 		}
 	} else if ((disk != NULL) && (disk->refcnt < UINT16_MAX)) {
@@ -98,7 +105,11 @@ int disk_access_read(const char *pdrv, uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->read != NULL)) {
+#if defined(CONFIG_DISK_CACHE)
+		rc = disk_cache_read(disk, data_buf, start_sector, num_sector);
+#else
 		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+#endif
 	}
 
 	return rc;
@@ -112,7 +123,11 @@ int disk_access_write(const char *pdrv, const uint8_t *data_buf,
 
 	if ((disk != NULL) && (disk->ops != NULL) &&
 				(disk->ops->write != NULL)) {
+#if defined(CONFIG_DISK_CACHE)
+		rc = disk_cache_write(disk, data_buf, start_sector, num_sector);
+#else
 		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+#endif
 	}
 
 	return rc;
@@ -131,6 +146,9 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 				rc = disk->ops->ioctl(disk, cmd, buf);
 				if (rc == 0) {
 					disk->refcnt++;
+#if defined(CONFIG_DISK_CACHE)
+					disk_cache_attach(disk);
+#endif
 				}
 			} else if (disk->refcnt < UINT16_MAX) {
 				disk->refcnt++;
@@ -143,9 +161,18 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 			if ((buf != NULL) && (*((bool *)buf))) {
 				/* Force deinit disk */
 				disk->refcnt = 0U;
+#if defined(CONFIG_DISK_CACHE)
+				(void)disk_cache_detach(disk);
+#endif
 				disk->ops->ioctl(disk, cmd, buf);
 				rc = 0;
 			} else if (disk->refcnt == 1U) {
+#if defined(CONFIG_DISK_CACHE)
+				rc = disk_cache_detach(disk);
+				if (rc != 0) {
+					break;
+				}
+#endif
 				rc = disk->ops->ioctl(disk, cmd, buf);
 				if (rc == 0) {
 					disk->refcnt--;
@@ -157,6 +184,14 @@ int disk_access_ioctl(const char *pdrv, uint8_t cmd, void *buf)
 				LOG_WRN("Disk is already deinitialized");
 			}
 			break;
+#if defined(CONFIG_DISK_CACHE)
+		case DISK_IOCTL_CTRL_SYNC:
+			rc = disk_cache_sync(disk);
+			if (rc == 0) {
+				rc = disk->ops->ioctl(disk, cmd, buf);
+			}
+			break;
+#endif
 		default:
 			rc = disk->ops->ioctl(disk, cmd, buf);
 		}
@@ -181,6 +216,9 @@ int disk_access_register(struct disk_info *disk)
 
 	/* Initialize reference count to zero */
 	disk->refcnt = 0U;
+#if defined(CONFIG_DISK_CACHE)
+	disk->cache_sectors = 0U;
+#endif
 
 	spinlock_key = k_spin_lock(&lock);
 	/*  append to the disk list */
@@ -204,6 +242,10 @@ int disk_access_unregister(struct disk_info *disk)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_DISK_CACHE)
+	(void)disk_cache_detach(disk);
+#endif
+
 	spinlock_key = k_spin_lock(&lock);
 	/* remove disk node from the list */
 	sys_dlist_remove(&disk->node);
@@ -0,0 +1,596 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/storage/disk_access.h>
+
+#include "disk_cache.h"
+
+#define LOG_LEVEL CONFIG_DISK_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(disk);
+
+#define SECTOR_SIZE CONFIG_DISK_CACHE_SECTOR_SIZE
+#define BURST       CONFIG_DISK_CACHE_BURST_SECTORS
+
+struct disk_cache_block {
+	/* position in the LRU list, most recently used first */
+	sys_dnode_t node;
+	/* disk of the cached sector, NULL when the block is unused */
+	struct disk_info *disk;
+	uint32_t sector;
+	bool dirty;
+	/* a disk command is using the block data */
+	bool busy;
+	uint8_t *data;
+};
+
+/* The cache lock is held during the disk commands. A disk driver can access
+ * another disk from the same thread, as the loopback disk does, the nested
+ * access must then not use the burst buffer nor the blocks in use by the
+ * outer access.
+ */
+static K_MUTEX_DEFINE(cache_lock);
+static uint8_t cache_depth;
+static bool cache_ready;
+
+static sys_dlist_t cache_lru;
+static struct disk_cache_block cache_blocks[CONFIG_DISK_CACHE_BLOCKS];
+static uint8_t cache_data[CONFIG_DISK_CACHE_BLOCKS][SECTOR_SIZE] __aligned(4);
+static uint8_t burst_buf[BURST * SECTOR_SIZE] __aligned(4);
+
+/* sequential read detection */
+static struct disk_info *ra_disk;
+static uint32_t ra_next;
+
+static struct disk_cache_stats cache_stats;
+
+static void disk_cache_lock(void)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	cache_depth++;
+}
+
+static void disk_cache_unlock(void)
+{
+	cache_depth--;
+	k_mutex_unlock(&cache_lock);
+}
+
+static inline bool disk_cache_nested(void)
+{
+	return cache_depth > 1;
+}
+
+static void disk_cache_init(void)
+{
+	sys_dlist_init(&cache_lru);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_blocks); i++) {
+		cache_blocks[i].data = cache_data[i];
+		sys_dlist_append(&cache_lru, &cache_blocks[i].node);
+	}
+
+	cache_ready = true;
+}
+
+static struct disk_cache_block *disk_cache_find(struct disk_info *disk, uint32_t sector)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache_blocks); i++) {
+		if ((cache_blocks[i].disk == disk) && (cache_blocks[i].sector == sector)) {
+			return &cache_blocks[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void disk_cache_touch(struct disk_cache_block *blk)
+{
+	sys_dlist_remove(&blk->node);
+	sys_dlist_prepend(&cache_lru, &blk->node);
+}
+
+/* Unused blocks are moved to the end of the LRU list to be reused first */
+static void disk_cache_drop(struct disk_cache_block *blk)
+{
+	blk->disk = NULL;
+	blk->dirty = false;
+	sys_dlist_remove(&blk->node);
+	sys_dlist_append(&cache_lru, &blk->node);
+}
+
+/* Write a dirty block to the disk, together with the adjacent dirty blocks of
+ * the same disk when the burst buffer is available.
+ */
+static int disk_cache_flush(struct disk_cache_block *blk)
+{
+	struct disk_cache_block *run[BURST];
+	struct disk_cache_block *adj;
+	struct disk_info *disk = blk->disk;
+	uint32_t first = blk->sector;
+	uint32_t count = 1;
+	int rc;
+
+	if (disk_cache_nested()) {
+		blk->busy = true;
+		rc = disk->ops->write(disk, blk->data, blk->sector, 1);
+		blk->busy = false;
+		cache_stats.disk_writes++;
+		if (rc == 0) {
+			blk->dirty = false;
+			cache_stats.disk_written++;
+		}
+
+		return rc;
+	}
+
+	run[0] = blk;
+	while ((count < BURST) && (first > 0)) {
+		adj = disk_cache_find(disk, first - 1);
+		if ((adj == NULL) || !adj->dirty || adj->busy) {
+			break;
+		}
+
+		memmove(&run[1], &run[0], count * sizeof(run[0]));
+		run[0] = adj;
+		first--;
+		count++;
+	}
+
+	while (count < BURST) {
+		adj = disk_cache_find(disk, first + count);
+		if ((adj == NULL) || !adj->dirty || adj->busy) {
+			break;
+		}
+
+		run[count++] = adj;
+	}
+
+	for (uint32_t i = 0; i < count; i++) {
+		memcpy(&burst_buf[i * SECTOR_SIZE], run[i]->data, SECTOR_SIZE);
+		run[i]->busy = true;
+	}
+
+	rc = disk->ops->write(disk, burst_buf, first, count);
+	cache_stats.disk_writes++;
+
+	for (uint32_t i = 0; i < count; i++) {
+		run[i]->busy = false;
+		if (rc == 0) {
+			run[i]->dirty = false;
+		}
+	}
+
+	if (rc == 0) {
+		cache_stats.disk_written += count;
+	} else {
+		LOG_ERR("Write back of %u sectors at %u failed (%d)", count, first, rc);
+	}
+
+	return rc;
+}
+
+/* Take the least recently used block that is not in use, writing it back if
+ * needed. Returns 0 with *blk NULL if all blocks are in use.
+ */
+static int disk_cache_evict(struct disk_cache_block **blk)
+{
+	struct disk_cache_block *victim = NULL;
+	sys_dnode_t *node;
+	int rc;
+
+	for (node = sys_dlist_peek_tail(&cache_lru); node != NULL;
+	     node = sys_dlist_peek_prev(&cache_lru, node)) {
+		victim = CONTAINER_OF(node, struct disk_cache_block, node);
+		if (!victim->busy) {
+			break;
+		}
+		victim = NULL;
+	}
+
+	*blk = NULL;
+	if (victim == NULL) {
+		return 0;
+	}
+
+	if (victim->dirty) {
+		rc = disk_cache_flush(victim);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	disk_cache_drop(victim);
+	*blk = victim;
+
+	return 0;
+}
+
+static void disk_cache_fill(struct disk_cache_block *blk, struct disk_info *disk,
+			    uint32_t sector, const uint8_t *data, bool dirty)
+{
+	memcpy(blk->data, data, SECTOR_SIZE);
+	blk->disk = disk;
+	blk->sector = sector;
+	blk->dirty = dirty;
+	disk_cache_touch(blk);
+}
+
+/* Read missing sectors through the burst buffer, caching them and the read
+ * ahead sectors. Returns the number of requested sectors read or an error.
+ */
+static int disk_cache_read_burst(struct disk_info *disk, uint8_t *data_buf,
+				 uint32_t start_sector, uint32_t num_sector, uint32_t ahead)
+{
+	struct disk_cache_block *blks[BURST];
+	uint32_t count = MIN(num_sector + ahead, BURST);
+	uint32_t n;
+	int rc = 0;
+
+	/* reserve the blocks before the burst buffer is filled, write backs
+	 * done to evict blocks use it too
+	 */
+	for (n = 0; n < count; n++) {
+		rc = disk_cache_evict(&blks[n]);
+		if ((rc < 0) || (blks[n] == NULL)) {
+			break;
+		}
+
+		blks[n]->busy = true;
+	}
+
+	if ((rc < 0) && (n < num_sector)) {
+		for (uint32_t i = 0; i < n; i++) {
+			blks[i]->busy = false;
+		}
+
+		return rc;
+	}
+
+	if (n == 0) {
+		/* all blocks in use, read without caching */
+		rc = disk->ops->read(disk, data_buf, start_sector, num_sector);
+		cache_stats.disk_reads++;
+		cache_stats.read_misses += num_sector;
+
+		return (rc < 0) ? rc : (int)num_sector;
+	}
+
+	count = n;
+	rc = disk->ops->read(disk, burst_buf, start_sector, count);
+	cache_stats.disk_reads++;
+
+	for (uint32_t i = 0; i < count; i++) {
+		blks[i]->busy = false;
+		if (rc == 0) {
+			disk_cache_fill(blks[i], disk, start_sector + i,
+					&burst_buf[i * SECTOR_SIZE], false);
+		}
+	}
+
+	if (rc < 0) {
+		return rc;
+	}
+
+	n = MIN(count, num_sector);
+	memcpy(data_buf, burst_buf, n * SECTOR_SIZE);
+	cache_stats.read_misses += n;
+	cache_stats.read_ahead += count - n;
+
+	return n;
+}
+
+/* Read a missing sector without the burst buffer, in a nested access */
+static int disk_cache_read_one(struct disk_info *disk, uint8_t *data_buf, uint32_t sector)
+{
+	struct disk_cache_block *blk;
+	int rc;
+
+	rc = disk_cache_evict(&blk);
+	if (rc < 0) {
+		return rc;
+	}
+
+	cache_stats.disk_reads++;
+	cache_stats.read_misses++;
+
+	if (blk == NULL) {
+		return disk->ops->read(disk, data_buf, sector, 1);
+	}
+
+	blk->busy = true;
+	rc = disk->ops->read(disk, blk->data, sector, 1);
+	blk->busy = false;
+	if (rc < 0) {
+		return rc;
+	}
+
+	blk->disk = disk;
+	blk->sector = sector;
+	disk_cache_touch(blk);
+	memcpy(data_buf, blk->data, SECTOR_SIZE);
+
+	return 1;
+}
+
+static bool disk_cache_in_range(struct disk_info *disk, uint32_t start_sector,
+				uint32_t num_sector)
+{
+	uint32_t end = start_sector + num_sector;
+
+	return (end >= start_sector) && (end <= disk->cache_sectors);
+}
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_block *blk;
+	uint32_t ahead = 0;
+	uint32_t run;
+	int rc = 0;
+
+	if (disk->cache_sectors == 0) {
+		return disk->ops->read(disk, data_buf, start_sector, num_sector);
+	}
+
+	if (!disk_cache_in_range(disk, start_sector, num_sector)) {
+		return -EIO;
+	}
+
+	disk_cache_lock();
+
+	if ((disk == ra_disk) && (start_sector == ra_next)) {
+		ahead = CONFIG_DISK_CACHE_READ_AHEAD;
+	}
+
+	ra_disk = disk;
+	ra_next = start_sector + num_sector;
+
+	while (num_sector > 0) {
+		blk = disk_cache_find(disk, start_sector);
+		if (blk != NULL) {
+			memcpy(data_buf, blk->data, SECTOR_SIZE);
+			disk_cache_touch(blk);
+			cache_stats.read_hits++;
+			data_buf += SECTOR_SIZE;
+			start_sector++;
+			num_sector--;
+			continue;
+		}
+
+		/* missing sectors up to the next cached one */
+		run = 1;
+		while ((run < num_sector) && (disk_cache_find(disk, start_sector + run) == NULL)) {
+			run++;
+		}
+
+		if (run > BURST) {
+			/* large reads bypass the cache */
+			rc = disk->ops->read(disk, data_buf, start_sector, run);
+			cache_stats.disk_reads++;
+			cache_stats.read_misses += run;
+		} else if (disk_cache_nested()) {
+			rc = disk_cache_read_one(disk, data_buf, start_sector);
+			run = 1;
+		} else {
+			uint32_t count = run;
+
+			/* read ahead only after the last requested sector */
+			if (run == num_sector) {
+				while ((count < run + ahead) &&
+				       (start_sector + count < disk->cache_sectors) &&
+				       (disk_cache_find(disk, start_sector + count) == NULL)) {
+					count++;
+				}
+			}
+
+			rc = disk_cache_read_burst(disk, data_buf, start_sector, run,
+						   count - run);
+			if (rc > 0) {
+				run = rc;
+			}
+		}
+
+		if (rc < 0) {
+			break;
+		}
+
+		rc = 0;
+		data_buf += run * SECTOR_SIZE;
+		start_sector += run;
+		num_sector -= run;
+	}
+
+	disk_cache_unlock();
+
+	return rc;
+}
+
+/* Update the cached copies of sectors written to the disk */
+static void disk_cache_update(struct disk_info *disk, const uint8_t *data_buf,
+			      uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_block *blk;
+
+	for (uint32_t i = 0; i < num_sector; i++) {
+		blk = disk_cache_find(disk, start_sector + i);
+		if (blk != NULL) {
+			memcpy(blk->data, &data_buf[i * SECTOR_SIZE], SECTOR_SIZE);
+			blk->dirty = false;
+		}
+	}
+}
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector)
+{
+	struct disk_cache_block *blk;
+	int rc = 0;
+
+	if (disk->cache_sectors == 0) {
+		return disk->ops->write(disk, data_buf, start_sector, num_sector);
+	}
+
+	if (!disk_cache_in_range(disk, start_sector, num_sector)) {
+		return -EIO;
+	}
+
+	disk_cache_lock();
+
+	if (!IS_ENABLED(CONFIG_DISK_CACHE_WRITE_BACK) || (num_sector > BURST)) {
+		/* large writes are not cached */
+		rc = disk->ops->write(disk, data_buf, start_sector, num_sector);
+		cache_stats.disk_writes++;
+		if (rc == 0) {
+			cache_stats.disk_written += num_sector;
+			disk_cache_update(disk, data_buf, start_sector, num_sector);
+		}
+
+		disk_cache_unlock();
+		return rc;
+	}
+
+	for (uint32_t i = 0; i < num_sector; i++) {
+		blk = disk_cache_find(disk, start_sector + i);
+		if ((blk == NULL) || blk->busy) {
+			if (blk != NULL) {
+				disk_cache_drop(blk);
+			}
+
+			rc = disk_cache_evict(&blk);
+			if (rc < 0) {
+				break;
+			}
+		}
+
+		if (blk == NULL) {
+			/* all blocks in use, write through */
+			rc = disk->ops->write(disk, &data_buf[i * SECTOR_SIZE],
+					      start_sector + i, 1);
+			cache_stats.disk_writes++;
+			if (rc < 0) {
+				break;
+			}
+
+			cache_stats.disk_written++;
+			continue;
+		}
+
+		disk_cache_fill(blk, disk, start_sector + i, &data_buf[i * SECTOR_SIZE], true);
+	}
+
+	disk_cache_unlock();
+
+	return rc;
+}
+
+int disk_cache_sync(struct disk_info *disk)
+{
+	struct disk_cache_block *first;
+	int rc = 0;
+
+	if (disk->cache_sectors == 0) {
+		return 0;
+	}
+
+	disk_cache_lock();
+
+	/* write back from the lowest dirty sector, so that every flush
+	 * starts a run of adjacent sectors
+	 */
+	do {
+		first = NULL;
+		for (size_t i = 0; i < ARRAY_SIZE(cache_blocks); i++) {
+			struct disk_cache_block *blk = &cache_blocks[i];
+
+			if ((blk->disk == disk) && blk->dirty && !blk->busy &&
+			    ((first == NULL) || (blk->sector < first->sector))) {
+				first = blk;
+			}
+		}
+
+		if (first != NULL) {
+			rc = disk_cache_flush(first);
+		}
+	} while ((first != NULL) && (rc == 0));
+
+	disk_cache_unlock();
+
+	return rc;
+}
+
+void disk_cache_attach(struct disk_info *disk)
+{
+	uint32_t sector_size;
+	uint32_t sector_count;
+
+	disk->cache_sectors = 0;
+
+	if ((disk->ops->ioctl == NULL) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_SIZE, &sector_size) != 0) ||
+	    (disk->ops->ioctl(disk, DISK_IOCTL_GET_SECTOR_COUNT, &sector_count) != 0)) {
+		return;
+	}
+
+	if (sector_size != SECTOR_SIZE) {
+		LOG_INF("Disk %s not cached, sector size %u", disk->name, sector_size);
+		return;
+	}
+
+	disk_cache_lock();
+	if (!cache_ready) {
+		disk_cache_init();
+	}
+	disk_cache_unlock();
+
+	disk->cache_sectors = sector_count;
+}
+
+int disk_cache_detach(struct disk_info *disk)
+{
+	int rc;
+
+	if (disk->cache_sectors == 0) {
+		return 0;
+	}
+
+	rc = disk_cache_sync(disk);
+
+	disk_cache_lock();
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache_blocks); i++) {
+		if (cache_blocks[i].disk == disk) {
+			disk_cache_drop(&cache_blocks[i]);
+		}
+	}
+
+	if (ra_disk == disk) {
+		ra_disk = NULL;
+	}
+
+	disk->cache_sectors = 0;
+
+	disk_cache_unlock();
+
+	return rc;
+}
+
+void disk_cache_stats_get(struct disk_cache_stats *stats, bool reset)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	*stats = cache_stats;
+	if (reset) {
+		memset(&cache_stats, 0, sizeof(cache_stats));
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __ZEPHYR_SUBSYS_DISK_CACHE_H__
+#define __ZEPHYR_SUBSYS_DISK_CACHE_H__
+
+#include <zephyr/drivers/disk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Start caching an initialized disk, if its sector size is supported */
+void disk_cache_attach(struct disk_info *disk);
+
+/* Write back the dirty sectors of a disk and stop caching it */
+int disk_cache_detach(struct disk_info *disk);
+
+int disk_cache_read(struct disk_info *disk, uint8_t *data_buf,
+		    uint32_t start_sector, uint32_t num_sector);
+
+int disk_cache_write(struct disk_info *disk, const uint8_t *data_buf,
+		     uint32_t start_sector, uint32_t num_sector);
+
+/* Write back the dirty sectors of a disk */
+int disk_cache_sync(struct disk_info *disk);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __ZEPHYR_SUBSYS_DISK_CACHE_H__ */
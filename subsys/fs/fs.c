@@ -24,9 +24,30 @@ LOG_MODULE_REGISTER(fs);
 /* list of mounted file systems */
 static sys_dlist_t fs_mnt_list = SYS_DLIST_STATIC_INIT(&fs_mnt_list);
 
-/* lock to protect mount list operations */
+/* mounted file systems indexed by the first component of the mount point,
+ * each bucket sorted by decreasing mount point length
+ */
+static sys_slist_t fs_mnt_index[CONFIG_FILE_SYSTEM_MOUNT_BUCKETS];
+
+/* lock to protect mount list and index accesses, held for lookups only */
+static struct k_spinlock mnt_lock;
+
+/* lock to serialize mount, unmount, format and registration operations,
+ * which access the storage without blocking the mount point lookups
+ */
 static K_MUTEX_DEFINE(mutex);
 
+/* lock to serialize unmount operations, held while waiting for the path
+ * operations in progress on the mount point, without holding mutex
+ */
+static K_MUTEX_DEFINE(unmount_mutex);
+
+/* mount point being unmounted, given unmount_sem when its last reference
+ * is released
+ */
+static atomic_ptr_t unmount_mp;
+static K_SEM_DEFINE(unmount_sem, 0, 1);
+
 /* Maps an identifier used in mount points to the file system
  * implementation.
  */
@@ -79,25 +100,58 @@ static const struct fs_file_system_t *fs_type_get(int type)
 	return (ep != NULL) ? ep->fstp : NULL;
 }
 
-static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
-			    const char *name, size_t *match_len)
+/* Index bucket of the first component of an absolute path */
+static sys_slist_t *fs_mnt_bucket(const char *path)
 {
-	struct fs_mount_t *mnt_p = NULL, *itr;
-	size_t longest_match = 0;
-	size_t len, name_len = strlen(name);
-	sys_dnode_t *node;
+	/* FNV-1a hash */
+	uint32_t hash = 2166136261U;
 
-	k_mutex_lock(&mutex, K_FOREVER);
-	SYS_DLIST_FOR_EACH_NODE(&fs_mnt_list, node) {
-		itr = CONTAINER_OF(node, struct fs_mount_t, node);
+	for (path++; (*path != '\0') && (*path != '/'); path++) {
+		hash = (hash ^ (uint8_t)*path) * 16777619U;
+	}
+
+	return &fs_mnt_index[hash % CONFIG_FILE_SYSTEM_MOUNT_BUCKETS];
+}
+
+/* Add a mount point to the index, with mnt_lock held */
+static void fs_mnt_index_add(struct fs_mount_t *mp)
+{
+	sys_slist_t *bucket = fs_mnt_bucket(mp->mnt_point);
+	struct fs_mount_t *itr;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, itr, index_node) {
+		if (itr->mountp_len < mp->mountp_len) {
+			break;
+		}
+		prev = &itr->index_node;
+	}
+
+	sys_slist_insert(bucket, prev, &mp->index_node);
+}
+
+/* Remove a mount point from the index, with mnt_lock held */
+static void fs_mnt_index_remove(struct fs_mount_t *mp)
+{
+	sys_slist_find_and_remove(fs_mnt_bucket(mp->mnt_point), &mp->index_node);
+}
+
+/* Find a mount point in an index bucket, with mnt_lock held */
+static struct fs_mount_t *fs_mnt_find(sys_slist_t *bucket, const char *name,
+				      size_t name_len)
+{
+	struct fs_mount_t *itr;
+	size_t len;
+
+	/* The first match is the longest one */
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, itr, index_node) {
 		len = itr->mountp_len;
 
 		/*
-		 * Move to next node if mount point length is
-		 * shorter than longest_match match or if path
-		 * name is shorter than the mount point name.
+		 * Move to next node if path name is shorter than the mount
+		 * point name.
 		 */
-		if ((len < longest_match) || (len > name_len)) {
+		if (len > name_len) {
 			continue;
 		}
 
@@ -111,11 +165,37 @@ static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 
 		/* Check for mount point match */
 		if (strncmp(name, itr->mnt_point, len) == 0) {
-			mnt_p = itr;
-			longest_match = len;
+			return itr;
 		}
 	}
-	k_mutex_unlock(&mutex);
+
+	return NULL;
+}
+
+/*
+ * Get the mount point of a path, with a reference that keeps it mounted
+ * until released with fs_put_mnt_point().
+ */
+static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
+			    const char *name, size_t *match_len)
+{
+	struct fs_mount_t *mnt_p;
+	size_t name_len = strlen(name);
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&mnt_lock);
+
+	mnt_p = fs_mnt_find(fs_mnt_bucket(name), name, name_len);
+	if (mnt_p == NULL) {
+		/* Fall back to a file system mounted at "/" */
+		mnt_p = fs_mnt_find(fs_mnt_bucket("/"), "/", 1);
+	}
+
+	if (mnt_p != NULL) {
+		atomic_inc(&mnt_p->refs);
+	}
+
+	k_spin_unlock(&mnt_lock, key);
 
 	if (mnt_p == NULL) {
 		return -ENOENT;
@@ -129,6 +209,13 @@ static int fs_get_mnt_point(struct fs_mount_t **mnt_pntp,
 	return 0;
 }
 
+static inline void fs_put_mnt_point(struct fs_mount_t *mp)
+{
+	if ((atomic_dec(&mp->refs) == 1) && (atomic_ptr_get(&unmount_mp) == mp)) {
+		k_sem_give(&unmount_sem);
+	}
+}
+
 /* File operations */
 int fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
 {
@@ -154,22 +241,26 @@ int fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
 
 	if (((mp->flags & FS_MOUNT_FLAG_READ_ONLY) != 0) &&
 	    (flags & FS_O_CREATE || flags & FS_O_WRITE)) {
-		return -EROFS;
+		rc = -EROFS;
+		goto open_err;
 	}
 
 	CHECKIF(mp->fs->open == NULL) {
-		return -ENOTSUP;
+		rc = -ENOTSUP;
+		goto open_err;
 	}
 
 	if ((flags & FS_O_TRUNC) != 0) {
 		if ((flags & FS_O_WRITE) == 0) {
 			/** Truncate not allowed when file is not opened for write */
 			LOG_ERR("file should be opened for write to truncate!!");
-			return -EACCES;
+			rc = -EACCES;
+			goto open_err;
 		}
 		CHECKIF(mp->fs->truncate == NULL) {
 			LOG_ERR("file truncation not supported!!");
-			return -ENOTSUP;
+			rc = -ENOTSUP;
+			goto open_err;
 		}
 		truncate_file = true;
 	}
@@ -179,7 +270,7 @@ int fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
 	if (rc < 0) {
 		LOG_ERR("file open error (%d)", rc);
 		zfp->mp = NULL;
-		return rc;
+		goto open_err;
 	}
 
 	/* Copy flags to zfp for use with other fs_ API calls */
@@ -191,10 +282,11 @@ int fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
 		if (rc < 0) {
 			LOG_ERR("file truncation failed (%d)", rc);
 			zfp->mp = NULL;
-			return rc;
 		}
 	}
 
+open_err:
+	fs_put_mnt_point(mp);
 	return rc;
 }
 
@@ -360,12 +452,12 @@ int fs_opendir(struct fs_dir_t *zdp, const char *abs_path)
 
 	if (strcmp(abs_path, "/") == 0) {
 		/* Open VFS root dir, marked by zdp->mp == NULL */
-		k_mutex_lock(&mutex, K_FOREVER);
+		k_spinlock_key_t key = k_spin_lock(&mnt_lock);
 
 		zdp->mp = NULL;
 		zdp->dirp = sys_dlist_peek_head(&fs_mnt_list);
 
-		k_mutex_unlock(&mutex);
+		k_spin_unlock(&mnt_lock, key);
 
 		return 0;
 	}
@@ -377,6 +469,7 @@ int fs_opendir(struct fs_dir_t *zdp, const char *abs_path)
 	}
 
 	CHECKIF(mp->fs->opendir == NULL) {
+		fs_put_mnt_point(mp);
 		return -ENOTSUP;
 	}
 
@@ -388,6 +481,7 @@ int fs_opendir(struct fs_dir_t *zdp, const char *abs_path)
 		LOG_ERR("directory open error (%d)", rc);
 	}
 
+	fs_put_mnt_point(mp);
 	return rc;
 }
 
@@ -435,8 +529,7 @@ int fs_readdir(struct fs_dir_t *zdp, struct fs_dirent *entry)
 	/* Find the current and next entries in the mount point dlist */
 	sys_dnode_t *node, *next = NULL;
 	bool found = false;
-
-	k_mutex_lock(&mutex, K_FOREVER);
+	k_spinlock_key_t key = k_spin_lock(&mnt_lock);
 
 	SYS_DLIST_FOR_EACH_NODE(&fs_mnt_list, node) {
 		if (node == zdp->dirp) {
@@ -459,7 +552,7 @@ int fs_readdir(struct fs_dir_t *zdp, struct fs_dirent *entry)
 		}
 	}
 
-	k_mutex_unlock(&mutex);
+	k_spin_unlock(&mnt_lock, key);
 
 	if (!found) {
 		/* Current entry must have been removed before this
@@ -516,11 +609,13 @@ int fs_mkdir(const char *abs_path)
 	}
 
 	if (mp->flags & FS_MOUNT_FLAG_READ_ONLY) {
-		return -EROFS;
+		rc = -EROFS;
+		goto mkdir_err;
 	}
 
 	CHECKIF(mp->fs->mkdir == NULL) {
-		return -ENOTSUP;
+		rc = -ENOTSUP;
+		goto mkdir_err;
 	}
 
 	rc = mp->fs->mkdir(mp, abs_path);
@@ -528,6 +623,8 @@ int fs_mkdir(const char *abs_path)
 		LOG_ERR("failed to create directory (%d)", rc);
 	}
 
+mkdir_err:
+	fs_put_mnt_point(mp);
 	return rc;
 }
 
@@ -549,11 +646,13 @@ int fs_unlink(const char *abs_path)
 	}
 
 	if (mp->flags & FS_MOUNT_FLAG_READ_ONLY) {
-		return -EROFS;
+		rc = -EROFS;
+		goto unlink_err;
 	}
 
 	CHECKIF(mp->fs->unlink == NULL) {
-		return -ENOTSUP;
+		rc = -ENOTSUP;
+		goto unlink_err;
 	}
 
 	rc = mp->fs->unlink(mp, abs_path);
@@ -561,6 +660,8 @@ int fs_unlink(const char *abs_path)
 		LOG_ERR("failed to unlink path (%d)", rc);
 	}
 
+unlink_err:
+	fs_put_mnt_point(mp);
 	return rc;
 }
 
@@ -583,17 +684,20 @@ int fs_rename(const char *from, const char *to)
 	}
 
 	if (mp->flags & FS_MOUNT_FLAG_READ_ONLY) {
-		return -EROFS;
+		rc = -EROFS;
+		goto rename_err;
 	}
 
 	/* Make sure both files are mounted on the same path */
 	if (strncmp(from, to, match_len) != 0) {
 		LOG_ERR("mount point not same!!");
-		return -EINVAL;
+		rc = -EINVAL;
+		goto rename_err;
 	}
 
 	CHECKIF(mp->fs->rename == NULL) {
-		return -ENOTSUP;
+		rc = -ENOTSUP;
+		goto rename_err;
 	}
 
 	rc = mp->fs->rename(mp, from, to);
@@ -601,6 +705,8 @@ int fs_rename(const char *from, const char *to)
 		LOG_ERR("failed to rename file or dir (%d)", rc);
 	}
 
+rename_err:
+	fs_put_mnt_point(mp);
 	return rc;
 }
 
@@ -622,6 +728,7 @@ int fs_stat(const char *abs_path, struct fs_dirent *entry)
 	}
 
 	CHECKIF(mp->fs->stat == NULL) {
+		fs_put_mnt_point(mp);
 		return -ENOTSUP;
 	}
 
@@ -631,6 +738,8 @@ int fs_stat(const char *abs_path, struct fs_dirent *entry)
 	} else if (rc < 0) {
 		LOG_ERR("failed get file or dir stat (%d)", rc);
 	}
+
+	fs_put_mnt_point(mp);
 	return rc;
 }
 
@@ -652,6 +761,7 @@ int fs_statvfs(const char *abs_path, struct fs_statvfs *stat)
 	}
 
 	CHECKIF(mp->fs->statvfs == NULL) {
+		fs_put_mnt_point(mp);
 		return -ENOTSUP;
 	}
 
@@ -660,6 +770,7 @@ int fs_statvfs(const char *abs_path, struct fs_statvfs *stat)
 		LOG_ERR("failed get file or dir stat (%d)", rc);
 	}
 
+	fs_put_mnt_point(mp);
 	return rc;
 }
 
@@ -667,6 +778,7 @@ int fs_mount(struct fs_mount_t *mp)
 {
 	struct fs_mount_t *itr;
 	const struct fs_file_system_t *fs;
+	k_spinlock_key_t key;
 	sys_dnode_t *node;
 	int rc = -EINVAL;
 	size_t len = 0;
@@ -739,11 +851,16 @@ int fs_mount(struct fs_mount_t *mp)
 		goto mount_err;
 	}
 
-	/* Update mount point data and append it to the list */
+	/* Update mount point data and append it to the list and index */
 	mp->mountp_len = len;
 	mp->fs = fs;
+	atomic_clear(&mp->refs);
 
+	key = k_spin_lock(&mnt_lock);
 	sys_dlist_append(&fs_mnt_list, &mp->node);
+	fs_mnt_index_add(mp);
+	k_spin_unlock(&mnt_lock, key);
+
 	LOG_DBG("fs mounted at %s", mp->mnt_point);
 
 mount_err:
@@ -790,12 +907,14 @@ mount_err:
 
 int fs_unmount(struct fs_mount_t *mp)
 {
+	k_spinlock_key_t key;
 	int rc = -EINVAL;
 
 	if (mp == NULL) {
 		return rc;
 	}
 
+	k_mutex_lock(&unmount_mutex, K_FOREVER);
 	k_mutex_lock(&mutex, K_FOREVER);
 
 	if (!sys_dnode_is_linked(&mp->node)) {
@@ -809,18 +928,47 @@ int fs_unmount(struct fs_mount_t *mp)
 		goto unmount_err;
 	}
 
+	/* Stop new lookups and wait for the path operations in progress. The
+	 * mount point stays in the list meanwhile, so it cannot be mounted
+	 * again, while other mount points can be mounted.
+	 */
+	k_sem_reset(&unmount_sem);
+	atomic_ptr_set(&unmount_mp, mp);
+
+	key = k_spin_lock(&mnt_lock);
+	fs_mnt_index_remove(mp);
+	k_spin_unlock(&mnt_lock, key);
+
+	k_mutex_unlock(&mutex);
+	while (atomic_get(&mp->refs) != 0) {
+		k_sem_take(&unmount_sem, K_FOREVER);
+	}
+	k_mutex_lock(&mutex, K_FOREVER);
+
+	atomic_ptr_clear(&unmount_mp);
+
 	rc = mp->fs->unmount(mp);
+
+	key = k_spin_lock(&mnt_lock);
+	if (rc < 0) {
+		/* still mounted, make it available again */
+		fs_mnt_index_add(mp);
+	} else {
+		/* remove mount node from the list */
+		sys_dlist_remove(&mp->node);
+	}
+	k_spin_unlock(&mnt_lock, key);
+
 	if (rc < 0) {
 		LOG_ERR("fs unmount error (%d)", rc);
 		goto unmount_err;
 	}
 
-	/* remove mount node from the list */
-	sys_dlist_remove(&mp->node);
 	LOG_DBG("fs unmounted from %s", mp->mnt_point);
 
 unmount_err:
 	k_mutex_unlock(&mutex);
+	k_mutex_unlock(&unmount_mutex);
 	return rc;
 }
 
@@ -830,10 +978,11 @@ int fs_readmount(int *index, const char **name)
 	int rc = -ENOENT;
 	int cnt = 0;
 	struct fs_mount_t *itr = NULL;
+	k_spinlock_key_t key;
 
 	*name = NULL;
 
-	k_mutex_lock(&mutex, K_FOREVER);
+	key = k_spin_lock(&mnt_lock);
 
 	SYS_DLIST_FOR_EACH_NODE(&fs_mnt_list, node) {
 		if (*index == cnt) {
@@ -844,7 +993,7 @@ int fs_readmount(int *index, const char **name)
 		++cnt;
 	}
 
-	k_mutex_unlock(&mutex);
+	k_spin_unlock(&mnt_lock, key);
 
 	if (itr != NULL) {
 		rc = 0;
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_rtio.h>
+#include <zephyr/rtio/work.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_DECLARE(fs);
+
+static void fs_rtio_next(struct fs_rtio_file *file, bool completion);
+
+static int fs_rtio_exec(struct fs_rtio_file *file, struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	uint32_t max_len = 1;
+	uint32_t buf_len;
+	uint8_t *buf;
+	int rc;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+#ifdef CONFIG_RTIO_SYS_MEM_BLOCKS
+		/* reads into the memory pool fill at most one block */
+		max_len = MAX(rtio_mempool_block_size(iodev_sqe->r), 1);
+#endif
+		rc = rtio_sqe_rx_buf(iodev_sqe, 1, max_len, &buf, &buf_len);
+		if (rc < 0) {
+			return rc;
+		}
+
+		return fs_read(file->zfp, buf, buf_len);
+	case RTIO_OP_TX:
+		return fs_write(file->zfp, sqe->tx.buf, sqe->tx.buf_len);
+	case RTIO_OP_TINY_TX:
+		return fs_write(file->zfp, sqe->tiny_tx.buf, sqe->tiny_tx.buf_len);
+	case RTIO_OP_NOP:
+		if (sqe->iodev_flags & FS_RTIO_SYNC) {
+			return fs_sync(file->zfp);
+		}
+
+		return 0;
+	case RTIO_OP_CALLBACK:
+		sqe->callback.callback(iodev_sqe->r, sqe, sqe->callback.arg0);
+		return 0;
+	default:
+		return -ENOTSUP;
+	}
+}
+
+/* Run a submission and the rest of its transaction, on a RTIO work queue thread */
+static void fs_rtio_run(struct fs_rtio_file *file, struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_iodev_sqe *curr = iodev_sqe;
+	int rc;
+
+	/* the operations of a transaction complete together */
+	do {
+		rc = fs_rtio_exec(file, curr);
+		curr = rtio_txn_next(curr);
+	} while ((rc >= 0) && (curr != NULL));
+
+	if (rc < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	} else {
+		rtio_iodev_sqe_ok(iodev_sqe, rc);
+	}
+}
+
+static void fs_rtio_work(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct fs_rtio_file *file = iodev_sqe->sqe.iodev->data;
+
+	fs_rtio_run(file, iodev_sqe);
+	fs_rtio_next(file, true);
+}
+
+/* Hand the next queued submission of the file to the work queue, unless one
+ * is in progress. A file has a single submission in progress at a time so that
+ * its operations run in order.
+ *
+ * On completion of a submission, the next one runs on the same work queue
+ * thread when no work item is free. Only a submission to an idle file fails
+ * for lack of a work item, before this function returns to the submitter.
+ */
+static void fs_rtio_next(struct fs_rtio_file *file, bool completion)
+{
+	struct rtio_iodev_sqe *iodev_sqe;
+	struct rtio_work_req *req;
+	struct mpsc_node *node;
+	k_spinlock_key_t key;
+	bool owner = completion;
+
+	while (true) {
+		key = k_spin_lock(&file->lock);
+
+		if (!owner && file->busy) {
+			k_spin_unlock(&file->lock, key);
+			return;
+		}
+
+		node = mpsc_pop(&file->io_q);
+		file->busy = (node != NULL);
+		k_spin_unlock(&file->lock, key);
+
+		if (node == NULL) {
+			return;
+		}
+
+		owner = true;
+		iodev_sqe = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+
+		req = rtio_work_req_alloc();
+		if (req != NULL) {
+			rtio_work_req_submit(req, iodev_sqe, fs_rtio_work);
+			return;
+		}
+
+		if (completion) {
+			fs_rtio_run(file, iodev_sqe);
+			continue;
+		}
+
+		LOG_ERR("RTIO work item allocation failed. Consider to increase "
+			"CONFIG_RTIO_WORKQ_POOL_ITEMS.");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+	}
+}
+
+static void fs_rtio_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct fs_rtio_file *file = iodev_sqe->sqe.iodev->data;
+
+	mpsc_push(&file->io_q, &iodev_sqe->q);
+	fs_rtio_next(file, false);
+}
+
+static const struct rtio_iodev_api fs_rtio_api = {
+	.submit = fs_rtio_submit,
+};
+
+void fs_rtio_file_init(struct fs_rtio_file *file, struct fs_file_t *zfp)
+{
+	file->iodev.api = &fs_rtio_api;
+	file->iodev.data = file;
+	file->zfp = zfp;
+	file->busy = false;
+	mpsc_init(&file->io_q);
+}
@@ -88,9 +88,17 @@ static inline void fc_release(void *buf)
 	k_heap_free(&file_cache_heap, buf);
 }
 
-static inline void fs_lock(struct fs_littlefs *fs)
+static inline void fs_lock(struct fs_littlefs *fs, enum fs_littlefs_op op)
 {
 	k_mutex_lock(&fs->mutex, K_FOREVER);
+
+#ifdef CONFIG_FS_LITTLEFS_STATS
+	/* block accesses are accounted to the operation holding the lock */
+	fs->op = op;
+	fs->stats[op].count++;
+#else
+	ARG_UNUSED(op);
+#endif
 }
 
 static inline void fs_unlock(struct fs_littlefs *fs)
@@ -168,6 +176,38 @@ static int errno_to_lfs(int error)
 	}
 }
 
+#ifdef CONFIG_FS_LITTLEFS_STATS
+static inline struct fs_littlefs_op_stats *lfs_api_stats(const struct lfs_config *c)
+{
+	struct fs_littlefs *fs = CONTAINER_OF(c, struct fs_littlefs, cfg);
+
+	return &fs->stats[fs->op];
+}
+#endif
+
+static inline void lfs_api_count_read(const struct lfs_config *c, lfs_size_t size)
+{
+#ifdef CONFIG_FS_LITTLEFS_STATS
+	struct fs_littlefs_op_stats *stats = lfs_api_stats(c);
+
+	stats->reads++;
+	stats->read_bytes += size;
+#endif
+}
+
+static inline void lfs_api_count_prog(const struct lfs_config *c)
+{
+#ifdef CONFIG_FS_LITTLEFS_STATS
+	lfs_api_stats(c)->progs++;
+#endif
+}
+
+static inline void lfs_api_count_erase(const struct lfs_config *c)
+{
+#ifdef CONFIG_FS_LITTLEFS_STATS
+	lfs_api_stats(c)->erases++;
+#endif
+}
 
 #ifdef CONFIG_FS_LITTLEFS_FMP_DEV
 
@@ -177,6 +217,8 @@ static int lfs_api_read(const struct lfs_config *c, lfs_block_t block,
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+	lfs_api_count_read(c, size);
+
 	int rc = flash_area_read(fa, offset, buffer, size);
 
 	return errno_to_lfs(rc);
@@ -188,6 +230,8 @@ static int lfs_api_prog(const struct lfs_config *c, lfs_block_t block,
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size + off;
 
+	lfs_api_count_prog(c);
+
 	int rc = flash_area_write(fa, offset, buffer, size);
 
 	return errno_to_lfs(rc);
@@ -198,6 +242,8 @@ static int lfs_api_erase(const struct lfs_config *c, lfs_block_t block)
 	const struct flash_area *fa = c->context;
 	size_t offset = block * c->block_size;
 
+	lfs_api_count_erase(c);
+
 	int rc = flash_area_flatten(fa, offset, c->block_size);
 
 	return errno_to_lfs(rc);
@@ -209,6 +255,9 @@ static int lfs_api_read_blk(const struct lfs_config *c, lfs_block_t block,
 			    lfs_off_t off, void *buffer, lfs_size_t size)
 {
 	const char *disk = c->context;
+
+	lfs_api_count_read(c, size);
+
 	int rc = disk_access_read(disk, buffer, block,
 				  size / c->block_size);
 
@@ -219,6 +268,9 @@ static int lfs_api_prog_blk(const struct lfs_config *c, lfs_block_t block,
 			    lfs_off_t off, const void *buffer, lfs_size_t size)
 {
 	const char *disk = c->context;
+
+	lfs_api_count_prog(c);
+
 	int rc = disk_access_write(disk, buffer, block, size / c->block_size);
 
 	return errno_to_lfs(rc);
@@ -311,7 +363,7 @@ static int littlefs_open(struct fs_file_t *fp, const char *path,
 	fdp->config.buffer = fdp->cache_block;
 	path = fs_impl_strip_prefix(path, fp->mp);
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_OPEN);
 
 	ret = lfs_file_opencfg(&fs->lfs, &fdp->file,
 			       path, flags, &fdp->config);
@@ -329,7 +381,7 @@ static int littlefs_close(struct fs_file_t *fp)
 {
 	struct fs_littlefs *fs = fp->mp->fs_data;
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_OPEN);
 
 	int ret = lfs_file_close(&fs->lfs, LFS_FILEP(fp));
 
@@ -346,7 +398,7 @@ static int littlefs_unlink(struct fs_mount_t *mountp, const char *path)
 
 	path = fs_impl_strip_prefix(path, mountp);
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_DIR);
 
 	int ret = lfs_remove(&fs->lfs, path);
 
@@ -362,7 +414,7 @@ static int littlefs_rename(struct fs_mount_t *mountp, const char *from,
 	from = fs_impl_strip_prefix(from, mountp);
 	to = fs_impl_strip_prefix(to, mountp);
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_DIR);
 
 	int ret = lfs_rename(&fs->lfs, from, to);
 
@@ -374,7 +426,7 @@ static ssize_t littlefs_read(struct fs_file_t *fp, void *ptr, size_t len)
 {
 	struct fs_littlefs *fs = fp->mp->fs_data;
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_READ);
 
 	ssize_t ret = lfs_file_read(&fs->lfs, LFS_FILEP(fp), ptr, len);
 
@@ -386,7 +438,7 @@ static ssize_t littlefs_write(struct fs_file_t *fp, const void *ptr, size_t len)
 {
 	struct fs_littlefs *fs = fp->mp->fs_data;
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_WRITE);
 
 	ssize_t ret = lfs_file_write(&fs->lfs, LFS_FILEP(fp), ptr, len);
 
@@ -402,7 +454,7 @@ static int littlefs_seek(struct fs_file_t *fp, off_t off, int whence)
 {
 	struct fs_littlefs *fs = fp->mp->fs_data;
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_SEEK);
 
 	off_t ret = lfs_file_seek(&fs->lfs, LFS_FILEP(fp), off, whence);
 
@@ -419,7 +471,7 @@ static off_t littlefs_tell(struct fs_file_t *fp)
 {
 	struct fs_littlefs *fs = fp->mp->fs_data;
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_SEEK);
 
 	off_t ret = lfs_file_tell(&fs->lfs, LFS_FILEP(fp));
 
@@ -431,7 +483,7 @@ static int littlefs_truncate(struct fs_file_t *fp, off_t length)
 {
 	struct fs_littlefs *fs = fp->mp->fs_data;
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_WRITE);
 
 	int ret = lfs_file_truncate(&fs->lfs, LFS_FILEP(fp), length);
 
@@ -443,7 +495,7 @@ static int littlefs_sync(struct fs_file_t *fp)
 {
 	struct fs_littlefs *fs = fp->mp->fs_data;
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_SYNC);
 
 	int ret = lfs_file_sync(&fs->lfs, LFS_FILEP(fp));
 
@@ -456,7 +508,7 @@ static int littlefs_mkdir(struct fs_mount_t *mountp, const char *path)
 	struct fs_littlefs *fs = mountp->fs_data;
 
 	path = fs_impl_strip_prefix(path, mountp);
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_DIR);
 
 	int ret = lfs_mkdir(&fs->lfs, path);
 
@@ -476,7 +528,7 @@ static int littlefs_opendir(struct fs_dir_t *dp, const char *path)
 
 	path = fs_impl_strip_prefix(path, dp->mp);
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_DIR);
 
 	int ret = lfs_dir_open(&fs->lfs, dp->dirp, path);
 
@@ -502,7 +554,7 @@ static int littlefs_readdir(struct fs_dir_t *dp, struct fs_dirent *entry)
 {
 	struct fs_littlefs *fs = dp->mp->fs_data;
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_DIR);
 
 	struct lfs_info info;
 	int ret = lfs_dir_read(&fs->lfs, dp->dirp, &info);
@@ -523,7 +575,7 @@ static int littlefs_closedir(struct fs_dir_t *dp)
 {
 	struct fs_littlefs *fs = dp->mp->fs_data;
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_DIR);
 
 	int ret = lfs_dir_close(&fs->lfs, dp->dirp);
 
@@ -541,7 +593,7 @@ static int littlefs_stat(struct fs_mount_t *mountp,
 
 	path = fs_impl_strip_prefix(path, mountp);
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_STAT);
 
 	struct lfs_info info;
 	int ret = lfs_stat(&fs->lfs, path, &info);
@@ -568,7 +620,7 @@ static int littlefs_statvfs(struct fs_mount_t *mountp,
 
 	path = fs_impl_strip_prefix(path, mountp);
 
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_STAT);
 
 	ssize_t ret = lfs_fs_size(lfs);
 
@@ -830,16 +882,21 @@ static int littlefs_init_cfg(struct fs_littlefs *fs, int flags)
 	}
 #endif /* CONFIG_FS_LITTLEFS_FMP_DEV */
 
+#ifdef CONFIG_FS_LITTLEFS_PROFILE
+	if (lookahead_size == FS_LITTLEFS_LOOKAHEAD_ALL) {
+		/* one bit per block, in multiples of 8 bytes */
+		lookahead_size = ROUND_UP(DIV_ROUND_UP(block_count, 8U), 8U);
+		LOG_INF("lookahead of all blocks: la %u", lookahead_size);
+	}
+#endif /* CONFIG_FS_LITTLEFS_PROFILE */
+
 	__ASSERT_NO_MSG(prog_size != 0);
 	__ASSERT_NO_MSG(read_size != 0);
-	__ASSERT_NO_MSG(cache_size != 0);
 	__ASSERT_NO_MSG(block_size != 0);
 	__ASSERT_NO_MSG(block_count != 0);
 
 	__ASSERT((block_size % prog_size) == 0,
 		 "erase size must be multiple of write size");
-	__ASSERT((block_size % cache_size) == 0,
-		 "cache size incompatible with block size");
 
 	lcp->context = fs->backend;
 	/* Set the validated/defaulted values. */
@@ -881,6 +938,15 @@ static int littlefs_init_cfg(struct fs_littlefs *fs, int flags)
 		lcp->sync = lfs_api_sync;
 	}
 
+	/* The cache size may come from a runtime profile */
+	if ((lcp->cache_size == 0) || ((block_size % lcp->cache_size) != 0) ||
+	    ((lcp->cache_size % lcp->read_size) != 0) ||
+	    ((lcp->cache_size % lcp->prog_size) != 0)) {
+		LOG_ERR("Cache size %u incompatible with rd %u ; pr %u ; block %u",
+			lcp->cache_size, lcp->read_size, lcp->prog_size, block_size);
+		return -EINVAL;
+	}
+
 #ifdef CONFIG_FS_LITTLEFS_DISK_VERSION
 	lcp->disk_version = disk_version;
 	LOG_INF("partition disk version: %u.%u",
@@ -894,6 +960,159 @@ static int littlefs_init_cfg(struct fs_littlefs *fs, int flags)
 	return 0;
 }
 
+#ifdef CONFIG_FS_LITTLEFS_PROFILE
+
+/* lfs_fs_gc() is available from littlefs v2.8 */
+#define LITTLEFS_HAS_FS_GC (LFS_VERSION >= 0x00020008)
+
+static bool littlefs_profile_is_set(const struct fs_littlefs_profile *profile)
+{
+	return (profile->cache_size != 0) || (profile->lookahead_size != 0) ||
+	       (profile->block_cycles != 0);
+}
+
+/* Override the configuration with the profile, before it is validated. */
+static void littlefs_profile_apply(struct fs_littlefs *fs)
+{
+	const struct fs_littlefs_profile *profile = &fs->profile;
+	struct lfs_config *lcp = &fs->cfg;
+
+	fs->profile_applied = littlefs_profile_is_set(profile);
+	if (!fs->profile_applied) {
+		return;
+	}
+
+	fs->base_cfg = *lcp;
+
+	if (profile->cache_size != 0) {
+		lcp->cache_size = profile->cache_size;
+	}
+	if (profile->lookahead_size != 0) {
+		lcp->lookahead_size = profile->lookahead_size;
+	}
+	if (profile->block_cycles != 0) {
+		lcp->block_cycles = profile->block_cycles;
+	}
+}
+
+/* Allocate the buffers resized by the profile from the file cache pool. */
+static int littlefs_profile_alloc(struct fs_littlefs *fs)
+{
+	const struct fs_littlefs_profile *profile = &fs->profile;
+	struct lfs_config *lcp = &fs->cfg;
+	size_t lookahead_len = 0;
+	size_t cache_len = 0;
+	uint8_t *buf;
+
+	if (!fs->profile_applied) {
+		return 0;
+	}
+
+	if (profile->lookahead_size != 0) {
+		lookahead_len = lcp->lookahead_size;
+	}
+	if (profile->cache_size != 0) {
+		cache_len = 2 * lcp->cache_size;
+	}
+	if ((lookahead_len + cache_len) == 0) {
+		return 0;
+	}
+
+	buf = k_heap_aligned_alloc(&file_cache_heap, sizeof(uint64_t),
+				   lookahead_len + cache_len, K_NO_WAIT);
+	if (buf == NULL) {
+		LOG_ERR("can't allocate %zu bytes of profile caches",
+			lookahead_len + cache_len);
+		return -ENOMEM;
+	}
+
+	fs->pool_buffer = buf;
+
+	/* The lookahead bitmap goes first, its size is a multiple of 8 */
+	if (lookahead_len != 0) {
+		lcp->lookahead_buffer = buf;
+		buf += lookahead_len;
+	}
+	if (cache_len != 0) {
+		lcp->read_buffer = buf;
+		lcp->prog_buffer = buf + lcp->cache_size;
+	}
+
+	return 0;
+}
+
+/* Release the profile caches and restore the configuration. */
+static void littlefs_profile_release(struct fs_littlefs *fs)
+{
+	if (!fs->profile_applied) {
+		return;
+	}
+
+	fc_release(fs->pool_buffer);
+	fs->pool_buffer = NULL;
+	fs->cfg = fs->base_cfg;
+	fs->profile_applied = false;
+}
+
+#if LITTLEFS_HAS_FS_GC
+static void littlefs_scan_work(struct k_work *work)
+{
+	struct fs_littlefs *fs = CONTAINER_OF(work, struct fs_littlefs, scan_work);
+	int ret;
+
+	fs_lock(fs, FS_LITTLEFS_OP_SCAN);
+	ret = lfs_fs_gc(&fs->lfs);
+	fs_unlock(fs);
+
+	if (ret < 0) {
+		LOG_WRN("lookahead scan failed (LFS %d)", ret);
+	}
+}
+#endif /* LITTLEFS_HAS_FS_GC */
+
+static void littlefs_scan_start(struct fs_littlefs *fs, int flags)
+{
+#if LITTLEFS_HAS_FS_GC
+	k_work_init(&fs->scan_work, littlefs_scan_work);
+
+	if (fs->profile.background_scan && ((flags & FS_MOUNT_FLAG_READ_ONLY) == 0)) {
+		k_work_submit(&fs->scan_work);
+	}
+#endif /* LITTLEFS_HAS_FS_GC */
+}
+
+static void littlefs_scan_stop(struct fs_littlefs *fs)
+{
+#if LITTLEFS_HAS_FS_GC
+	struct k_work_sync sync;
+
+	(void)k_work_cancel_sync(&fs->scan_work, &sync);
+#endif /* LITTLEFS_HAS_FS_GC */
+}
+
+#else
+static inline void littlefs_profile_apply(struct fs_littlefs *fs)
+{
+}
+
+static inline int littlefs_profile_alloc(struct fs_littlefs *fs)
+{
+	return 0;
+}
+
+static inline void littlefs_profile_release(struct fs_littlefs *fs)
+{
+}
+
+static inline void littlefs_scan_start(struct fs_littlefs *fs, int flags)
+{
+}
+
+static inline void littlefs_scan_stop(struct fs_littlefs *fs)
+{
+}
+#endif /* CONFIG_FS_LITTLEFS_PROFILE */
+
 static int littlefs_init_fs(struct fs_littlefs *fs, void *dev_id, int flags)
 {
 	int ret = 0;
@@ -911,11 +1130,18 @@ static int littlefs_init_fs(struct fs_littlefs *fs, void *dev_id, int flags)
 		return ret;
 	}
 
+	littlefs_profile_apply(fs);
+
 	ret = littlefs_init_cfg(fs, flags);
+	if (ret == 0) {
+		ret = littlefs_profile_alloc(fs);
+	}
+
 	if (ret < 0) {
-		return ret;
+		littlefs_profile_release(fs);
 	}
-	return 0;
+
+	return ret;
 }
 
 static int littlefs_mount(struct fs_mount_t *mountp)
@@ -925,13 +1151,19 @@ static int littlefs_mount(struct fs_mount_t *mountp)
 
 	/* Create and take mutex. */
 	k_mutex_init(&fs->mutex);
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_MOUNT);
 
 	ret = littlefs_init_fs(fs, mountp->storage_dev, mountp->flags);
 	if (ret < 0) {
 		goto out;
 	}
 
+#ifdef CONFIG_FS_LITTLEFS_STATS
+	/* Count the accesses from this mount on */
+	memset(fs->stats, 0, sizeof(fs->stats));
+	fs->stats[FS_LITTLEFS_OP_MOUNT].count = 1;
+#endif
+
 	/* Mount it, formatting if needed. */
 	ret = lfs_mount(&fs->lfs, &fs->cfg);
 	if (ret < 0 &&
@@ -942,30 +1174,36 @@ static int littlefs_mount(struct fs_mount_t *mountp)
 			if (ret < 0) {
 				LOG_ERR("format failed (LFS %d)", ret);
 				ret = lfs_to_errno(ret);
-				goto out;
+				goto out_release;
 			}
 		} else {
 			LOG_ERR("can not format read-only system");
 			ret = -EROFS;
-			goto out;
+			goto out_release;
 		}
 
 		ret = lfs_mount(&fs->lfs, &fs->cfg);
 		if (ret < 0) {
 			LOG_ERR("remount after format failed (LFS %d)", ret);
 			ret = lfs_to_errno(ret);
-			goto out;
+			goto out_release;
 		}
 	} else {
 		ret = lfs_to_errno(ret);
-		goto out;
+		goto out_release;
 	}
 
 	LOG_INF("%s mounted", mountp->mnt_point);
 
+out_release:
+	if (ret < 0) {
+		littlefs_profile_release(fs);
+	}
 out:
 	if (ret < 0) {
 		fs->backend = NULL;
+	} else {
+		littlefs_scan_start(fs, mountp->flags);
 	}
 
 	fs_unlock(fs);
@@ -990,7 +1228,7 @@ static int littlefs_mkfs(uintptr_t dev_id, void *cfg, int flags)
 
 	/* Create and take mutex. */
 	k_mutex_init(&fs->mutex);
-	fs_lock(fs);
+	fs_lock(fs, FS_LITTLEFS_OP_MOUNT);
 
 	ret = littlefs_init_fs(fs, UINT_TO_POINTER(dev_id), flags);
 	if (ret < 0) {
@@ -1004,6 +1242,7 @@ static int littlefs_mkfs(uintptr_t dev_id, void *cfg, int flags)
 		goto out;
 	}
 out:
+	littlefs_profile_release(fs);
 	fs->backend = NULL;
 	fs_unlock(fs);
 	return ret;
@@ -1015,7 +1254,9 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 {
 	struct fs_littlefs *fs = mountp->fs_data;
 
-	fs_lock(fs);
+	littlefs_scan_stop(fs);
+
+	fs_lock(fs, FS_LITTLEFS_OP_MOUNT);
 
 	lfs_unmount(&fs->lfs);
 
@@ -1025,6 +1266,7 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 	}
 #endif /* CONFIG_FS_LITTLEFS_FMP_DEV */
 
+	littlefs_profile_release(fs);
 	fs->backend = NULL;
 	fs_unlock(fs);
 
@@ -1033,6 +1275,87 @@ static int littlefs_unmount(struct fs_mount_t *mountp)
 	return 0;
 }
 
+#ifdef CONFIG_FS_LITTLEFS_PROFILE
+int fs_littlefs_profile_set(struct fs_mount_t *mp, const struct fs_littlefs_profile *profile)
+{
+	static const struct fs_littlefs_profile no_profile;
+	struct fs_littlefs *fs;
+	lfs_size_t read_size;
+	lfs_size_t prog_size;
+
+	if ((mp == NULL) || (mp->type != FS_LITTLEFS) || (mp->fs_data == NULL)) {
+		return -EINVAL;
+	}
+
+	if (profile == NULL) {
+		profile = &no_profile;
+	}
+
+	fs = mp->fs_data;
+
+	/* The block size may only be known once mounted, the mount checks it again */
+	if (profile->cache_size != 0) {
+		read_size = (fs->cfg.read_size != 0) ? fs->cfg.read_size
+						     : CONFIG_FS_LITTLEFS_READ_SIZE;
+		prog_size = (fs->cfg.prog_size != 0) ? fs->cfg.prog_size
+						     : CONFIG_FS_LITTLEFS_PROG_SIZE;
+
+		if (((profile->cache_size % read_size) != 0) ||
+		    ((profile->cache_size % prog_size) != 0) ||
+		    ((fs->cfg.block_size != 0) &&
+		     ((fs->cfg.block_size % profile->cache_size) != 0))) {
+			return -EINVAL;
+		}
+	}
+
+	if ((profile->lookahead_size != FS_LITTLEFS_LOOKAHEAD_ALL) &&
+	    ((profile->lookahead_size % 8) != 0)) {
+		return -EINVAL;
+	}
+
+	if (!LITTLEFS_HAS_FS_GC && profile->background_scan) {
+		return -ENOTSUP;
+	}
+
+	if (fs->backend != NULL) {
+		return -EBUSY;
+	}
+
+	fs->profile = *profile;
+
+	return 0;
+}
+#endif /* CONFIG_FS_LITTLEFS_PROFILE */
+
+#ifdef CONFIG_FS_LITTLEFS_STATS
+int fs_littlefs_stats_get(struct fs_mount_t *mp,
+			  struct fs_littlefs_op_stats stats[FS_LITTLEFS_OP_COUNT], bool reset)
+{
+	struct fs_littlefs *fs;
+
+	if ((mp == NULL) || (mp->type != FS_LITTLEFS) || (mp->fs_data == NULL)) {
+		return -EINVAL;
+	}
+
+	fs = mp->fs_data;
+	if (fs->backend == NULL) {
+		return -ENODEV;
+	}
+
+	/* not fs_lock(), that would count as an operation */
+	k_mutex_lock(&fs->mutex, K_FOREVER);
+
+	memcpy(stats, fs->stats, sizeof(fs->stats));
+	if (reset) {
+		memset(fs->stats, 0, sizeof(fs->stats));
+	}
+
+	k_mutex_unlock(&fs->mutex);
+
+	return 0;
+}
+#endif /* CONFIG_FS_LITTLEFS_STATS */
+
 /* File system interface */
 static const struct fs_file_system_t littlefs_fs = {
 	.open = littlefs_open,
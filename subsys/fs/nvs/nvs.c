@@ -18,6 +18,14 @@ LOG_MODULE_REGISTER(fs_nvs, CONFIG_NVS_LOG_LEVEL);
 
 static int nvs_prev_ate(struct nvs_fs *fs, uint32_t *addr, struct nvs_ate *ate);
 static int nvs_ate_valid(struct nvs_fs *fs, const struct nvs_ate *entry);
+#ifdef CONFIG_NVS_CHECKPOINT
+static int nvs_checkpoint_ate_valid(struct nvs_fs *fs, const struct nvs_ate *entry);
+static int nvs_checkpoint_load(struct nvs_fs *fs, uint32_t addr,
+			       const struct nvs_ate *entry);
+#endif
+#ifdef CONFIG_NVS_GC_BACKGROUND
+static void nvs_sector_advance(struct nvs_fs *fs, uint32_t *addr);
+#endif
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 
@@ -55,6 +63,20 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 			return rc;
 		}
 
+#ifdef CONFIG_NVS_CHECKPOINT
+		/* A checkpoint in the write sector covers all older ate's, as
+		 * no sector has been erased since it was written (except by
+		 * background gc, which nvs_checkpoint_load() accounts for).
+		 */
+		if (((ate_addr ^ fs->ate_wra) & ADDR_SECT_MASK) == 0U &&
+		    nvs_checkpoint_ate_valid(fs, &ate)) {
+			rc = nvs_checkpoint_load(fs, ate_addr, &ate);
+			if (rc <= 0) {
+				return rc;
+			}
+		}
+#endif
+
 		cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
 
 		if (ate.id != 0xFFFF && *cache_entry == NVS_LOOKUP_CACHE_NO_ADDR &&
@@ -470,6 +492,326 @@ static int nvs_flash_wrt_entry(struct nvs_fs *fs, uint16_t id, const void *data,
 
 	return rc;
 }
+
+#ifdef CONFIG_NVS_CHECKPOINT
+/* length of the data of a checkpoint ate */
+static inline size_t nvs_checkpoint_len(struct nvs_fs *fs)
+{
+	return nvs_al_size(fs, sizeof(fs->lookup_cache)) +
+	       sizeof(struct nvs_checkpoint_trailer);
+}
+
+/* nvs_checkpoint_ate_valid validates a checkpoint ate:
+ *     return 1 if it is a valid ate with id 0xFFFF, checkpoint length and no
+ *              part, 0 otherwise
+ */
+static int nvs_checkpoint_ate_valid(struct nvs_fs *fs, const struct nvs_ate *entry)
+{
+	return (entry->id == 0xFFFF) && (entry->len == nvs_checkpoint_len(fs)) &&
+	       (entry->part == 0xff) && nvs_ate_valid(fs, entry);
+}
+
+/* store a checkpoint of the lookup cache in the current sector, if there is
+ * still room for it after reserving 'reserve' bytes for a pending write.
+ */
+static int nvs_checkpoint_write(struct nvs_fs *fs, size_t reserve)
+{
+	int rc;
+	struct nvs_ate entry;
+	struct nvs_checkpoint_trailer trailer;
+	size_t ate_size, len;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+	len = nvs_checkpoint_len(fs);
+
+	/* keep an ate for the checkpoint and one to always allow a delete */
+	if (fs->ate_wra < (fs->data_wra + reserve + nvs_al_size(fs, len) + 2 * ate_size)) {
+		LOG_DBG("No room for checkpoint");
+		return 0;
+	}
+
+	entry.id = 0xFFFF;
+	entry.offset = (uint16_t)(fs->data_wra & ADDR_OFFS_MASK);
+	entry.len = (uint16_t)len;
+	entry.part = 0xff;
+	nvs_ate_crc8_update(&entry);
+
+	/* the ate address is part of the checkpoint so that a copy of it at
+	 * another location is never mistaken for a valid checkpoint
+	 */
+	trailer.ate_addr = fs->ate_wra;
+	trailer.crc32 = crc32_ieee((const uint8_t *)fs->lookup_cache,
+				   sizeof(fs->lookup_cache));
+	trailer.crc32 = crc32_ieee_update(trailer.crc32, (const uint8_t *)&trailer.ate_addr,
+					  sizeof(trailer.ate_addr));
+
+	rc = nvs_flash_data_wrt(fs, fs->lookup_cache, sizeof(fs->lookup_cache), false);
+	if (rc) {
+		return rc;
+	}
+
+	rc = nvs_flash_data_wrt(fs, &trailer, sizeof(trailer), false);
+	if (rc) {
+		return rc;
+	}
+
+	LOG_DBG("Checkpoint at %x", fs->ate_wra);
+
+	return nvs_flash_ate_wrt(fs, &entry);
+}
+
+/* fill the lookup cache entries that are still empty from the checkpoint
+ * stored at addr. Returns 0 if the checkpoint was loaded, 1 if it is not
+ * usable, errcode on flash error.
+ */
+static int nvs_checkpoint_load(struct nvs_fs *fs, uint32_t addr,
+			       const struct nvs_ate *entry)
+{
+	int rc;
+	struct nvs_checkpoint_trailer trailer;
+	uint32_t buf[NVS_BLOCK_SIZE / sizeof(uint32_t)];
+	uint32_t data_addr, rd_addr, crc;
+	size_t pos, cnt;
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	uint32_t erased_sector = NVS_GC_BG_NO_SECTOR;
+#endif
+
+	data_addr = (addr & ADDR_SECT_MASK) + entry->offset;
+
+	rc = nvs_flash_rd(fs, data_addr + nvs_al_size(fs, sizeof(fs->lookup_cache)),
+			  &trailer, sizeof(trailer));
+	if (rc) {
+		return rc;
+	}
+
+	if (trailer.ate_addr != addr) {
+		return 1;
+	}
+
+	/* check the whole checkpoint before using any of it */
+	crc = 0U;
+	rd_addr = data_addr;
+	for (pos = 0; pos < CONFIG_NVS_LOOKUP_CACHE_SIZE; pos += cnt) {
+		cnt = MIN(ARRAY_SIZE(buf), CONFIG_NVS_LOOKUP_CACHE_SIZE - pos);
+		rc = nvs_flash_rd(fs, rd_addr, buf, cnt * sizeof(uint32_t));
+		if (rc) {
+			return rc;
+		}
+		crc = crc32_ieee_update(crc, (const uint8_t *)buf, cnt * sizeof(uint32_t));
+		rd_addr += cnt * sizeof(uint32_t);
+	}
+	crc = crc32_ieee_update(crc, (const uint8_t *)&trailer.ate_addr,
+				sizeof(trailer.ate_addr));
+
+	if (crc != trailer.crc32) {
+		LOG_WRN("Invalid checkpoint at %x", addr);
+		return 1;
+	}
+
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	/* background gc may have erased the sector after the empty one since
+	 * the checkpoint was written, entries in it are dropped.
+	 */
+	rd_addr = addr & ADDR_SECT_MASK;
+	nvs_sector_advance(fs, &rd_addr);
+	nvs_sector_advance(fs, &rd_addr);
+	rd_addr += fs->sector_size - nvs_al_size(fs, sizeof(struct nvs_ate));
+	rc = nvs_flash_cmp_const(fs, rd_addr,
+				 fs->flash_parameters->erase_value, sizeof(struct nvs_ate));
+	if (rc < 0) {
+		return rc;
+	}
+	if (!rc) {
+		erased_sector = rd_addr >> ADDR_SECT_SHIFT;
+	}
+#endif
+
+	rd_addr = data_addr;
+	for (pos = 0; pos < CONFIG_NVS_LOOKUP_CACHE_SIZE; pos += cnt) {
+		cnt = MIN(ARRAY_SIZE(buf), CONFIG_NVS_LOOKUP_CACHE_SIZE - pos);
+		rc = nvs_flash_rd(fs, rd_addr, buf, cnt * sizeof(uint32_t));
+		if (rc) {
+			return rc;
+		}
+		for (size_t i = 0; i < cnt; i++) {
+#ifdef CONFIG_NVS_GC_BACKGROUND
+			if ((buf[i] >> ADDR_SECT_SHIFT) == erased_sector) {
+				continue;
+			}
+#endif
+			if (fs->lookup_cache[pos + i] == NVS_LOOKUP_CACHE_NO_ADDR) {
+				fs->lookup_cache[pos + i] = buf[i];
+			}
+		}
+		rd_addr += cnt * sizeof(uint32_t);
+	}
+
+	LOG_DBG("Lookup cache restored from checkpoint at %x", addr);
+
+	return 0;
+}
+#else
+static inline int nvs_checkpoint_ate_valid(struct nvs_fs *fs, const struct nvs_ate *entry)
+{
+	return 0;
+}
+#endif /* CONFIG_NVS_CHECKPOINT */
+
+#ifdef CONFIG_NVS_WRITE_BATCH
+/* nvs_batch_ate_valid validates a batch ate:
+ *     return 1 if it is a valid ate with id 0xFFFF, part NVS_BATCH_PART and
+ *              data, 0 otherwise
+ */
+static int nvs_batch_ate_valid(struct nvs_fs *fs, const struct nvs_ate *entry)
+{
+	return (entry->id == 0xFFFF) && (entry->part == NVS_BATCH_PART) &&
+	       (entry->len > 0) && nvs_ate_valid(fs, entry);
+}
+
+/* space taken in the data area by the data of a batch member */
+static inline size_t nvs_batch_data_size(struct nvs_fs *fs, size_t len)
+{
+	return len ? nvs_al_size(fs, len + NVS_DATA_CRC_SIZE) : 0;
+}
+
+/* write the ates of the changed batch members, whose data was written from
+ * offset on, either to the data area (as data of the batch ate) or to the
+ * allocation table.
+ */
+static int nvs_batch_members_wrt(struct nvs_fs *fs, const struct nvs_batch_entry *entries,
+				 size_t count, const bool *changed, uint32_t offset,
+				 bool to_data)
+{
+	int rc;
+	struct nvs_ate entry;
+
+	for (size_t i = 0; i < count; i++) {
+		if (!changed[i]) {
+			continue;
+		}
+
+		entry.id = entries[i].id;
+		entry.offset = (uint16_t)(offset & ADDR_OFFS_MASK);
+		entry.len = entries[i].len;
+		entry.part = 0xff;
+#ifdef CONFIG_NVS_DATA_CRC
+		if (entry.len > 0) {
+			entry.len += NVS_DATA_CRC_SIZE;
+		}
+#endif
+		nvs_ate_crc8_update(&entry);
+
+		offset += nvs_batch_data_size(fs, entries[i].len);
+
+		if (to_data) {
+			rc = nvs_flash_data_wrt(fs, &entry, sizeof(struct nvs_ate), false);
+		} else {
+			rc = nvs_flash_ate_wrt(fs, &entry);
+		}
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+/* Complete the most recent batch write of the current sector when it was
+ * interrupted after its batch ate was written: the member ates listed in the
+ * data of the batch ate that are missing after it are written again.
+ */
+static int nvs_batch_recover(struct nvs_fs *fs)
+{
+	int rc;
+	struct nvs_ate batch_ate, member_ate, wlk_ate;
+	uint32_t batch_addr, wlk_addr, data_addr;
+	size_t ate_size, i, member_cnt;
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+
+	/* find the most recent batch ate, before the sector close ate */
+	batch_addr = fs->ate_wra + ate_size;
+	while (1) {
+		if ((batch_addr & ADDR_OFFS_MASK) >= (fs->sector_size - ate_size)) {
+			return 0;
+		}
+
+		rc = nvs_flash_ate_rd(fs, batch_addr, &batch_ate);
+		if (rc) {
+			return rc;
+		}
+
+		if (nvs_batch_ate_valid(fs, &batch_ate)) {
+			break;
+		}
+
+		batch_addr += ate_size;
+	}
+
+	member_cnt = batch_ate.len / ate_size;
+	data_addr = (batch_addr & ADDR_SECT_MASK) + batch_ate.offset;
+
+	/* skip the member ates already written, invalid ates are the result
+	 * of an interrupted write.
+	 */
+	i = 0;
+	wlk_addr = batch_addr - ate_size;
+	while ((i < member_cnt) && (wlk_addr > fs->ate_wra)) {
+		rc = nvs_flash_ate_rd(fs, wlk_addr, &wlk_ate);
+		if (rc) {
+			return rc;
+		}
+		wlk_addr -= ate_size;
+
+		if (!nvs_ate_valid(fs, &wlk_ate)) {
+			continue;
+		}
+
+		rc = nvs_flash_rd(fs, data_addr + i * ate_size, &member_ate,
+				  sizeof(struct nvs_ate));
+		if (rc) {
+			return rc;
+		}
+
+		if (memcmp(&wlk_ate, &member_ate, sizeof(struct nvs_ate))) {
+			/* other entries follow, the batch was completed */
+			return 0;
+		}
+		i++;
+	}
+
+	if (i == member_cnt) {
+		return 0;
+	}
+
+	LOG_INF("Completing interrupted batch write");
+
+	for (; i < member_cnt; i++) {
+		if (fs->ate_wra < (fs->data_wra + ate_size)) {
+			LOG_ERR("No room to complete batch write");
+			return 0;
+		}
+
+		rc = nvs_flash_rd(fs, data_addr + i * ate_size, &member_ate,
+				  sizeof(struct nvs_ate));
+		if (rc) {
+			return rc;
+		}
+
+		rc = nvs_flash_ate_wrt(fs, &member_ate);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+#else
+static inline int nvs_batch_ate_valid(struct nvs_fs *fs, const struct nvs_ate *entry)
+{
+	return 0;
+}
+#endif /* CONFIG_NVS_WRITE_BATCH */
 /* end of flash routines */
 
 /* If the closing ate is invalid, its offset cannot be trusted and
@@ -638,6 +980,11 @@ static int nvs_gc(struct nvs_fs *fs)
 	nvs_sector_advance(fs, &sec_addr);
 	gc_addr = sec_addr + fs->sector_size - ate_size;
 
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	/* a partially drained sector is finished here */
+	fs->gc_bg_sector = NVS_GC_BG_NO_SECTOR;
+#endif
+
 	/* if the sector is not closed don't do gc */
 	rc = nvs_flash_ate_rd(fs, gc_addr, &close_ate);
 	if (rc < 0) {
@@ -673,6 +1020,14 @@ static int nvs_gc(struct nvs_fs *fs)
 			continue;
 		}
 
+		/* checkpoints are superseded by the one written after gc and
+		 * batch ates are only needed until their members are written.
+		 */
+		if (nvs_checkpoint_ate_valid(fs, &gc_ate) ||
+		    nvs_batch_ate_valid(fs, &gc_ate)) {
+			continue;
+		}
+
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 		wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)];
 
@@ -739,86 +1094,314 @@ gc_done:
 		}
 	}
 
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	/* The sector was already erased by background gc */
+	if (fs->gc_bg_erased == sec_addr) {
+		fs->gc_bg_erased = NVS_GC_BG_NO_SECTOR;
+		return 0;
+	}
+#endif
+
 	/* Erase the gc'ed sector */
 	rc = nvs_flash_erase_sector(fs, sec_addr);
 
 	return rc;
 }
 
-static int nvs_startup(struct nvs_fs *fs)
+#ifdef CONFIG_NVS_GC_BACKGROUND
+/* Move the entry at addr of the sector drained by background gc to the write
+ * sector if it is the latest entry with its id.
+ *     return 0 if the entry was moved or does not need to be moved,
+ *            -ENOSPC if the write sector has no room left for it,
+ *            negative errno on flash error
+ */
+static int nvs_gc_bg_move(struct nvs_fs *fs, uint32_t addr)
 {
 	int rc;
-	struct nvs_ate last_ate;
-	size_t ate_size, empty_len;
-	/* Initialize addr to 0 for the case fs->sector_count == 0. This
-	 * should never happen as this is verified in nvs_mount() but both
-	 * Coverity and GCC believe the contrary.
-	 */
-	uint32_t addr = 0U;
-	uint16_t i, closed_sectors = 0;
-	uint8_t erase_value = fs->flash_parameters->erase_value;
-
-	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	struct nvs_ate gc_ate, wlk_ate;
+	uint32_t wlk_addr, wlk_prev_addr, data_addr;
+	size_t ate_size;
 
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
-	/* step through the sectors to find a open sector following
-	 * a closed sector, this is where NVS can write.
-	 */
-	for (i = 0; i < fs->sector_count; i++) {
-		addr = (i << ADDR_SECT_SHIFT) +
-		       (uint16_t)(fs->sector_size - ate_size);
-		rc = nvs_flash_cmp_const(fs, addr, erase_value,
-					 sizeof(struct nvs_ate));
-		if (rc) {
-			/* closed sector */
-			closed_sectors++;
-			nvs_sector_advance(fs, &addr);
-			rc = nvs_flash_cmp_const(fs, addr, erase_value,
-						 sizeof(struct nvs_ate));
-			if (!rc) {
-				/* open sector */
-				break;
-			}
-		}
-	}
-	/* all sectors are closed, this is not a nvs fs or irreparably corrupted */
-	if (closed_sectors == fs->sector_count) {
-#ifdef CONFIG_NVS_INIT_BAD_MEMORY_REGION
-		LOG_WRN("All sectors closed, erasing all sectors...");
-		rc = flash_flatten(fs->flash_device, fs->offset,
-				   fs->sector_size * fs->sector_count);
-		if (rc) {
-			goto end;
-		}
 
-		i = fs->sector_count;
-		addr = ((fs->sector_count - 1) << ADDR_SECT_SHIFT) +
-		       (uint16_t)(fs->sector_size - ate_size);
-#else
-		rc = -EDEADLK;
-		goto end;
-#endif
+	rc = nvs_flash_ate_rd(fs, addr, &gc_ate);
+	if (rc) {
+		return rc;
 	}
 
-	if (i == fs->sector_count) {
-		/* none of the sectors where closed, in most cases we can set
-		 * the address to the first sector, except when there are only
-		 * two sectors. Then we can only set it to the first sector if
-		 * the last sector contains no ate's. So we check this first
-		 */
-		rc = nvs_flash_cmp_const(fs, addr - ate_size, erase_value,
-				sizeof(struct nvs_ate));
-		if (!rc) {
-			/* empty ate */
-			nvs_sector_advance(fs, &addr);
-		}
+	if (!nvs_ate_valid(fs, &gc_ate) || !gc_ate.len ||
+	    nvs_checkpoint_ate_valid(fs, &gc_ate) || nvs_batch_ate_valid(fs, &gc_ate)) {
+		return 0;
 	}
 
-	/* addr contains address of closing ate in the most recent sector,
-	 * search for the last valid ate using the recover_last_ate routine
-	 */
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)];
 
-	rc = nvs_recover_last_ate(fs, &addr);
+	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+		wlk_addr = fs->ate_wra;
+	}
+#else
+	wlk_addr = fs->ate_wra;
+#endif
+	do {
+		wlk_prev_addr = wlk_addr;
+		rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
+		if (rc) {
+			return rc;
+		}
+		if ((wlk_ate.id == gc_ate.id) && (nvs_ate_valid(fs, &wlk_ate))) {
+			break;
+		}
+	} while (wlk_addr != fs->ate_wra);
+
+	if (wlk_prev_addr != addr) {
+		/* a more recent entry exists */
+		return 0;
+	}
+
+	/* keep room for a delete ate */
+	if (fs->ate_wra < (fs->data_wra + nvs_al_size(fs, gc_ate.len) + 2 * ate_size)) {
+		return -ENOSPC;
+	}
+
+	LOG_DBG("Background moving %d, len %d", gc_ate.id, gc_ate.len);
+
+	data_addr = (addr & ADDR_SECT_MASK);
+	data_addr += gc_ate.offset;
+
+	gc_ate.offset = (uint16_t)(fs->data_wra & ADDR_OFFS_MASK);
+	nvs_ate_crc8_update(&gc_ate);
+
+	rc = nvs_flash_block_move(fs, data_addr, gc_ate.len);
+	if (rc) {
+		return rc;
+	}
+
+#ifdef CONFIG_NVS_GC_STATS
+	fs->gc_stats.bg_move_count++;
+#endif
+
+	return nvs_flash_ate_wrt(fs, &gc_ate);
+}
+
+/* Background gc drains the sector that the next gc will collect, i.e. the
+ * sector after the empty one, by moving its live entries to the write sector
+ * one at a time and then erases it. The next gc then has nothing left to do.
+ * Draining starts once the write sector is filled above
+ * CONFIG_NVS_GC_BACKGROUND_THRESHOLD percent, so entries are not moved long
+ * before they would be collected.
+ */
+static uint32_t nvs_gc_bg_sector(struct nvs_fs *fs)
+{
+	uint32_t sec_addr;
+
+	/* the sector before the write sector must stay closed, otherwise
+	 * nvs_startup() can not find the write sector back.
+	 */
+	if (fs->sector_count < 4) {
+		return NVS_GC_BG_NO_SECTOR;
+	}
+
+	if (((fs->ate_wra - fs->data_wra) * 100U) >
+	    ((100U - CONFIG_NVS_GC_BACKGROUND_THRESHOLD) * fs->sector_size)) {
+		return NVS_GC_BG_NO_SECTOR;
+	}
+
+	sec_addr = fs->ate_wra & ADDR_SECT_MASK;
+	nvs_sector_advance(fs, &sec_addr);
+	nvs_sector_advance(fs, &sec_addr);
+
+	if (fs->gc_bg_erased == sec_addr) {
+		return NVS_GC_BG_NO_SECTOR;
+	}
+
+	return sec_addr;
+}
+
+/* Do at most steps increments of background gc, an increment examines one
+ * ate or erases the drained sector.
+ *     return 1 if work is left, 0 if there is nothing (more) to do,
+ *            negative errno on error
+ */
+static int nvs_gc_bg_run(struct nvs_fs *fs, int steps)
+{
+	int rc;
+	struct nvs_ate close_ate;
+	uint32_t sec_addr;
+	size_t ate_size;
+
+	sec_addr = nvs_gc_bg_sector(fs);
+	if (sec_addr == NVS_GC_BG_NO_SECTOR) {
+		return 0;
+	}
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+
+	if (fs->gc_bg_sector != sec_addr) {
+		rc = nvs_flash_ate_rd(fs, sec_addr + fs->sector_size - ate_size, &close_ate);
+		if (rc) {
+			return rc;
+		}
+
+		if (!nvs_ate_cmp_const(&close_ate, fs->flash_parameters->erase_value)) {
+			/* sector is not closed, only erase it */
+			fs->gc_bg_addr = sec_addr;
+			fs->gc_bg_stop = sec_addr + ate_size;
+		} else if (nvs_close_ate_valid(fs, &close_ate)) {
+			fs->gc_bg_addr = sec_addr + fs->sector_size - 2 * ate_size;
+			fs->gc_bg_stop = sec_addr + close_ate.offset;
+		} else {
+			/* leave the recovery of the last ate to nvs_gc() */
+			return 0;
+		}
+
+		fs->gc_bg_sector = sec_addr;
+	}
+
+	for (; steps > 0; steps--) {
+		if (fs->gc_bg_addr < fs->gc_bg_stop) {
+			rc = nvs_flash_erase_sector(fs, sec_addr);
+			if (rc) {
+				return rc;
+			}
+
+			fs->gc_bg_erased = sec_addr;
+			fs->gc_bg_sector = NVS_GC_BG_NO_SECTOR;
+#ifdef CONFIG_NVS_GC_STATS
+			fs->gc_stats.bg_erase_count++;
+#endif
+			return 0;
+		}
+
+		rc = nvs_gc_bg_move(fs, fs->gc_bg_addr);
+		if (rc == -ENOSPC) {
+			/* the write sector is full, nvs_gc() takes over */
+			return 0;
+		}
+		if (rc) {
+			return rc;
+		}
+
+		fs->gc_bg_addr -= ate_size;
+	}
+
+	return 1;
+}
+
+#ifdef CONFIG_NVS_GC_BACKGROUND_WORKQUEUE
+static void nvs_gc_bg_work_handler(struct k_work *work)
+{
+	struct nvs_fs *fs = CONTAINER_OF(work, struct nvs_fs, gc_work);
+	int rc;
+
+	rc = nvs_gc_step(fs);
+	if (rc > 0) {
+		/* let other work items run between increments */
+		(void)k_work_submit(work);
+	} else if (rc < 0) {
+		LOG_ERR("Background gc failed (%d)", rc);
+	}
+}
+#endif /* CONFIG_NVS_GC_BACKGROUND_WORKQUEUE */
+
+/* called with the lock held after a write, assists background gc and
+ * schedules it when needed.
+ */
+static int nvs_gc_bg_write_hook(struct nvs_fs *fs)
+{
+	int rc = 0;
+
+#if CONFIG_NVS_GC_WRITE_STEPS > 0
+	rc = nvs_gc_bg_run(fs, CONFIG_NVS_GC_WRITE_STEPS);
+	if (rc < 0) {
+		return rc;
+	}
+#endif
+
+#ifdef CONFIG_NVS_GC_BACKGROUND_WORKQUEUE
+	if (nvs_gc_bg_sector(fs) != NVS_GC_BG_NO_SECTOR) {
+		(void)k_work_submit(&fs->gc_work);
+	}
+#endif
+
+	return (rc < 0) ? rc : 0;
+}
+#endif /* CONFIG_NVS_GC_BACKGROUND */
+
+static int nvs_startup(struct nvs_fs *fs)
+{
+	int rc;
+	struct nvs_ate last_ate;
+	size_t ate_size, empty_len;
+	/* Initialize addr to 0 for the case fs->sector_count == 0. This
+	 * should never happen as this is verified in nvs_mount() but both
+	 * Coverity and GCC believe the contrary.
+	 */
+	uint32_t addr = 0U;
+	uint16_t i, closed_sectors = 0;
+	uint8_t erase_value = fs->flash_parameters->erase_value;
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+	/* step through the sectors to find a open sector following
+	 * a closed sector, this is where NVS can write.
+	 */
+	for (i = 0; i < fs->sector_count; i++) {
+		addr = (i << ADDR_SECT_SHIFT) +
+		       (uint16_t)(fs->sector_size - ate_size);
+		rc = nvs_flash_cmp_const(fs, addr, erase_value,
+					 sizeof(struct nvs_ate));
+		if (rc) {
+			/* closed sector */
+			closed_sectors++;
+			nvs_sector_advance(fs, &addr);
+			rc = nvs_flash_cmp_const(fs, addr, erase_value,
+						 sizeof(struct nvs_ate));
+			if (!rc) {
+				/* open sector */
+				break;
+			}
+		}
+	}
+	/* all sectors are closed, this is not a nvs fs or irreparably corrupted */
+	if (closed_sectors == fs->sector_count) {
+#ifdef CONFIG_NVS_INIT_BAD_MEMORY_REGION
+		LOG_WRN("All sectors closed, erasing all sectors...");
+		rc = flash_flatten(fs->flash_device, fs->offset,
+				   fs->sector_size * fs->sector_count);
+		if (rc) {
+			goto end;
+		}
+
+		i = fs->sector_count;
+		addr = ((fs->sector_count - 1) << ADDR_SECT_SHIFT) +
+		       (uint16_t)(fs->sector_size - ate_size);
+#else
+		rc = -EDEADLK;
+		goto end;
+#endif
+	}
+
+	if (i == fs->sector_count) {
+		/* none of the sectors where closed, in most cases we can set
+		 * the address to the first sector, except when there are only
+		 * two sectors. Then we can only set it to the first sector if
+		 * the last sector contains no ate's. So we check this first
+		 */
+		rc = nvs_flash_cmp_const(fs, addr - ate_size, erase_value,
+				sizeof(struct nvs_ate));
+		if (!rc) {
+			/* empty ate */
+			nvs_sector_advance(fs, &addr);
+		}
+	}
+
+	/* addr contains address of closing ate in the most recent sector,
+	 * search for the last valid ate using the recover_last_ate routine
+	 */
+
+	rc = nvs_recover_last_ate(fs, &addr);
 	if (rc) {
 		goto end;
 	}
@@ -960,6 +1543,10 @@ static int nvs_startup(struct nvs_fs *fs)
 		fs->data_wra = fs->ate_wra & ADDR_SECT_MASK;
 	}
 
+#ifdef CONFIG_NVS_WRITE_BATCH
+	rc = nvs_batch_recover(fs);
+#endif
+
 end:
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
@@ -989,6 +1576,12 @@ int nvs_clear(struct nvs_fs *fs)
 		return -EACCES;
 	}
 
+#ifdef CONFIG_NVS_GC_BACKGROUND_WORKQUEUE
+	struct k_work_sync sync;
+
+	(void)k_work_cancel_sync(&fs->gc_work, &sync);
+#endif
+
 	for (uint16_t i = 0; i < fs->sector_count; i++) {
 		addr = i << ADDR_SECT_SHIFT;
 		rc = nvs_flash_erase_sector(fs, addr);
@@ -1042,6 +1635,14 @@ int nvs_mount(struct nvs_fs *fs)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	fs->gc_bg_sector = NVS_GC_BG_NO_SECTOR;
+	fs->gc_bg_erased = NVS_GC_BG_NO_SECTOR;
+#ifdef CONFIG_NVS_GC_BACKGROUND_WORKQUEUE
+	k_work_init(&fs->gc_work, nvs_gc_bg_work_handler);
+#endif
+#endif
+
 	rc = nvs_startup(fs);
 	if (rc) {
 		return rc;
@@ -1061,34 +1662,28 @@ int nvs_mount(struct nvs_fs *fs)
 	return 0;
 }
 
-ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
+#ifdef CONFIG_NVS_GC_STATS
+static void nvs_gc_stats_write_done(struct nvs_fs *fs, uint32_t cycles)
 {
-	int rc, gc_count;
-	size_t ate_size, data_size;
+	fs->gc_stats.write_count++;
+	fs->gc_stats.write_max_cycles = MAX(fs->gc_stats.write_max_cycles, cycles);
+}
+#endif
+
+/* nvs_entry_changed compares an entry with the latest one stored with the
+ * same id:
+ *     return 1 if the entry needs to be written,
+ *            0 if it is identical to the stored one or deletes a
+ *              non-existing entry,
+ *            negative errno on error
+ */
+static int nvs_entry_changed(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
+{
+	int rc;
 	struct nvs_ate wlk_ate;
 	uint32_t wlk_addr, rd_addr;
-	uint16_t required_space = 0U; /* no space, appropriate for delete ate */
 	bool prev_found = false;
 
-	if (!fs->ready) {
-		LOG_ERR("NVS not initialized");
-		return -EACCES;
-	}
-
-	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
-	data_size = nvs_al_size(fs, len);
-
-	/* The maximum data size is sector size - 4 ate
-	 * where: 1 ate for data, 1 ate for sector close, 1 ate for gc done,
-	 * and 1 ate to always allow a delete.
-	 * Also take into account the data CRC that is appended at the end of the data field,
-	 * if any.
-	 */
-	if ((len > (fs->sector_size - 4 * ate_size - NVS_DATA_CRC_SIZE)) ||
-	    ((len > 0) && (data == NULL))) {
-		return -EINVAL;
-	}
-
 	/* find latest entry with same id */
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
@@ -1148,13 +1743,15 @@ no_cached_entry:
 		}
 	}
 
-	/* calculate required space if the entry contains data */
-	if (data_size) {
-		/* Leave space for delete ate */
-		required_space = data_size + ate_size + NVS_DATA_CRC_SIZE;
-	}
+	return 1;
+}
 
-	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+/* make sure required_space bytes are available in the current sector, by
+ * closing it and doing garbage collection when needed.
+ */
+static int nvs_make_room(struct nvs_fs *fs, size_t required_space)
+{
+	int rc, gc_count;
 
 	gc_count = 0;
 	while (1) {
@@ -1162,36 +1759,255 @@ no_cached_entry:
 			/* gc'ed all sectors, no extra space will be created
 			 * by extra gc.
 			 */
-			rc = -ENOSPC;
-			goto end;
+			return -ENOSPC;
 		}
 
 		if (fs->ate_wra >= (fs->data_wra + required_space)) {
-
-			rc = nvs_flash_wrt_entry(fs, id, data, len);
-			if (rc) {
-				goto end;
-			}
-			break;
+			return 0;
 		}
 
-
 		rc = nvs_sector_close(fs);
 		if (rc) {
-			goto end;
+			return rc;
 		}
 
 		rc = nvs_gc(fs);
 		if (rc) {
-			goto end;
+			return rc;
 		}
 		gc_count++;
+#ifdef CONFIG_NVS_GC_STATS
+		fs->gc_stats.inline_gc_count++;
+#endif
+
+#ifdef CONFIG_NVS_CHECKPOINT
+		rc = nvs_checkpoint_write(fs, required_space);
+		if (rc) {
+			return rc;
+		}
+#endif
+	}
+}
+
+ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
+{
+	int rc;
+	size_t ate_size, data_size;
+	uint16_t required_space = 0U; /* no space, appropriate for delete ate */
+#ifdef CONFIG_NVS_GC_STATS
+	uint32_t start;
+#endif
+
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+	data_size = nvs_al_size(fs, len);
+
+	/* The maximum data size is sector size - 4 ate
+	 * where: 1 ate for data, 1 ate for sector close, 1 ate for gc done,
+	 * and 1 ate to always allow a delete.
+	 * Also take into account the data CRC that is appended at the end of the data field,
+	 * if any.
+	 */
+	if ((len > (fs->sector_size - 4 * ate_size - NVS_DATA_CRC_SIZE)) ||
+	    ((len > 0) && (data == NULL)) || NVS_ID_RESERVED(id)) {
+		return -EINVAL;
+	}
+
+	rc = nvs_entry_changed(fs, id, data, len);
+	if (rc <= 0) {
+		return rc;
+	}
+
+	/* calculate required space if the entry contains data */
+	if (data_size) {
+		/* Leave space for delete ate */
+		required_space = data_size + ate_size + NVS_DATA_CRC_SIZE;
+	}
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+#ifdef CONFIG_NVS_GC_STATS
+	start = k_cycle_get_32();
+#endif
+
+	rc = nvs_make_room(fs, required_space);
+	if (rc) {
+		goto end;
+	}
+
+	rc = nvs_flash_wrt_entry(fs, id, data, len);
+	if (rc) {
+		goto end;
 	}
+
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	rc = nvs_gc_bg_write_hook(fs);
+	if (rc) {
+		goto end;
+	}
+#endif
+
 	rc = len;
 end:
+#ifdef CONFIG_NVS_GC_STATS
+	nvs_gc_stats_write_done(fs, k_cycle_get_32() - start);
+#endif
+	k_mutex_unlock(&fs->nvs_lock);
+	return rc;
+}
+
+#ifdef CONFIG_NVS_WRITE_BATCH
+/* Check whether a later entry of the batch has the same id */
+static bool nvs_batch_superseded(const struct nvs_batch_entry *entries, size_t count,
+				 size_t i)
+{
+	for (size_t j = i + 1; j < count; j++) {
+		if (entries[j].id == entries[i].id) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+ssize_t nvs_write_batch(struct nvs_fs *fs, const struct nvs_batch_entry *entries,
+			size_t count)
+{
+	int rc;
+	bool changed[CONFIG_NVS_WRITE_BATCH_MAX_ENTRIES];
+	struct nvs_ate batch_ate;
+	size_t ate_size, data_size, required_space, written;
+	uint32_t data_start;
+#ifdef CONFIG_NVS_GC_STATS
+	uint32_t start;
+#endif
+
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	if ((count > CONFIG_NVS_WRITE_BATCH_MAX_ENTRIES) || ((count > 0) && (entries == NULL))) {
+		return -EINVAL;
+	}
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+
+	for (size_t i = 0; i < count; i++) {
+		if ((entries[i].len > (fs->sector_size - 4 * ate_size - NVS_DATA_CRC_SIZE)) ||
+		    ((entries[i].len > 0) && (entries[i].data == NULL)) ||
+		    NVS_ID_RESERVED(entries[i].id)) {
+			return -EINVAL;
+		}
+	}
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+#ifdef CONFIG_NVS_GC_STATS
+	start = k_cycle_get_32();
+#endif
+
+	/* The comparison is done for all entries before anything is written.
+	 * An id present several times in the batch takes the value of its
+	 * last entry, the earlier ones are dropped before comparing it.
+	 */
+	written = 0;
+	data_size = 0;
+	for (size_t i = 0; i < count; i++) {
+		if (nvs_batch_superseded(entries, count, i)) {
+			changed[i] = false;
+			continue;
+		}
+
+		rc = nvs_entry_changed(fs, entries[i].id, entries[i].data, entries[i].len);
+		if (rc < 0) {
+			goto end;
+		}
+
+		changed[i] = (rc > 0);
+		if (changed[i]) {
+			data_size += nvs_batch_data_size(fs, entries[i].len);
+			written++;
+		}
+	}
+
+	if (written == 0) {
+		rc = 0;
+		goto end;
+	}
+
+	/* The batch needs room for the data, the member ates stored as data of
+	 * the batch ate, the batch ate and the member ates. Room is also kept
+	 * for the member ates to be written again when the batch is completed
+	 * on mount, and for one ate to always allow a delete.
+	 */
+	required_space = data_size + (3 * written + 1) * ate_size;
+
+	/* The batch has to fit in a sector holding the sector close and the
+	 * gc done ate.
+	 */
+	if (required_space > (fs->sector_size - 3 * ate_size)) {
+		rc = -EINVAL;
+		goto end;
+	}
+
+	rc = nvs_make_room(fs, required_space);
+	if (rc) {
+		goto end;
+	}
+
+	data_start = fs->data_wra;
+	for (size_t i = 0; i < count; i++) {
+		if (!changed[i]) {
+			continue;
+		}
+
+		rc = nvs_flash_data_wrt(fs, entries[i].data, entries[i].len, true);
+		if (rc) {
+			goto end;
+		}
+	}
+
+	batch_ate.id = 0xFFFF;
+	batch_ate.offset = (uint16_t)(fs->data_wra & ADDR_OFFS_MASK);
+	batch_ate.len = (uint16_t)(written * ate_size);
+	batch_ate.part = NVS_BATCH_PART;
+	nvs_ate_crc8_update(&batch_ate);
+
+	rc = nvs_batch_members_wrt(fs, entries, count, changed, data_start, true);
+	if (rc) {
+		goto end;
+	}
+
+	/* the batch is committed once its ate is written */
+	rc = nvs_flash_ate_wrt(fs, &batch_ate);
+	if (rc) {
+		goto end;
+	}
+
+	rc = nvs_batch_members_wrt(fs, entries, count, changed, data_start, false);
+	if (rc) {
+		goto end;
+	}
+
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	rc = nvs_gc_bg_write_hook(fs);
+	if (rc) {
+		goto end;
+	}
+#endif
+
+	rc = written;
+end:
+#ifdef CONFIG_NVS_GC_STATS
+	nvs_gc_stats_write_done(fs, k_cycle_get_32() - start);
+#endif
 	k_mutex_unlock(&fs->nvs_lock);
 	return rc;
 }
+#endif /* CONFIG_NVS_WRITE_BATCH */
 
 int nvs_delete(struct nvs_fs *fs, uint16_t id)
 {
@@ -1344,7 +2160,12 @@ ssize_t nvs_calc_free_space(struct nvs_fs *fs)
 			}
 		}
 
-		if (nvs_ate_valid(fs, &step_ate)) {
+		/* Checkpoints and batch ates are dropped by gc, like outdated
+		 * entries
+		 */
+		if (nvs_ate_valid(fs, &step_ate) &&
+		    !nvs_checkpoint_ate_valid(fs, &step_ate) &&
+		    !nvs_batch_ate_valid(fs, &step_ate)) {
 			/* Take into account the GC done ATE if it is present */
 			if (step_ate.len == 0) {
 				if (step_ate.id == 0xFFFF) {
@@ -1395,8 +2216,43 @@ int nvs_sector_use_next(struct nvs_fs *fs)
 	}
 
 	ret = nvs_gc(fs);
+#ifdef CONFIG_NVS_CHECKPOINT
+	if (ret == 0) {
+		ret = nvs_checkpoint_write(fs, 0);
+	}
+#endif
 
 end:
 	k_mutex_unlock(&fs->nvs_lock);
 	return ret;
 }
+
+#ifdef CONFIG_NVS_GC_BACKGROUND
+int nvs_gc_step(struct nvs_fs *fs)
+{
+	int rc;
+
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	rc = nvs_gc_bg_run(fs, CONFIG_NVS_GC_BACKGROUND_STEPS);
+	k_mutex_unlock(&fs->nvs_lock);
+
+	return rc;
+}
+#endif /* CONFIG_NVS_GC_BACKGROUND */
+
+#ifdef CONFIG_NVS_GC_STATS
+void nvs_gc_stats_get(struct nvs_fs *fs, struct nvs_gc_stats *stats, bool reset)
+{
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	*stats = fs->gc_stats;
+	if (reset) {
+		memset(&fs->gc_stats, 0, sizeof(fs->gc_stats));
+	}
+	k_mutex_unlock(&fs->nvs_lock);
+}
+#endif /* CONFIG_NVS_GC_STATS */
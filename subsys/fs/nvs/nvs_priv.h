@@ -30,6 +30,8 @@ extern "C" {
 
 #define NVS_LOOKUP_CACHE_NO_ADDR 0xFFFFFFFF
 
+#define NVS_GC_BG_NO_SECTOR 0xFFFFFFFF
+
 /*
  * Allow to use the NVS_DATA_CRC_SIZE macro in computations whether data CRC is enabled or not
  */
@@ -52,6 +54,30 @@ BUILD_ASSERT(offsetof(struct nvs_ate, crc8) ==
 		 sizeof(struct nvs_ate) - sizeof(uint8_t),
 		 "crc8 must be the last member");
 
+/* Trailer of a lookup cache checkpoint. A checkpoint is stored as an ate
+ * with id 0xFFFF whose data is the lookup cache, padded to the write block
+ * size, followed by this trailer.
+ */
+struct nvs_checkpoint_trailer {
+	uint32_t ate_addr;	/* address of the checkpoint ate */
+	uint32_t crc32;		/* crc32 of the lookup cache and ate_addr */
+} __packed;
+
+/* Part of a batch ate. A batch ate has id 0xFFFF and its data holds the ates
+ * of the batch members, each padded to the ate size. The data of the members
+ * is written before the batch ate and their ates after it.
+ */
+#define NVS_BATCH_PART 0x01
+
+/* Checkpoints and batches are stored with id 0xFFFF, which is then no
+ * longer available to users.
+ */
+#if defined(CONFIG_NVS_CHECKPOINT) || defined(CONFIG_NVS_WRITE_BATCH)
+#define NVS_ID_RESERVED(id) ((id) == 0xFFFF)
+#else
+#define NVS_ID_RESERVED(id) false
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -547,6 +547,165 @@ static int zms_flash_write_entry(struct zms_fs *fs, uint32_t id, const void *dat
 	return 0;
 }
 
+#ifdef CONFIG_ZMS_WRITE_BATCH
+/* zms_batch_ate_valid validates a batch ATE: a valid batch ATE:
+ * - valid ATE
+ * - id = ZMS_HEAD_ID and len is a non-zero multiple of the ATE size
+ * return true if valid, false otherwise
+ */
+static bool zms_batch_ate_valid(struct zms_fs *fs, const struct zms_ate *entry)
+{
+	return (zms_ate_valid(fs, entry) && (entry->id == ZMS_HEAD_ID) && (entry->len != 0) &&
+		(entry->len != 0xffff) && !(entry->len % fs->ate_size));
+}
+
+/* space taken in the data area by the data of a batch member */
+static inline size_t zms_batch_data_size(struct zms_fs *fs, size_t len)
+{
+	return (len > ZMS_DATA_IN_ATE_SIZE) ? zms_al_size(fs, len) : 0;
+}
+
+/* Write the ATEs of the changed batch members, whose data was written from
+ * offset on, either to the data area (as data of the batch ATE) or to the
+ * allocation table.
+ */
+static int zms_batch_members_wrt(struct zms_fs *fs, const struct zms_batch_entry *entries,
+				 size_t count, const bool *changed, uint64_t offset, bool to_data)
+{
+	int rc;
+	struct zms_ate entry;
+
+	for (size_t i = 0; i < count; i++) {
+		if (!changed[i]) {
+			continue;
+		}
+
+		memset(&entry, 0, sizeof(struct zms_ate));
+		entry.id = entries[i].id;
+		entry.len = (uint16_t)entries[i].len;
+		entry.cycle_cnt = fs->sector_cycle;
+
+		if (entries[i].len > ZMS_DATA_IN_ATE_SIZE) {
+			if (IS_ENABLED(CONFIG_ZMS_DATA_CRC)) {
+				entry.data_crc = crc32_ieee(entries[i].data, entries[i].len);
+			}
+			entry.offset = (uint32_t)SECTOR_OFFSET(offset);
+		} else if (entries[i].len > 0) {
+			memcpy(&entry.data, entries[i].data, entries[i].len);
+		}
+
+		zms_ate_crc8_update(&entry);
+
+		offset += zms_batch_data_size(fs, entries[i].len);
+
+		if (to_data) {
+			rc = zms_flash_data_wrt(fs, &entry, sizeof(struct zms_ate));
+		} else {
+			rc = zms_flash_ate_wrt(fs, &entry);
+		}
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+/* Complete the most recent batch write of the active sector when it was
+ * interrupted after its batch ATE was written: the member ATEs listed in the
+ * data of the batch ATE that are missing after it are written again.
+ */
+static int zms_batch_recover(struct zms_fs *fs)
+{
+	int rc;
+	struct zms_ate batch_ate;
+	struct zms_ate member_ate;
+	struct zms_ate wlk_ate;
+	uint64_t batch_addr;
+	uint64_t wlk_addr;
+	uint64_t data_addr;
+	size_t i;
+	size_t member_cnt;
+
+	/* find the most recent batch ATE, before the close and empty ATEs */
+	batch_addr = fs->ate_wra + fs->ate_size;
+	while (1) {
+		if (SECTOR_OFFSET(batch_addr) >= (fs->sector_size - 2 * fs->ate_size)) {
+			return 0;
+		}
+
+		rc = zms_flash_ate_rd(fs, batch_addr, &batch_ate);
+		if (rc) {
+			return rc;
+		}
+
+		if (zms_batch_ate_valid(fs, &batch_ate)) {
+			break;
+		}
+
+		batch_addr += fs->ate_size;
+	}
+
+	member_cnt = batch_ate.len / fs->ate_size;
+	data_addr = (batch_addr & ADDR_SECT_MASK) + batch_ate.offset;
+
+	/* skip the member ATEs already written, invalid ATEs are the result
+	 * of an interrupted write.
+	 */
+	i = 0;
+	wlk_addr = batch_addr - fs->ate_size;
+	while ((i < member_cnt) && (wlk_addr > fs->ate_wra)) {
+		rc = zms_flash_ate_rd(fs, wlk_addr, &wlk_ate);
+		if (rc) {
+			return rc;
+		}
+		wlk_addr -= fs->ate_size;
+
+		if (!zms_ate_valid(fs, &wlk_ate)) {
+			continue;
+		}
+
+		rc = zms_flash_rd(fs, data_addr + i * fs->ate_size, &member_ate,
+				  sizeof(struct zms_ate));
+		if (rc) {
+			return rc;
+		}
+
+		if (memcmp(&wlk_ate, &member_ate, sizeof(struct zms_ate))) {
+			/* other entries follow, the batch was completed */
+			return 0;
+		}
+		i++;
+	}
+
+	if (i == member_cnt) {
+		return 0;
+	}
+
+	LOG_INF("Completing interrupted batch write");
+
+	for (; i < member_cnt; i++) {
+		if (fs->ate_wra < (fs->data_wra + fs->ate_size)) {
+			LOG_ERR("No room to complete batch write");
+			return 0;
+		}
+
+		rc = zms_flash_rd(fs, data_addr + i * fs->ate_size, &member_ate,
+				  sizeof(struct zms_ate));
+		if (rc) {
+			return rc;
+		}
+
+		rc = zms_flash_ate_wrt(fs, &member_ate);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_ZMS_WRITE_BATCH */
+
 /* end of flash routines */
 
 /* Search for the last valid ATE written in a sector and also update data write address
@@ -918,6 +1077,11 @@ static int zms_gc(struct zms_fs *fs)
 	zms_sector_advance(fs, &sec_addr);
 	gc_addr = sec_addr + fs->sector_size - fs->ate_size;
 
+#ifdef CONFIG_ZMS_GC_BACKGROUND
+	/* a partially drained sector is finished here */
+	fs->gc_bg_sector = ZMS_GC_BG_NO_SECTOR;
+#endif
+
 	/* verify if the sector is closed */
 	sec_closed = zms_validate_closed_sector(fs, gc_addr, &empty_ate, &close_ate);
 	if (sec_closed < 0) {
@@ -947,7 +1111,8 @@ static int zms_gc(struct zms_fs *fs)
 			return rc;
 		}
 
-		if (!zms_ate_valid(fs, &gc_ate) || !gc_ate.len) {
+		/* batch ATEs are only needed until their members are written */
+		if (!zms_ate_valid(fs, &gc_ate) || !gc_ate.len || (gc_ate.id == ZMS_HEAD_ID)) {
 			continue;
 		}
 
@@ -1015,6 +1180,14 @@ gc_done:
 		return rc;
 	}
 
+#ifdef CONFIG_ZMS_GC_BACKGROUND
+	/* The sector was already erased by background GC */
+	if (fs->gc_bg_erased == sec_addr) {
+		fs->gc_bg_erased = ZMS_GC_BG_NO_SECTOR;
+		return 0;
+	}
+#endif
+
 	/* Erase the GC'ed sector when needed */
 	rc = zms_flash_erase_sector(fs, sec_addr);
 	if (rc) {
@@ -1029,6 +1202,237 @@ gc_done:
 	return rc;
 }
 
+#ifdef CONFIG_ZMS_GC_BACKGROUND
+/* Move the entry at addr of the sector drained by background GC to the active
+ * sector if it is the latest entry with its ID.
+ *     return 0 if the entry was moved or does not need to be moved,
+ *            -ENOSPC if the active sector has no room left for it,
+ *            negative errno on flash error
+ */
+static int zms_gc_bg_move(struct zms_fs *fs, uint64_t addr)
+{
+	int rc;
+	struct zms_ate gc_ate;
+	struct zms_ate wlk_ate;
+	uint64_t wlk_addr;
+	uint64_t wlk_prev_addr;
+	uint64_t data_addr;
+	uint32_t required_space;
+
+	rc = zms_flash_ate_rd(fs, addr, &gc_ate);
+	if (rc) {
+		return rc;
+	}
+
+	if (!zms_ate_valid_different_sector(fs, &gc_ate, fs->gc_bg_cycle) || !gc_ate.len ||
+	    (gc_ate.id == ZMS_HEAD_ID)) {
+		return 0;
+	}
+
+#ifdef CONFIG_ZMS_LOOKUP_CACHE
+	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(gc_ate.id)];
+
+	if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
+		wlk_addr = fs->ate_wra;
+	}
+#else
+	wlk_addr = fs->ate_wra;
+#endif
+
+	wlk_prev_addr = addr;
+	rc = zms_find_ate_with_id(fs, gc_ate.id, wlk_addr, fs->ate_wra, &wlk_ate, &wlk_prev_addr);
+	if (rc < 0) {
+		return rc;
+	}
+
+	if (wlk_prev_addr != addr) {
+		/* a more recent entry exists */
+		return 0;
+	}
+
+	/* keep room for a delete ATE */
+	required_space = fs->ate_size;
+	if (gc_ate.len > ZMS_DATA_IN_ATE_SIZE) {
+		required_space += zms_al_size(fs, gc_ate.len);
+	}
+
+	if (!SECTOR_OFFSET(fs->ate_wra) || (fs->ate_wra < (fs->data_wra + required_space)) ||
+	    !SECTOR_OFFSET(fs->ate_wra - fs->ate_size)) {
+		return -ENOSPC;
+	}
+
+	LOG_DBG("Background moving %d, len %d", gc_ate.id, gc_ate.len);
+
+	if (gc_ate.len > ZMS_DATA_IN_ATE_SIZE) {
+		data_addr = (addr & ADDR_SECT_MASK);
+		data_addr += gc_ate.offset;
+		gc_ate.offset = (uint32_t)SECTOR_OFFSET(fs->data_wra);
+
+		rc = zms_flash_block_move(fs, data_addr, gc_ate.len);
+		if (rc) {
+			return rc;
+		}
+	}
+
+#ifdef CONFIG_ZMS_GC_STATS
+	fs->gc_stats.bg_move_count++;
+#endif
+
+	gc_ate.cycle_cnt = fs->sector_cycle;
+	zms_ate_crc8_update(&gc_ate);
+
+	return zms_flash_ate_wrt(fs, &gc_ate);
+}
+
+/* Background GC drains the sector that the next GC will collect, i.e. the
+ * sector after the empty one, by moving its live entries to the active sector
+ * and then erases it, so that the next GC has nothing left to do.
+ * Draining starts once the active sector is filled above
+ * CONFIG_ZMS_GC_BACKGROUND_THRESHOLD percent.
+ */
+static uint64_t zms_gc_bg_sector(struct zms_fs *fs)
+{
+	uint64_t sec_addr;
+
+	/* the sector before the active sector must stay closed, otherwise
+	 * zms_init() can not find the active sector back.
+	 */
+	if (fs->sector_count < 4) {
+		return ZMS_GC_BG_NO_SECTOR;
+	}
+
+	if (((fs->ate_wra - fs->data_wra) * 100U) >
+	    ((100U - CONFIG_ZMS_GC_BACKGROUND_THRESHOLD) * (uint64_t)fs->sector_size)) {
+		return ZMS_GC_BG_NO_SECTOR;
+	}
+
+	sec_addr = fs->ate_wra & ADDR_SECT_MASK;
+	zms_sector_advance(fs, &sec_addr);
+	zms_sector_advance(fs, &sec_addr);
+
+	if (fs->gc_bg_erased == sec_addr) {
+		return ZMS_GC_BG_NO_SECTOR;
+	}
+
+	return sec_addr;
+}
+
+/* Do at most steps increments of background GC, an increment examines one
+ * ATE or erases the drained sector.
+ *     return 1 if work is left, 0 if there is nothing (more) to do,
+ *            negative errno on error
+ */
+static int zms_gc_bg_run(struct zms_fs *fs, int steps)
+{
+	int rc;
+	int sec_closed;
+	struct zms_ate empty_ate;
+	struct zms_ate close_ate;
+	uint64_t sec_addr;
+
+	sec_addr = zms_gc_bg_sector(fs);
+	if (sec_addr == ZMS_GC_BG_NO_SECTOR) {
+		return 0;
+	}
+
+	if (fs->gc_bg_sector != sec_addr) {
+		sec_closed = zms_validate_closed_sector(fs, zms_close_ate_addr(fs, sec_addr),
+							&empty_ate, &close_ate);
+		if (sec_closed < 0) {
+			return sec_closed;
+		}
+
+		if (sec_closed) {
+			fs->gc_bg_addr = zms_close_ate_addr(fs, sec_addr) - fs->ate_size;
+			fs->gc_bg_stop = sec_addr + close_ate.offset;
+			fs->gc_bg_cycle = empty_ate.cycle_cnt;
+		} else {
+			/* sector is not closed, only erase it */
+			fs->gc_bg_addr = sec_addr;
+			fs->gc_bg_stop = sec_addr + fs->ate_size;
+		}
+
+		fs->gc_bg_sector = sec_addr;
+	}
+
+	for (; steps > 0; steps--) {
+		if (fs->gc_bg_addr < fs->gc_bg_stop) {
+			rc = zms_flash_erase_sector(fs, sec_addr);
+			if (rc) {
+				return rc;
+			}
+
+#ifdef CONFIG_ZMS_LOOKUP_CACHE
+			zms_lookup_cache_invalidate(fs, sec_addr >> ADDR_SECT_SHIFT);
+#endif
+			rc = zms_add_empty_ate(fs, sec_addr);
+			if (rc) {
+				return rc;
+			}
+
+			fs->gc_bg_erased = sec_addr;
+			fs->gc_bg_sector = ZMS_GC_BG_NO_SECTOR;
+#ifdef CONFIG_ZMS_GC_STATS
+			fs->gc_stats.bg_erase_count++;
+#endif
+			return 0;
+		}
+
+		rc = zms_gc_bg_move(fs, fs->gc_bg_addr);
+		if (rc == -ENOSPC) {
+			/* the active sector is full, zms_gc() takes over */
+			return 0;
+		}
+		if (rc) {
+			return rc;
+		}
+
+		fs->gc_bg_addr -= fs->ate_size;
+	}
+
+	return 1;
+}
+
+#ifdef CONFIG_ZMS_GC_BACKGROUND_WORKQUEUE
+static void zms_gc_bg_work_handler(struct k_work *work)
+{
+	struct zms_fs *fs = CONTAINER_OF(work, struct zms_fs, gc_work);
+	int rc;
+
+	rc = zms_gc_step(fs);
+	if (rc > 0) {
+		/* let other work items run between increments */
+		(void)k_work_submit(work);
+	} else if (rc < 0) {
+		LOG_ERR("Background garbage collection failed, returned = %d", rc);
+	}
+}
+#endif /* CONFIG_ZMS_GC_BACKGROUND_WORKQUEUE */
+
+/* called with the lock held after a write, assists background GC and
+ * schedules it when needed.
+ */
+static int zms_gc_bg_write_hook(struct zms_fs *fs)
+{
+	int rc = 0;
+
+#if CONFIG_ZMS_GC_WRITE_STEPS > 0
+	rc = zms_gc_bg_run(fs, CONFIG_ZMS_GC_WRITE_STEPS);
+	if (rc < 0) {
+		return rc;
+	}
+#endif
+
+#ifdef CONFIG_ZMS_GC_BACKGROUND_WORKQUEUE
+	if (zms_gc_bg_sector(fs) != ZMS_GC_BG_NO_SECTOR) {
+		(void)k_work_submit(&fs->gc_work);
+	}
+#endif
+
+	return (rc < 0) ? rc : 0;
+}
+#endif /* CONFIG_ZMS_GC_BACKGROUND */
+
 int zms_clear(struct zms_fs *fs)
 {
 	int rc;
@@ -1039,6 +1443,12 @@ int zms_clear(struct zms_fs *fs)
 		return -EACCES;
 	}
 
+#ifdef CONFIG_ZMS_GC_BACKGROUND_WORKQUEUE
+	struct k_work_sync sync;
+
+	(void)k_work_cancel_sync(&fs->gc_work, &sync);
+#endif
+
 	k_mutex_lock(&fs->zms_lock, K_FOREVER);
 	for (uint32_t i = 0; i < fs->sector_count; i++) {
 		addr = (uint64_t)i << ADDR_SECT_SHIFT;
@@ -1304,6 +1714,10 @@ static int zms_init(struct zms_fs *fs)
 		goto end;
 	}
 
+#ifdef CONFIG_ZMS_WRITE_BATCH
+	rc = zms_batch_recover(fs);
+#endif
+
 end:
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 	if (!rc) {
@@ -1373,6 +1787,14 @@ int zms_mount(struct zms_fs *fs)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_ZMS_GC_BACKGROUND
+	fs->gc_bg_sector = ZMS_GC_BG_NO_SECTOR;
+	fs->gc_bg_erased = ZMS_GC_BG_NO_SECTOR;
+#ifdef CONFIG_ZMS_GC_BACKGROUND_WORKQUEUE
+	k_work_init(&fs->gc_work, zms_gc_bg_work_handler);
+#endif
+#endif
+
 	rc = zms_init(fs);
 
 	if (rc) {
@@ -1389,48 +1811,36 @@ int zms_mount(struct zms_fs *fs)
 	return 0;
 }
 
-ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
+/* zms_entry_changed compares an entry with the latest one stored with the
+ * same ID when CONFIG_ZMS_NO_DOUBLE_WRITE is enabled:
+ *     return 1 if the entry needs to be written,
+ *            0 if it is identical to the stored one or deletes a
+ *              non-existing entry,
+ *            negative errno on error
+ */
+static int zms_entry_changed(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
 {
+#ifdef CONFIG_ZMS_NO_DOUBLE_WRITE
 	int rc;
-	size_t data_size;
 	uint64_t wlk_addr;
 	uint64_t rd_addr;
-	uint32_t gc_count;
-	uint32_t required_space = 0U; /* no space, appropriate for delete ate */
-
-	if (!fs->ready) {
-		LOG_ERR("zms not initialized");
-		return -EACCES;
-	}
-
-	data_size = zms_al_size(fs, len);
-
-	/* The maximum data size is sector size - 5 ate
-	 * where: 1 ate for data, 1 ate for sector close, 1 ate for empty,
-	 * 1 ate for gc done, and 1 ate to always allow a delete.
-	 * We cannot also store more than 64 KB of data
-	 */
-	if ((len > (fs->sector_size - 5 * fs->ate_size)) || (len > UINT16_MAX) ||
-	    ((len > 0) && (data == NULL))) {
-		return -EINVAL;
-	}
+	struct zms_ate wlk_ate;
+	int prev_found;
 
 	/* find latest entry with same id */
 #ifdef CONFIG_ZMS_LOOKUP_CACHE
 	wlk_addr = fs->lookup_cache[zms_lookup_cache_pos(id)];
 
 	if (wlk_addr == ZMS_LOOKUP_CACHE_NO_ADDR) {
-		goto no_cached_entry;
+		return 1;
 	}
 #else
 	wlk_addr = fs->ate_wra;
 #endif
 	rd_addr = wlk_addr;
 
-#ifdef CONFIG_ZMS_NO_DOUBLE_WRITE
 	/* Search for a previous valid ATE with the same ID */
-	struct zms_ate wlk_ate;
-	int prev_found = zms_find_ate_with_id(fs, id, wlk_addr, fs->ate_wra, &wlk_ate, &rd_addr);
+	prev_found = zms_find_ate_with_id(fs, id, wlk_addr, fs->ate_wra, &wlk_ate, &rd_addr);
 	if (prev_found < 0) {
 		return prev_found;
 	}
@@ -1473,20 +1883,17 @@ ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
 	}
 #endif
 
-#ifdef CONFIG_ZMS_LOOKUP_CACHE
-no_cached_entry:
-#endif
-	/* calculate required space if the entry contains data */
-	if (data_size) {
-		/* Leave space for delete ate */
-		if (len > ZMS_DATA_IN_ATE_SIZE) {
-			required_space = data_size + fs->ate_size;
-		} else {
-			required_space = fs->ate_size;
-		}
-	}
+	return 1;
+}
 
-	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+/* Make sure required_space bytes are available in the active sector, by
+ * closing it and doing garbage collection when needed. A delete ATE may use
+ * the last ATE position of the sector.
+ */
+static int zms_make_room(struct zms_fs *fs, uint32_t required_space, bool delete)
+{
+	int rc;
+	uint32_t gc_count;
 
 	gc_count = 0;
 	while (1) {
@@ -1494,8 +1901,7 @@ no_cached_entry:
 			/* gc'ed all sectors, no extra space will be created
 			 * by extra gc.
 			 */
-			rc = -ENOSPC;
-			goto end;
+			return -ENOSPC;
 		}
 
 		/* We need to make sure that we leave the ATE at address 0x0 of the sector
@@ -1506,30 +1912,255 @@ no_cached_entry:
 		 */
 		if ((SECTOR_OFFSET(fs->ate_wra)) &&
 		    (fs->ate_wra >= (fs->data_wra + required_space)) &&
-		    (SECTOR_OFFSET(fs->ate_wra - fs->ate_size) || !len)) {
-			rc = zms_flash_write_entry(fs, id, data, len);
-			if (rc) {
-				goto end;
-			}
-			break;
+		    (SECTOR_OFFSET(fs->ate_wra - fs->ate_size) || delete)) {
+			return 0;
 		}
 		rc = zms_sector_close(fs);
 		if (rc) {
 			LOG_ERR("Failed to close the sector, returned = %d", rc);
-			goto end;
+			return rc;
 		}
 		rc = zms_gc(fs);
 		if (rc) {
 			LOG_ERR("Garbage collection failed, returned = %d", rc);
-			goto end;
+			return rc;
 		}
 		gc_count++;
+#ifdef CONFIG_ZMS_GC_STATS
+		fs->gc_stats.inline_gc_count++;
+#endif
+	}
+}
+
+#ifdef CONFIG_ZMS_GC_STATS
+static void zms_gc_stats_write_done(struct zms_fs *fs, uint32_t cycles)
+{
+	fs->gc_stats.write_count++;
+	fs->gc_stats.write_max_cycles = MAX(fs->gc_stats.write_max_cycles, cycles);
+}
+#endif
+
+ssize_t zms_write(struct zms_fs *fs, uint32_t id, const void *data, size_t len)
+{
+	int rc;
+	size_t data_size;
+	uint32_t required_space = 0U; /* no space, appropriate for delete ate */
+#ifdef CONFIG_ZMS_GC_STATS
+	uint32_t start;
+#endif
+
+	if (!fs->ready) {
+		LOG_ERR("zms not initialized");
+		return -EACCES;
+	}
+
+	data_size = zms_al_size(fs, len);
+
+	/* The maximum data size is sector size - 5 ate
+	 * where: 1 ate for data, 1 ate for sector close, 1 ate for empty,
+	 * 1 ate for gc done, and 1 ate to always allow a delete.
+	 * We cannot also store more than 64 KB of data
+	 */
+	if ((len > (fs->sector_size - 5 * fs->ate_size)) || (len > UINT16_MAX) ||
+	    ((len > 0) && (data == NULL))) {
+		return -EINVAL;
+	}
+
+	rc = zms_entry_changed(fs, id, data, len);
+	if (rc <= 0) {
+		return rc;
+	}
+
+	/* calculate required space if the entry contains data */
+	if (data_size) {
+		/* Leave space for delete ate */
+		if (len > ZMS_DATA_IN_ATE_SIZE) {
+			required_space = data_size + fs->ate_size;
+		} else {
+			required_space = fs->ate_size;
+		}
+	}
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+#ifdef CONFIG_ZMS_GC_STATS
+	start = k_cycle_get_32();
+#endif
+
+	rc = zms_make_room(fs, required_space, !len);
+	if (rc) {
+		goto end;
+	}
+
+	rc = zms_flash_write_entry(fs, id, data, len);
+	if (rc) {
+		goto end;
+	}
+
+#ifdef CONFIG_ZMS_GC_BACKGROUND
+	rc = zms_gc_bg_write_hook(fs);
+	if (rc) {
+		goto end;
 	}
+#endif
+
 	rc = len;
 end:
+#ifdef CONFIG_ZMS_GC_STATS
+	zms_gc_stats_write_done(fs, k_cycle_get_32() - start);
+#endif
+	k_mutex_unlock(&fs->zms_lock);
+	return rc;
+}
+
+#ifdef CONFIG_ZMS_WRITE_BATCH
+/* Check whether a later entry of the batch has the same ID */
+static bool zms_batch_superseded(const struct zms_batch_entry *entries, size_t count, size_t i)
+{
+	for (size_t j = i + 1; j < count; j++) {
+		if (entries[j].id == entries[i].id) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+ssize_t zms_write_batch(struct zms_fs *fs, const struct zms_batch_entry *entries, size_t count)
+{
+	int rc;
+	bool changed[CONFIG_ZMS_WRITE_BATCH_MAX_ENTRIES];
+	struct zms_ate batch_ate;
+	size_t data_size;
+	size_t required_space;
+	size_t written;
+	uint64_t data_start;
+#ifdef CONFIG_ZMS_GC_STATS
+	uint32_t start;
+#endif
+
+	if (!fs->ready) {
+		LOG_ERR("zms not initialized");
+		return -EACCES;
+	}
+
+	if ((count > CONFIG_ZMS_WRITE_BATCH_MAX_ENTRIES) || ((count > 0) && (entries == NULL))) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if ((entries[i].len > (fs->sector_size - 5 * fs->ate_size)) ||
+		    (entries[i].len > UINT16_MAX) ||
+		    ((entries[i].len > 0) && (entries[i].data == NULL))) {
+			return -EINVAL;
+		}
+	}
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+#ifdef CONFIG_ZMS_GC_STATS
+	start = k_cycle_get_32();
+#endif
+
+	/* The comparison is done for all entries before anything is written.
+	 * An ID present several times in the batch takes the value of its
+	 * last entry, the earlier ones are dropped before comparing it.
+	 */
+	written = 0;
+	data_size = 0;
+	for (size_t i = 0; i < count; i++) {
+		if (zms_batch_superseded(entries, count, i)) {
+			changed[i] = false;
+			continue;
+		}
+
+		rc = zms_entry_changed(fs, entries[i].id, entries[i].data, entries[i].len);
+		if (rc < 0) {
+			goto end;
+		}
+
+		changed[i] = (rc > 0);
+		if (changed[i]) {
+			data_size += zms_batch_data_size(fs, entries[i].len);
+			written++;
+		}
+	}
+
+	if (written == 0) {
+		rc = 0;
+		goto end;
+	}
+
+	/* The batch needs room for the data, the member ATEs stored as data of
+	 * the batch ATE, the batch ATE and the member ATEs. Room is also kept
+	 * for the member ATEs to be written again when the batch is completed
+	 * on mount, and for one ATE to always allow a delete.
+	 */
+	required_space = data_size + (3 * written + 1) * fs->ate_size;
+
+	/* The batch has to fit in a sector holding the empty, sector close and
+	 * gc done ATEs, the batch ATE length is also limited to 64 KB.
+	 */
+	if ((required_space > (fs->sector_size - 4 * fs->ate_size)) ||
+	    ((written * fs->ate_size) >= UINT16_MAX)) {
+		rc = -EINVAL;
+		goto end;
+	}
+
+	rc = zms_make_room(fs, required_space, false);
+	if (rc) {
+		goto end;
+	}
+
+	data_start = fs->data_wra;
+	for (size_t i = 0; i < count; i++) {
+		if (!changed[i] || (entries[i].len <= ZMS_DATA_IN_ATE_SIZE)) {
+			continue;
+		}
+
+		rc = zms_flash_data_wrt(fs, entries[i].data, entries[i].len);
+		if (rc) {
+			goto end;
+		}
+	}
+
+	memset(&batch_ate, 0, sizeof(struct zms_ate));
+	batch_ate.id = ZMS_HEAD_ID;
+	batch_ate.len = (uint16_t)(written * fs->ate_size);
+	batch_ate.cycle_cnt = fs->sector_cycle;
+	batch_ate.offset = (uint32_t)SECTOR_OFFSET(fs->data_wra);
+	zms_ate_crc8_update(&batch_ate);
+
+	rc = zms_batch_members_wrt(fs, entries, count, changed, data_start, true);
+	if (rc) {
+		goto end;
+	}
+
+	/* the batch is committed once its ATE is written */
+	rc = zms_flash_ate_wrt(fs, &batch_ate);
+	if (rc) {
+		goto end;
+	}
+
+	rc = zms_batch_members_wrt(fs, entries, count, changed, data_start, false);
+	if (rc) {
+		goto end;
+	}
+
+#ifdef CONFIG_ZMS_GC_BACKGROUND
+	rc = zms_gc_bg_write_hook(fs);
+	if (rc) {
+		goto end;
+	}
+#endif
+
+	rc = written;
+end:
+#ifdef CONFIG_ZMS_GC_STATS
+	zms_gc_stats_write_done(fs, k_cycle_get_32() - start);
+#endif
 	k_mutex_unlock(&fs->zms_lock);
 	return rc;
 }
+#endif /* CONFIG_ZMS_WRITE_BATCH */
 
 int zms_delete(struct zms_fs *fs, uint32_t id)
 {
@@ -1802,3 +2433,33 @@ end:
 	k_mutex_unlock(&fs->zms_lock);
 	return ret;
 }
+
+#ifdef CONFIG_ZMS_GC_BACKGROUND
+int zms_gc_step(struct zms_fs *fs)
+{
+	int rc;
+
+	if (!fs->ready) {
+		LOG_ERR("zms not initialized");
+		return -EACCES;
+	}
+
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+	rc = zms_gc_bg_run(fs, CONFIG_ZMS_GC_BACKGROUND_STEPS);
+	k_mutex_unlock(&fs->zms_lock);
+
+	return rc;
+}
+#endif /* CONFIG_ZMS_GC_BACKGROUND */
+
+#ifdef CONFIG_ZMS_GC_STATS
+void zms_gc_stats_get(struct zms_fs *fs, struct zms_gc_stats *stats, bool reset)
+{
+	k_mutex_lock(&fs->zms_lock, K_FOREVER);
+	*stats = fs->gc_stats;
+	if (reset) {
+		memset(&fs->gc_stats, 0, sizeof(fs->gc_stats));
+	}
+	k_mutex_unlock(&fs->zms_lock);
+}
+#endif /* CONFIG_ZMS_GC_STATS */
@@ -59,6 +59,9 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #define NET_CONN_RANK(_flags)		(_flags & 0x78)
 
+/** Both addresses and ports specified, the best possible rank */
+#define NET_CONN_RANK_EXACT		NET_CONN_RANK(0xff)
+
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
 
 static sys_slist_t conn_unused;
@@ -116,6 +119,138 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if defined(CONFIG_NET_CONN_HASH)
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_NET_CONN_HASH_BUCKETS),
+	     "CONFIG_NET_CONN_HASH_BUCKETS must be a power of two");
+
+#define CONN_HASH_MASK (CONFIG_NET_CONN_HASH_BUCKETS - 1)
+
+/* TCP/UDP connections with both addresses and ports specified, indexed
+ * by the 5-tuple.
+ */
+static sys_slist_t conn_hash_exact[CONFIG_NET_CONN_HASH_BUCKETS];
+
+/* Other TCP/UDP connections with a local port, indexed by protocol and
+ * local port.
+ */
+static sys_slist_t conn_hash_port[CONFIG_NET_CONN_HASH_BUCKETS];
+
+/* Everything else, checked for every packet */
+static sys_slist_t conn_hash_wild;
+
+static inline uint32_t conn_hash_mix(uint32_t hash, uint32_t val)
+{
+	/* Multiplicative hashing, 2^32 divided by the golden ratio */
+	hash = (hash ^ val) * 0x9e3779b1U;
+
+	return hash ^ (hash >> 16);
+}
+
+static inline uint32_t conn_hash_addr(uint8_t family, const uint8_t *addr)
+{
+	uint32_t val = UNALIGNED_GET((const uint32_t *)addr);
+
+	if (family == AF_INET6) {
+		val ^= UNALIGNED_GET((const uint32_t *)addr + 1) ^
+		       UNALIGNED_GET((const uint32_t *)addr + 2) ^
+		       UNALIGNED_GET((const uint32_t *)addr + 3);
+	}
+
+	return val;
+}
+
+/* Ports are in network byte order */
+static uint32_t conn_hash_exact_idx(uint16_t proto, uint8_t family,
+				    const uint8_t *remote_addr,
+				    const uint8_t *local_addr,
+				    uint16_t remote_port, uint16_t local_port)
+{
+	uint32_t hash = proto;
+
+	hash = conn_hash_mix(hash, conn_hash_addr(family, remote_addr));
+	hash = conn_hash_mix(hash, conn_hash_addr(family, local_addr));
+	hash = conn_hash_mix(hash, ((uint32_t)remote_port << 16) | local_port);
+
+	return hash & CONN_HASH_MASK;
+}
+
+static uint32_t conn_hash_port_idx(uint16_t proto, uint16_t local_port)
+{
+	return conn_hash_mix(proto, local_port) & CONN_HASH_MASK;
+}
+
+static const uint8_t *conn_hash_sockaddr(const struct sockaddr *addr)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && addr->sa_family == AF_INET6) {
+		return net_sin6(addr)->sin6_addr.s6_addr;
+	}
+
+	return (const uint8_t *)&net_sin(addr)->sin_addr;
+}
+
+static sys_slist_t *conn_hash_list(struct net_conn *conn)
+{
+	uint16_t local_port = net_sin(&conn->local_addr)->sin_port;
+
+	if ((conn->family != AF_INET && conn->family != AF_INET6) ||
+	    (conn->proto != IPPROTO_TCP && conn->proto != IPPROTO_UDP) ||
+	    local_port == 0U) {
+		return &conn_hash_wild;
+	}
+
+	if (NET_CONN_RANK(conn->flags) == NET_CONN_RANK_EXACT &&
+	    conn->remote_addr.sa_family == conn->family &&
+	    conn->local_addr.sa_family == conn->family) {
+		return &conn_hash_exact[conn_hash_exact_idx(
+				conn->proto, conn->family,
+				conn_hash_sockaddr(&conn->remote_addr),
+				conn_hash_sockaddr(&conn->local_addr),
+				net_sin(&conn->remote_addr)->sin_port,
+				local_port)];
+	}
+
+	return &conn_hash_port[conn_hash_port_idx(conn->proto, local_port)];
+}
+
+/* Must be called with conn_lock held */
+static void conn_hash_add(struct net_conn *conn)
+{
+	conn->hash_list = conn_hash_list(conn);
+	sys_slist_prepend(conn->hash_list, &conn->hash_node);
+}
+
+/* Must be called with conn_lock held */
+static void conn_hash_del(struct net_conn *conn)
+{
+	if (conn->hash_list != NULL) {
+		sys_slist_find_and_remove(conn->hash_list, &conn->hash_node);
+		conn->hash_list = NULL;
+	}
+}
+
+static void conn_hash_init(void)
+{
+	ARRAY_FOR_EACH(conn_hash_exact, i) {
+		sys_slist_init(&conn_hash_exact[i]);
+		sys_slist_init(&conn_hash_port[i]);
+	}
+
+	sys_slist_init(&conn_hash_wild);
+}
+#else
+static inline void conn_hash_add(struct net_conn *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static inline void conn_hash_del(struct net_conn *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static inline void conn_hash_init(void) { }
+#endif /* CONFIG_NET_CONN_HASH */
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -141,6 +276,7 @@ static void conn_set_used(struct net_conn *conn)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_prepend(&conn_used, &conn->node);
+	conn_hash_add(conn);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -452,6 +588,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	conn_hash_del(conn);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -476,10 +613,21 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+	/* The new remote end point may move the connection to another
+	 * lookup table list.
+	 */
+	k_mutex_lock(&conn_lock, K_FOREVER);
+
+	conn_hash_del(conn);
+
 	net_conn_change_callback(conn, cb, user_data);
 
 	ret = net_conn_change_remote(conn, remote_addr, remote_port);
 
+	conn_hash_add(conn);
+
+	k_mutex_unlock(&conn_lock);
+
 	return ret;
 }
 
@@ -534,6 +682,144 @@ static bool conn_addr_cmp(struct net_pkt *pkt,
 	return true;
 }
 
+static bool conn_ip_match(struct net_conn *conn, struct net_pkt *pkt,
+			  union net_ip_header *ip_hdr,
+			  uint16_t src_port, uint16_t dst_port)
+{
+	if (net_sin(&conn->remote_addr)->sin_port &&
+	    net_sin(&conn->remote_addr)->sin_port != src_port) {
+		return false; /* wrong remote port */
+	}
+
+	if (net_sin(&conn->local_addr)->sin_port &&
+	    net_sin(&conn->local_addr)->sin_port != dst_port) {
+		return false; /* wrong local port */
+	}
+
+	if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+		return false; /* wrong remote address */
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+
+		/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+		 * has no IPV6_V6ONLY option set and if the local IPV6 address
+		 * is unspecified, then we could accept a connection from IPv4
+		 * address by mapping it to IPv6 address.
+		 */
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 &&
+			      net_pkt_family(pkt) == AF_INET &&
+			      !conn->v6only &&
+			      net_ipv6_is_addr_unspecified(
+				      &net_sin6(&conn->local_addr)->sin6_addr))) {
+				return false; /* wrong local address */
+			}
+		} else {
+			return false; /* wrong local address */
+		}
+
+		/* We might have a match for v4-to-v6 mapping,
+		 * continue with rank checking.
+		 */
+	}
+
+	return true;
+}
+
+#if defined(CONFIG_NET_CONN_HASH)
+/* Same checks as the list walk in net_conn_input(), for a unicast TCP or
+ * UDP packet. Returns the rank of the connection, or -1 if it does not
+ * match.
+ */
+static int conn_hash_rank(struct net_conn *conn, struct net_pkt *pkt,
+			  union net_ip_header *ip_hdr, uint8_t proto,
+			  uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+
+	if (conn->context != NULL &&
+	    net_context_is_bound_to_iface(conn->context) &&
+	    net_pkt_iface(pkt) != net_context_get_iface(conn->context)) {
+		return -1;
+	}
+
+	if (conn->family != AF_UNSPEC && conn->family != pkt_family &&
+	    !(IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6) &&
+	      conn->family == AF_INET6 && pkt_family == AF_INET && !conn->v6only)) {
+		return -1;
+	}
+
+	if (conn->proto != proto) {
+		return -1;
+	}
+
+	if (!conn_ip_match(conn, pkt, ip_hdr, src_port, dst_port)) {
+		return -1;
+	}
+
+	return NET_CONN_RANK(conn->flags);
+}
+
+/* Must be called with conn_lock held */
+static struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr,
+					 uint8_t proto,
+					 uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t family = net_pkt_family(pkt);
+	sys_slist_t *lists[] = {
+		&conn_hash_port[conn_hash_port_idx(proto, dst_port)],
+		&conn_hash_wild,
+	};
+	struct net_conn *best_match = NULL;
+	int best_rank = -1;
+	struct net_conn *conn;
+	uint32_t idx;
+
+	idx = conn_hash_exact_idx(proto, family,
+				  family == AF_INET6 ? ip_hdr->ipv6->src : ip_hdr->ipv4->src,
+				  family == AF_INET6 ? ip_hdr->ipv6->dst : ip_hdr->ipv4->dst,
+				  src_port, dst_port);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_hash_exact[idx], conn, hash_node) {
+		if (conn_hash_rank(conn, pkt, ip_hdr, proto, src_port, dst_port) >= 0) {
+			return conn;
+		}
+	}
+
+	ARRAY_FOR_EACH(lists, i) {
+		SYS_SLIST_FOR_EACH_CONTAINER(lists[i], conn, hash_node) {
+			int rank = conn_hash_rank(conn, pkt, ip_hdr, proto,
+						  src_port, dst_port);
+
+			if (rank > best_rank) {
+				best_rank = rank;
+				best_match = conn;
+			}
+		}
+	}
+
+	return best_match;
+}
+#else
+static inline struct net_conn *conn_hash_lookup(struct net_pkt *pkt,
+						union net_ip_header *ip_hdr,
+						uint8_t proto,
+						uint16_t src_port, uint16_t dst_port)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto);
+	ARG_UNUSED(src_port);
+	ARG_UNUSED(dst_port);
+
+	return NULL;
+}
+#endif /* CONFIG_NET_CONN_HASH */
+
 static inline void conn_send_icmp_error(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_DISABLE_ICMP_DESTINATION_UNREACHABLE)) {
@@ -710,6 +996,16 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
+	/* Unicast TCP and UDP have at most one receiver, look it up in the
+	 * hash table instead of walking every connection.
+	 */
+	if (IS_ENABLED(CONFIG_NET_CONN_HASH) &&
+	    (pkt_family == AF_INET || pkt_family == AF_INET6) &&
+	    (proto == IPPROTO_TCP || proto == IPPROTO_UDP) && !is_mcast_pkt) {
+		best_match = conn_hash_lookup(pkt, ip_hdr, proto, src_port, dst_port);
+		goto lookup_done;
+	}
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (conn->context != NULL &&
@@ -798,43 +1094,8 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 			/* Is the candidate connection matching the packet's TCP/UDP
 			 * address and port?
 			 */
-			if (net_sin(&conn->remote_addr)->sin_port &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
-
-			if (net_sin(&conn->local_addr)->sin_port &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
-
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
-			}
-
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
+			if (!conn_ip_match(conn, pkt, ip_hdr, src_port, dst_port)) {
+				continue;
 			}
 
 			if (best_rank < NET_CONN_RANK(conn->flags)) {
@@ -878,6 +1139,7 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	} /* loop end */
 
+lookup_done:
 	if (best_match) {
 		cb = best_match->cb;
 		user_data = best_match->user_data;
@@ -964,6 +1226,7 @@ void net_conn_init(void)
 
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
+	conn_hash_init();
 
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
@@ -82,6 +82,14 @@ struct net_conn {
 
 	/** Is v4-mapping-to-v6 enabled for this connection */
 	uint8_t v6only : 1;
+
+#if defined(CONFIG_NET_CONN_HASH)
+	/** Internal slist node for the lookup table */
+	sys_snode_t hash_node;
+
+	/** Lookup table list the connection is linked to */
+	sys_slist_t *hash_list;
+#endif
 };
 
 /**
@@ -59,10 +59,28 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 #include "connection.h"
 #include "udp_internal.h"
 #include "tcp_internal.h"
+#include "net_gro.h"
 
 #include "net_stats.h"
 
 #if defined(CONFIG_NET_NATIVE)
+static inline enum net_verdict process_ip(struct net_pkt *pkt, bool is_loopback)
+{
+	/* IP version and header length. */
+	uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && vtc_vhl == 0x60) {
+		return net_ipv6_input(pkt, is_loopback);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && vtc_vhl == 0x40) {
+		return net_ipv4_input(pkt, is_loopback);
+	}
+
+	NET_DBG("Unknown IP family packet (0x%x)", NET_IPV6_HDR(pkt)->vtc & 0xf0);
+	net_stats_update_ip_errors_protoerr(net_pkt_iface(pkt));
+	net_stats_update_ip_errors_vhlerr(net_pkt_iface(pkt));
+	return NET_DROP;
+}
+
 static inline enum net_verdict process_data(struct net_pkt *pkt,
 					    bool is_loopback)
 {
@@ -133,19 +151,17 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 			return ret;
 		}
 
-		/* IP version and header length. */
-		uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
-
-		if (IS_ENABLED(CONFIG_NET_IPV6) && vtc_vhl == 0x60) {
-			return net_ipv6_input(pkt, is_loopback);
-		} else if (IS_ENABLED(CONFIG_NET_IPV4) && vtc_vhl == 0x40) {
-			return net_ipv4_input(pkt, is_loopback);
+		/* Segments of a bulk TCP transfer may be held back here and
+		 * handed to IP later as one packet, see net_gro_deliver().
+		 */
+		if (IS_ENABLED(CONFIG_NET_GRO) && !is_loopback && !locally_routed) {
+			ret = net_gro_receive(net_tc_rx_gro(), pkt);
+			if (ret != NET_CONTINUE) {
+				return ret;
+			}
 		}
 
-		NET_DBG("Unknown IP family packet (0x%x)", NET_IPV6_HDR(pkt)->vtc & 0xf0);
-		net_stats_update_ip_errors_protoerr(net_pkt_iface(pkt));
-		net_stats_update_ip_errors_vhlerr(net_pkt_iface(pkt));
-		return NET_DROP;
+		return process_ip(pkt, is_loopback);
 	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN) && family == AF_CAN) {
 		return net_canbus_socket_input(pkt);
 	}
@@ -180,6 +196,18 @@ again:
 	}
 }
 
+#if defined(CONFIG_NET_GRO)
+void net_gro_deliver(struct net_pkt *pkt)
+{
+	net_pkt_cursor_init(pkt);
+
+	if (process_ip(pkt, false) != NET_OK) {
+		NET_DBG("Dropping pkt %p", pkt);
+		net_pkt_unref(pkt);
+	}
+}
+#endif
+
 /* Things to setup after we are able to RX and TX */
 static void net_post_init(void)
 {
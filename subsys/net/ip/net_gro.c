@@ -0,0 +1,396 @@
+/** @file
+ * @brief Software generic receive offload (GRO) for TCP
+ */
+
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_gro, CONFIG_NET_GRO_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <string.h>
+
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "net_gro.h"
+#include "tcp_private.h"
+
+#define GRO_TIMEOUT_CYC k_us_to_cyc_ceil32(CONFIG_NET_GRO_TIMEOUT_US)
+
+/* Source and destination addresses are adjacent in both IP headers */
+#define IPV4_ADDR_OFFSET offsetof(struct net_ipv4_hdr, src)
+#define IPV6_ADDR_OFFSET offsetof(struct net_ipv6_hdr, src)
+
+/* Parsed view of a received segment. The IP and TCP headers are both
+ * in the first fragment.
+ */
+struct gro_seg {
+	uint8_t *ip;
+	struct net_tcp_hdr *tcp;
+	struct net_buf *tail;
+	uint32_t seq;
+	uint16_t payload;
+	uint8_t hdr_len;
+	uint8_t family;
+};
+
+/* Returns true if the segment may be merged. seg->tcp is set whenever
+ * the packet is TCP, so that the caller can still find its flow.
+ */
+static bool gro_parse(struct net_pkt *pkt, struct gro_seg *seg)
+{
+	struct net_buf *buf = pkt->buffer;
+	size_t pkt_len = 0U;
+	uint8_t ip_hdr_len;
+	uint8_t tcp_len;
+	bool shared = atomic_get(&pkt->atomic_ref) != 1;
+
+	seg->tcp = NULL;
+
+	if (buf == NULL || buf->len < NET_IPV4H_LEN) {
+		return false;
+	}
+
+	for (seg->tail = buf; ; seg->tail = seg->tail->frags) {
+		pkt_len += seg->tail->len;
+		shared |= seg->tail->ref != 1U;
+
+		if (seg->tail->frags == NULL) {
+			break;
+		}
+	}
+
+	seg->ip = buf->data;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && (seg->ip[0] & 0xf0) == 0x40) {
+		struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)seg->ip;
+
+		/* No options, and neither MF nor a fragment offset. Packets
+		 * that are routed on must leave exactly as they came in.
+		 */
+		if (hdr->vhl != 0x45 || hdr->proto != IPPROTO_TCP ||
+		    (hdr->offset[0] & 0x3f) != 0U || hdr->offset[1] != 0U ||
+		    ntohs(hdr->len) != pkt_len ||
+		    net_if_ipv4_addr_lookup((struct in_addr *)hdr->dst, NULL) == NULL) {
+			return false;
+		}
+
+		seg->family = AF_INET;
+		ip_hdr_len = NET_IPV4H_LEN;
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && (seg->ip[0] & 0xf0) == 0x60 &&
+		   buf->len >= NET_IPV6H_LEN) {
+		struct net_ipv6_hdr *hdr = (struct net_ipv6_hdr *)seg->ip;
+
+		/* Extension headers are not coalesced, and neither are
+		 * packets that are routed on.
+		 */
+		if (hdr->nexthdr != IPPROTO_TCP ||
+		    ntohs(hdr->len) + NET_IPV6H_LEN != pkt_len ||
+		    net_if_ipv6_addr_lookup((struct in6_addr *)hdr->dst, NULL) == NULL) {
+			return false;
+		}
+
+		seg->family = AF_INET6;
+		ip_hdr_len = NET_IPV6H_LEN;
+	} else {
+		return false;
+	}
+
+	if (buf->len < ip_hdr_len + NET_TCPH_LEN) {
+		return false;
+	}
+
+	seg->tcp = (struct net_tcp_hdr *)(seg->ip + ip_hdr_len);
+	tcp_len = (seg->tcp->offset >> 4) * 4U;
+
+	if (tcp_len < NET_TCPH_LEN || buf->len < ip_hdr_len + tcp_len) {
+		seg->tcp = NULL;
+		return false;
+	}
+
+	seg->hdr_len = ip_hdr_len + tcp_len;
+	seg->payload = pkt_len - seg->hdr_len;
+	seg->seq = sys_get_be32(seg->tcp->seq);
+
+	net_pkt_set_family(pkt, seg->family);
+	net_pkt_set_ip_hdr_len(pkt, ip_hdr_len);
+
+	/* Only plain data segments are merged, pure ACKs, SYN, FIN, RST
+	 * and URG segments go through unchanged.
+	 */
+	return !shared && seg->payload > 0U &&
+	       (seg->tcp->flags & ~(ACK | PSH)) == 0U &&
+	       (seg->tcp->flags & ACK) != 0U;
+}
+
+#if defined(CONFIG_NET_IPV4)
+static bool gro_ipv4_chksum_ok(struct net_pkt *pkt)
+{
+	net_pkt_set_ipv4_opts_len(pkt, 0);
+
+	return !net_if_need_calc_rx_checksum(net_pkt_iface(pkt),
+					     NET_IF_CHECKSUM_IPV4_HEADER) ||
+	       net_calc_chksum_ipv4(pkt) == 0U;
+}
+
+static void gro_ipv4_finalize(struct net_gro_flow *flow)
+{
+	struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)flow->ip;
+
+	hdr->len = htons(flow->hdr_len + flow->len);
+	hdr->chksum = 0U;
+	hdr->chksum = net_calc_chksum_ipv4(flow->head);
+}
+#else
+static inline bool gro_ipv4_chksum_ok(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return false;
+}
+
+static inline void gro_ipv4_finalize(struct net_gro_flow *flow)
+{
+	ARG_UNUSED(flow);
+}
+#endif /* CONFIG_NET_IPV4 */
+
+/* Once merged, the original TCP checksums are lost, so they are verified
+ * here and the packet is flagged so that TCP does not check it again.
+ */
+static bool gro_chksum_ok(struct net_pkt *pkt, struct gro_seg *seg)
+{
+	enum net_if_checksum_type type;
+
+	if (seg->family == AF_INET) {
+		if (!gro_ipv4_chksum_ok(pkt)) {
+			return false;
+		}
+
+		type = NET_IF_CHECKSUM_IPV4_TCP;
+	} else {
+		net_pkt_set_ipv6_ext_len(pkt, 0);
+		type = NET_IF_CHECKSUM_IPV6_TCP;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
+	    net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) &&
+	    net_calc_chksum_tcp(pkt) != 0U) {
+		return false;
+	}
+
+	net_pkt_set_gro(pkt, true);
+
+	return true;
+}
+
+static struct net_gro_flow *gro_find(struct net_gro *gro, struct net_pkt *pkt,
+				     struct gro_seg *seg)
+{
+	size_t offset = seg->family == AF_INET ? IPV4_ADDR_OFFSET : IPV6_ADDR_OFFSET;
+	size_t len = seg->family == AF_INET ? 2 * NET_IPV4_ADDR_SIZE :
+					      2 * NET_IPV6_ADDR_SIZE;
+
+	ARRAY_FOR_EACH_PTR(gro->flows, flow) {
+		if (flow->head == NULL ||
+		    flow->iface != net_pkt_iface(pkt) ||
+		    flow->family != seg->family ||
+		    flow->tcp->src_port != seg->tcp->src_port ||
+		    flow->tcp->dst_port != seg->tcp->dst_port ||
+		    memcmp(flow->ip + offset, seg->ip + offset, len) != 0) {
+			continue;
+		}
+
+		return flow;
+	}
+
+	return NULL;
+}
+
+static bool gro_can_merge(struct net_gro_flow *flow, struct gro_seg *seg)
+{
+	if (seg->seq != flow->next_seq || seg->hdr_len != flow->hdr_len ||
+	    seg->payload > flow->mss ||
+	    flow->len + seg->payload > CONFIG_NET_GRO_MAX_SIZE ||
+	    memcmp(seg->tcp->ack, flow->tcp->ack, sizeof(seg->tcp->ack)) != 0 ||
+	    memcmp(seg->tcp->optdata, flow->tcp->optdata,
+		   (seg->tcp->offset >> 4) * 4U - NET_TCPH_LEN) != 0) {
+		return false;
+	}
+
+	if (flow->family == AF_INET) {
+		struct net_ipv4_hdr *a = (struct net_ipv4_hdr *)flow->ip;
+		struct net_ipv4_hdr *b = (struct net_ipv4_hdr *)seg->ip;
+
+		return a->tos == b->tos && a->ttl == b->ttl;
+	}
+
+	/* Version, traffic class and flow label, then the hop limit */
+	return memcmp(flow->ip, seg->ip, 4) == 0 &&
+	       ((struct net_ipv6_hdr *)flow->ip)->hop_limit ==
+	       ((struct net_ipv6_hdr *)seg->ip)->hop_limit;
+}
+
+static void gro_flush_flow(struct net_gro_flow *flow)
+{
+	struct net_pkt *pkt = flow->head;
+
+	flow->head = NULL;
+
+	if (flow->segs > 1U) {
+		if (flow->family == AF_INET) {
+			gro_ipv4_finalize(flow);
+		} else {
+			((struct net_ipv6_hdr *)flow->ip)->len =
+				htons(flow->hdr_len - NET_IPV6H_LEN + flow->len);
+		}
+
+		NET_DBG("Flushing pkt %p, %u segments, %u bytes", pkt,
+			flow->segs, flow->len);
+	}
+
+	net_gro_deliver(pkt);
+}
+
+static void gro_flush_expired(struct net_gro *gro)
+{
+	uint32_t now = k_cycle_get_32();
+
+	ARRAY_FOR_EACH_PTR(gro->flows, flow) {
+		if (flow->head != NULL && now - flow->start >= GRO_TIMEOUT_CYC) {
+			gro_flush_flow(flow);
+		}
+	}
+}
+
+static void gro_hold(struct net_gro *gro, struct net_pkt *pkt,
+		     struct gro_seg *seg)
+{
+	struct net_gro_flow *flow = NULL;
+
+	ARRAY_FOR_EACH_PTR(gro->flows, entry) {
+		if (entry->head == NULL) {
+			flow = entry;
+			break;
+		}
+
+		if (flow == NULL ||
+		    (int32_t)(entry->start - flow->start) < 0) {
+			flow = entry;
+		}
+	}
+
+	if (flow->head != NULL) {
+		gro_flush_flow(flow);
+	}
+
+	flow->head = pkt;
+	flow->tail = seg->tail;
+	flow->iface = net_pkt_iface(pkt);
+	flow->ip = seg->ip;
+	flow->tcp = seg->tcp;
+	flow->start = k_cycle_get_32();
+	flow->next_seq = seg->seq + seg->payload;
+	flow->len = seg->payload;
+	flow->mss = seg->payload;
+	flow->segs = 1U;
+	flow->hdr_len = seg->hdr_len;
+	flow->family = seg->family;
+}
+
+static void gro_merge(struct net_gro_flow *flow, struct net_pkt *pkt,
+		      struct gro_seg *seg)
+{
+	struct net_buf *frags = pkt->buffer;
+
+	/* Latest window and PSH win, the rest of the header is identical */
+	memcpy(flow->tcp->wnd, seg->tcp->wnd, sizeof(flow->tcp->wnd));
+	flow->tcp->flags |= seg->tcp->flags & PSH;
+
+	net_buf_pull(frags, seg->hdr_len);
+	if (frags->len == 0U) {
+		frags = net_buf_frag_del(NULL, frags);
+	}
+
+	pkt->buffer = NULL;
+	net_pkt_unref(pkt);
+
+	net_buf_frag_insert(flow->tail, frags);
+	flow->tail = seg->tail;
+	flow->next_seq += seg->payload;
+	flow->len += seg->payload;
+	flow->segs++;
+}
+
+enum net_verdict net_gro_receive(struct net_gro *gro, struct net_pkt *pkt)
+{
+	struct net_gro_flow *flow;
+	struct gro_seg seg;
+	bool mergeable;
+
+	if (gro == NULL) {
+		return NET_CONTINUE;
+	}
+
+	gro_flush_expired(gro);
+
+	mergeable = gro_parse(pkt, &seg);
+	if (seg.tcp == NULL) {
+		return NET_CONTINUE;
+	}
+
+	flow = gro_find(gro, pkt, &seg);
+
+	if (!mergeable || !gro_chksum_ok(pkt, &seg)) {
+		/* Anything held for the connection must reach TCP before
+		 * this segment does.
+		 */
+		if (flow != NULL) {
+			gro_flush_flow(flow);
+		}
+
+		return NET_CONTINUE;
+	}
+
+	if (flow != NULL && !gro_can_merge(flow, &seg)) {
+		gro_flush_flow(flow);
+		flow = NULL;
+	}
+
+	if (flow == NULL) {
+		if (seg.tcp->flags & PSH) {
+			return NET_CONTINUE;
+		}
+
+		gro_hold(gro, pkt, &seg);
+
+		return NET_OK;
+	}
+
+	gro_merge(flow, pkt, &seg);
+
+	if ((flow->tcp->flags & PSH) || seg.payload < flow->mss ||
+	    flow->len + flow->mss > CONFIG_NET_GRO_MAX_SIZE ||
+	    flow->segs >= CONFIG_NET_GRO_MAX_SEGS) {
+		gro_flush_flow(flow);
+	}
+
+	return NET_OK;
+}
+
+void net_gro_flush(struct net_gro *gro)
+{
+	ARRAY_FOR_EACH_PTR(gro->flows, flow) {
+		if (flow->head != NULL) {
+			gro_flush_flow(flow);
+		}
+	}
+}
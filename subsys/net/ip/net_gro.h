@@ -0,0 +1,124 @@
+/** @file
+ * @brief Software generic receive offload (GRO) for TCP
+ *
+ * Back-to-back in-order TCP segments of one flow are chained into a
+ * single network packet before they are handed to IP and TCP.
+ */
+
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#ifndef __NET_GRO_H
+#define __NET_GRO_H
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_pkt.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(CONFIG_NET_GRO)
+
+/** A TCP flow whose segments are being coalesced */
+struct net_gro_flow {
+	/** Packet carrying the IP and TCP headers of the merged segment */
+	struct net_pkt *head;
+	/** Last data fragment of the merged segment */
+	struct net_buf *tail;
+	/** Interface the segments were received on */
+	struct net_if *iface;
+	/** IP header of the head packet */
+	uint8_t *ip;
+	/** TCP header of the head packet */
+	struct net_tcp_hdr *tcp;
+	/** Cycle count when the flow was opened */
+	uint32_t start;
+	/** Sequence number expected from the next segment */
+	uint32_t next_seq;
+	/** Payload bytes held so far */
+	uint32_t len;
+	/** Payload size of the first segment */
+	uint16_t mss;
+	/** Number of segments held so far */
+	uint8_t segs;
+	/** IP and TCP header length */
+	uint8_t hdr_len;
+	/** Address family */
+	uint8_t family;
+};
+
+/** GRO context, one per RX traffic class thread */
+struct net_gro {
+	struct net_gro_flow flows[CONFIG_NET_GRO_FLOWS];
+};
+
+/**
+ * @brief Try to hold or merge a received packet.
+ *
+ * Called after L2 processing, with the packet data starting at the
+ * IP header.
+ *
+ * @param gro GRO context of the calling RX thread, may be NULL.
+ * @param pkt Received network packet.
+ *
+ * @return NET_OK if the packet was taken over by GRO, NET_CONTINUE if
+ *         the caller should process it as usual.
+ */
+enum net_verdict net_gro_receive(struct net_gro *gro, struct net_pkt *pkt);
+
+/**
+ * @brief Deliver every flow held in a GRO context.
+ *
+ * @param gro GRO context.
+ */
+void net_gro_flush(struct net_gro *gro);
+
+/**
+ * @brief Pass a packet flushed by GRO on to IP.
+ *
+ * @param pkt Network packet, starting at the IP header.
+ */
+void net_gro_deliver(struct net_pkt *pkt);
+
+/**
+ * @brief Return the GRO context of the current RX thread.
+ *
+ * @return GRO context, or NULL if not called from an RX traffic class
+ *         thread.
+ */
+struct net_gro *net_tc_rx_gro(void);
+
+#else /* CONFIG_NET_GRO */
+
+struct net_gro;
+
+static inline enum net_verdict net_gro_receive(struct net_gro *gro,
+					       struct net_pkt *pkt)
+{
+	ARG_UNUSED(gro);
+	ARG_UNUSED(pkt);
+
+	return NET_CONTINUE;
+}
+
+static inline void net_gro_flush(struct net_gro *gro)
+{
+	ARG_UNUSED(gro);
+}
+
+static inline struct net_gro *net_tc_rx_gro(void)
+{
+	return NULL;
+}
+
+#endif /* CONFIG_NET_GRO */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NET_GRO_H */
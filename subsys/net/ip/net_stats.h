@@ -721,6 +721,25 @@ static inline void net_stats_update_tc_rx_time_detail(struct net_if *iface,
 #endif /* CONFIG_NET_PKT_RXTIME_STATS_DETAIL */
 #endif /* NET_TC_COUNT > 1 */
 
+#if (NET_TC_RX_QUEUES > 1) && defined(CONFIG_NET_STATISTICS) \
+	&& defined(CONFIG_NET_NATIVE)
+static inline void net_stats_update_rx_queue_pkt(struct net_if *iface,
+						 uint8_t queue, size_t bytes)
+{
+	UPDATE_STAT(iface, stats.rx_queue[queue].pkts++);
+	UPDATE_STAT(iface, stats.rx_queue[queue].bytes += bytes);
+}
+
+static inline void net_stats_update_rx_queue_dropped(struct net_if *iface,
+						     uint8_t queue)
+{
+	UPDATE_STAT(iface, stats.rx_queue[queue].dropped++);
+}
+#else
+#define net_stats_update_rx_queue_pkt(iface, queue, bytes)
+#define net_stats_update_rx_queue_dropped(iface, queue)
+#endif /* NET_TC_RX_QUEUES > 1 && NET_STATISTICS && NET_NATIVE */
+
 #if defined(CONFIG_NET_STATISTICS_POWER_MANAGEMENT)	\
 	&& defined(CONFIG_NET_STATISTICS) && defined(CONFIG_NET_NATIVE)
 static inline void net_stats_add_suspend_start_time(struct net_if *iface,
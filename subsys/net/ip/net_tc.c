@@ -8,25 +8,29 @@
 LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
 #include <string.h>
 
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
+#include <zephyr/net/ethernet.h>
 
 #include "net_private.h"
 #include "net_stats.h"
 #include "net_tc_mapping.h"
+#include "net_gro.h"
 
 #define TC_RX_PSEUDO_QUEUE (COND_CODE_1(CONFIG_NET_TC_RX_SKIP_FOR_HIGH_PRIO, (1), (0)))
-#define NET_TC_RX_EFFECTIVE_COUNT (NET_TC_RX_COUNT + TC_RX_PSEUDO_QUEUE)
+#define NET_TC_RX_EFFECTIVE_COUNT (NET_TC_RX_QUEUE_COUNT + TC_RX_PSEUDO_QUEUE)
 
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 #define NET_TC_RX_SLOTS (CONFIG_NET_PKT_RX_COUNT / NET_TC_RX_EFFECTIVE_COUNT)
 BUILD_ASSERT(NET_TC_RX_SLOTS > 0,
 		"Misconfiguration: There are more traffic classes then packets, "
 		"either increase CONFIG_NET_PKT_RX_COUNT or decrease "
-		"CONFIG_NET_TC_RX_COUNT or disable CONFIG_NET_TC_RX_SKIP_FOR_HIGH_PRIO");
+		"CONFIG_NET_TC_RX_COUNT or CONFIG_NET_TC_RX_QUEUES or disable "
+		"CONFIG_NET_TC_RX_SKIP_FOR_HIGH_PRIO");
 #endif
 
 #define TC_TX_PSEUDO_QUEUE (COND_CODE_1(CONFIG_NET_TC_TX_SKIP_FOR_HIGH_PRIO, (1), (0)))
@@ -46,15 +50,17 @@ BUILD_ASSERT(NET_TC_TX_SLOTS > 0,
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
  * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
  * where y indicates the traffic class id. The value of y can be from 0 to 7.
+ * With several RX queues per traffic class, ".z" is the queue within the
+ * class.
  */
-#define MAX_NAME_LEN sizeof("xx_q[y]")
+#define MAX_NAME_LEN sizeof("xx_q[y.z]")
 
 /* Stacks for TX work queue */
 K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_COUNT,
 			    CONFIG_NET_TX_STACK_SIZE);
 
 /* Stacks for RX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_QUEUE_COUNT,
 			    CONFIG_NET_RX_STACK_SIZE);
 
 #if NET_TC_TX_COUNT > 0
@@ -62,7 +68,25 @@ static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
 #endif
 
 #if NET_TC_RX_COUNT > 0
-static struct net_traffic_class rx_classes[NET_TC_RX_COUNT];
+static struct net_traffic_class rx_classes[NET_TC_RX_QUEUE_COUNT];
+#endif
+
+#if defined(CONFIG_NET_GRO)
+/* GRO state is private to each RX thread so it needs no locking */
+static struct net_gro rx_gro[NET_TC_RX_QUEUE_COUNT];
+
+struct net_gro *net_tc_rx_gro(void)
+{
+	k_tid_t current = k_current_get();
+
+	for (int i = 0; i < NET_TC_RX_QUEUE_COUNT; i++) {
+		if (&rx_classes[i].handler == current) {
+			return &rx_gro[i];
+		}
+	}
+
+	return NULL;
+}
 #endif
 
 enum net_verdict net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt)
@@ -87,17 +111,127 @@ enum net_verdict net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt)
 #endif
 }
 
+#if NET_TC_RX_QUEUES > 1
+static inline uint32_t rx_hash_mix(uint32_t hash, uint32_t val)
+{
+	/* Multiplicative hashing, 2^32 divided by the golden ratio */
+	hash = (hash ^ val) * 0x9e3779b1U;
+
+	return hash ^ (hash >> 16);
+}
+
+/* Receive side scaling. Hash the IP addresses, and the ports for TCP and
+ * UDP, of a packet that still has its L2 header, so that every packet of
+ * a flow lands in the same queue. IP fragments carry no ports and are
+ * hashed on the addresses only, so they may be processed out of order
+ * with the unfragmented packets of their flow.
+ */
+static uint32_t rx_flow_hash(struct net_pkt *pkt)
+{
+	struct net_if *iface = net_pkt_iface(pkt);
+	const uint8_t *data;
+	uint32_t hash = 0U;
+	size_t len;
+	uint8_t proto;
+
+	if (pkt->buffer == NULL) {
+		return 0U;
+	}
+
+	data = pkt->buffer->data;
+	len = pkt->buffer->len;
+
+	if (IS_ENABLED(CONFIG_NET_L2_ETHERNET) &&
+	    net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		size_t hdr_len = sizeof(struct net_eth_hdr);
+		uint16_t type;
+
+		if (len < hdr_len) {
+			return 0U;
+		}
+
+		type = sys_get_be16(&data[hdr_len - sizeof(type)]);
+		if (type == NET_ETH_PTYPE_VLAN && len >= hdr_len + 4U) {
+			hdr_len += 4U;
+			type = sys_get_be16(&data[hdr_len - sizeof(type)]);
+		}
+
+		if (type != NET_ETH_PTYPE_IP && type != NET_ETH_PTYPE_IPV6) {
+			return 0U;
+		}
+
+		data += hdr_len;
+		len -= hdr_len;
+	} else if (!(IS_ENABLED(CONFIG_NET_L2_DUMMY) &&
+		     net_if_l2(iface) == &NET_L2_GET_NAME(DUMMY))) {
+		return 0U;
+	}
+
+	if (len >= NET_IPV4H_LEN && (data[0] & 0xf0) == 0x40) {
+		const struct net_ipv4_hdr *hdr = (const struct net_ipv4_hdr *)data;
+		size_t hdr_len = (hdr->vhl & 0x0f) * 4U;
+
+		hash = rx_hash_mix(hash, UNALIGNED_GET((const uint32_t *)hdr->src));
+		hash = rx_hash_mix(hash, UNALIGNED_GET((const uint32_t *)hdr->dst));
+		proto = hdr->proto;
+
+		/* Only the first fragment carries the ports, so all the
+		 * fragments of a datagram are steered on the addresses.
+		 */
+		if ((sys_get_be16(hdr->offset) &
+		     (NET_IPV4_MORE_FRAG_MASK | NET_IPV4_FRAGH_OFFSET_MASK)) != 0U) {
+			return rx_hash_mix(hash, proto);
+		}
+
+		data += hdr_len;
+		len = len > hdr_len ? len - hdr_len : 0U;
+	} else if (len >= NET_IPV6H_LEN && (data[0] & 0xf0) == 0x60) {
+		const struct net_ipv6_hdr *hdr = (const struct net_ipv6_hdr *)data;
+
+		/* Source and destination addresses are adjacent */
+		for (int i = 0; i < 2 * NET_IPV6_ADDR_SIZE; i += sizeof(uint32_t)) {
+			hash = rx_hash_mix(hash,
+					   UNALIGNED_GET((const uint32_t *)&hdr->src[i]));
+		}
+
+		proto = hdr->nexthdr;
+		data += NET_IPV6H_LEN;
+		len -= NET_IPV6H_LEN;
+	} else {
+		return 0U;
+	}
+
+	hash = rx_hash_mix(hash, proto);
+
+	if ((proto == IPPROTO_TCP || proto == IPPROTO_UDP) && len >= 4U) {
+		/* Source and destination ports */
+		hash = rx_hash_mix(hash, UNALIGNED_GET((const uint32_t *)data));
+	}
+
+	return hash;
+}
+
+static uint8_t rx_tc2queue(uint8_t tc, struct net_pkt *pkt)
+{
+	return tc * NET_TC_RX_QUEUES + rx_flow_hash(pkt) % NET_TC_RX_QUEUES;
+}
+#else
+#define rx_tc2queue(tc, pkt) (tc)
+#endif /* NET_TC_RX_QUEUES > 1 */
+
 enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 {
 #if NET_TC_RX_COUNT > 0
+	uint8_t queue = rx_tc2queue(tc, pkt);
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 	uint8_t retry_cnt = NET_TC_RETRY_CNT;
 #endif
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
-	while (k_sem_take(&rx_classes[tc].fifo_slot, K_NO_WAIT) != 0) {
+	while (k_sem_take(&rx_classes[queue].fifo_slot, K_NO_WAIT) != 0) {
 		if (k_is_in_isr() || retry_cnt == 0) {
+			net_stats_update_rx_queue_dropped(net_pkt_iface(pkt), queue);
 			return NET_DROP;
 		}
 
@@ -109,7 +243,10 @@ enum net_verdict net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 	}
 #endif
 
-	k_fifo_put(&rx_classes[tc].fifo, pkt);
+	net_stats_update_rx_queue_pkt(net_pkt_iface(pkt), queue,
+				      net_pkt_get_len(pkt));
+
+	k_fifo_put(&rx_classes[queue].fifo, pkt);
 	return NET_OK;
 #else
 	ARG_UNUSED(tc);
@@ -288,9 +425,12 @@ static void net_tc_rx_stats_priority_setup(struct net_if *iface,
 #if NET_TC_RX_COUNT > 0
 static void tc_rx_handler(void *p1, void *p2, void *p3)
 {
-	ARG_UNUSED(p3);
-
 	struct k_fifo *fifo = p1;
+#if defined(CONFIG_NET_GRO)
+	struct net_gro *gro = p3;
+#else
+	ARG_UNUSED(p3);
+#endif
 #if NET_TC_RX_EFFECTIVE_COUNT > 1
 	struct k_sem *fifo_slot = p2;
 #else
@@ -309,6 +449,13 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 #endif
 
 		net_process_rx_packet(pkt);
+
+#if defined(CONFIG_NET_GRO)
+		/* Do not sit on held segments once the queue runs dry */
+		if (k_fifo_is_empty(fifo)) {
+			net_gro_flush(gro);
+		}
+#endif
 	}
 }
 #endif
@@ -426,12 +573,12 @@ void net_tc_rx_init(void)
 	net_if_foreach(net_tc_rx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_RX_COUNT; i++) {
+	for (i = 0; i < NET_TC_RX_QUEUE_COUNT; i++) {
 		uint8_t thread_priority;
 		int priority;
 		k_tid_t tid;
 
-		thread_priority = rx_tc2thread(i);
+		thread_priority = rx_tc2thread(i / NET_TC_RX_QUEUES);
 
 		priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
 			K_PRIO_COOP(thread_priority) :
@@ -461,7 +608,11 @@ void net_tc_rx_init(void)
 #else
 				      NULL,
 #endif
+#if defined(CONFIG_NET_GRO)
+				      &rx_gro[i],
+#else
 				      NULL,
+#endif
 				      priority, 0, K_FOREVER);
 		if (!tid) {
 			NET_ERR("Cannot create TC handler thread %d", i);
@@ -471,10 +622,19 @@ void net_tc_rx_init(void)
 		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
 			char name[MAX_NAME_LEN];
 
+#if NET_TC_RX_QUEUES > 1
+			snprintk(name, sizeof(name), "rx_q[%d.%d]",
+				 i / NET_TC_RX_QUEUES, i % NET_TC_RX_QUEUES);
+#else
 			snprintk(name, sizeof(name), "rx_q[%d]", i);
+#endif
 			k_thread_name_set(tid, name);
 		}
 
+#if defined(CONFIG_NET_TC_RX_QUEUE_CPU_PIN)
+		(void)k_thread_cpu_pin(tid, (i % NET_TC_RX_QUEUES) % arch_num_cpus());
+#endif
+
 		k_thread_start(tid);
 	}
 #endif
@@ -8,6 +8,7 @@
 LOG_MODULE_REGISTER(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
 
 #include <stdarg.h>
+#include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <zephyr/kernel.h>
@@ -65,10 +66,6 @@ static int tcp_tx_window =
 #define TCP_RTO_MS (tcp_rto)
 #endif
 
-/* Define the number of MSS sections the congestion window is initialized at */
-#define TCP_CONGESTION_INITIAL_WIN 1
-#define TCP_CONGESTION_INITIAL_SSTHRESH 3
-
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
 static K_MUTEX_DEFINE(tcp_lock);
@@ -443,103 +440,120 @@ static void tcp_derive_rto(struct tcp *conn)
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
-/* Implementation according to RFC6582 */
+#if defined(CONFIG_NET_TCP_CC_DEFAULT_CUBIC)
+#define TCP_CA_DEFAULT "cubic"
+#else
+#define TCP_CA_DEFAULT "reno"
+#endif
 
-static void tcp_new_reno_log(struct tcp *conn, char *step)
+static const struct tcp_ca_ops *tcp_ca_find(const char *name, size_t len)
 {
-	NET_DBG("conn: %p, ca %s, cwnd=%d, ssthres=%d, fast_pend=%i",
-		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
-		conn->ca.pending_fast_retransmit_bytes);
-}
+	STRUCT_SECTION_FOREACH(tcp_ca_ops, ops) {
+		if (strlen(ops->name) == len && strncmp(ops->name, name, len) == 0) {
+			return ops;
+		}
+	}
 
-static void tcp_new_reno_init(struct tcp *conn)
-{
-	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
-	conn->ca.ssthresh = conn_mss(conn) * TCP_CONGESTION_INITIAL_SSTHRESH;
-	conn->ca.pending_fast_retransmit_bytes = 0;
-	tcp_new_reno_log(conn, "init");
+	return NULL;
 }
 
-static void tcp_new_reno_fast_retransmit(struct tcp *conn)
+static void tcp_ca_select_default(struct tcp *conn)
 {
-	if (conn->ca.pending_fast_retransmit_bytes == 0) {
-		conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
-		/* Account for the lost segments */
-		conn->ca.cwnd = conn_mss(conn) * 3 + conn->ca.ssthresh;
-		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
-		tcp_new_reno_log(conn, "fast_retransmit");
-	}
+	conn->ca_ops = tcp_ca_find(TCP_CA_DEFAULT, sizeof(TCP_CA_DEFAULT) - 1);
+
+	NET_ASSERT(conn->ca_ops != NULL, "Congestion control %s not found",
+		   TCP_CA_DEFAULT);
 }
 
-static void tcp_new_reno_timeout(struct tcp *conn)
+static void tcp_ca_param_copy(struct tcp *to, struct tcp *from)
 {
-	conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
-	conn->ca.cwnd = conn_mss(conn);
-	tcp_new_reno_log(conn, "timeout");
+	to->ca_ops = from->ca_ops;
 }
 
-/* For every duplicate ack increment the cwnd by mss */
-static void tcp_new_reno_dup_ack(struct tcp *conn)
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
 {
-	int32_t new_win = conn->ca.cwnd;
+	const struct tcp_ca_ops *ops;
+	size_t name_len;
 
-	new_win += conn_mss(conn);
-	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
-	tcp_new_reno_log(conn, "dup_ack");
+	if (value == NULL || len == 0) {
+		return -EINVAL;
+	}
+
+	/* Accept the name with or without the terminating NUL */
+	name_len = strnlen(value, len);
+	if (name_len >= TCP_CA_NAME_MAX) {
+		return -EINVAL;
+	}
+
+	ops = tcp_ca_find(value, name_len);
+	if (ops == NULL) {
+		return -ENOENT;
+	}
+
+	if (ops == conn->ca_ops) {
+		return 0;
+	}
+
+	conn->ca_ops = ops;
+
+	/* A running connection restarts from the initial window of the new
+	 * algorithm, the state of the old one does not carry over.
+	 */
+	if (conn->state >= TCP_ESTABLISHED) {
+		conn->ca_ops->init(conn);
+	}
+
+	return 0;
 }
 
-static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
 {
-	int32_t new_win = conn->ca.cwnd;
-	int32_t win_inc = MIN(acked_len, conn_mss(conn));
+	size_t name_len = strlen(conn->ca_ops->name) + 1;
 
-	if (conn->ca.pending_fast_retransmit_bytes == 0) {
-		if (conn->ca.cwnd < conn->ca.ssthresh) {
-			new_win += win_inc;
-		} else {
-			/* Implement a div_ceil	to avoid rounding to 0 */
-			new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
-		}
-		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
-	} else {
-		/* Check if it is still in fast recovery mode */
-		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
-			conn->ca.pending_fast_retransmit_bytes = 0;
-			conn->ca.cwnd = conn->ca.ssthresh;
-		} else {
-			conn->ca.pending_fast_retransmit_bytes -= acked_len;
-			conn->ca.cwnd -= acked_len;
-		}
+	if (value == NULL || len == NULL || *len == 0) {
+		return -EINVAL;
 	}
-	tcp_new_reno_log(conn, "pkts_acked");
+
+	name_len = MIN(name_len, *len);
+	memcpy(value, conn->ca_ops->name, name_len);
+	((char *)value)[name_len - 1] = '\0';
+
+	*len = name_len;
+
+	return 0;
 }
 
 static void tcp_ca_init(struct tcp *conn)
 {
-	tcp_new_reno_init(conn);
+	conn->ca_ops->init(conn);
 }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	conn->ca_ops->fast_retransmit(conn);
 }
 
 static void tcp_ca_timeout(struct tcp *conn)
 {
-	tcp_new_reno_timeout(conn);
+	conn->ca_ops->timeout(conn);
 }
 
 static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	tcp_new_reno_dup_ack(conn);
+	conn->ca_ops->dup_ack(conn);
 }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	conn->ca_ops->pkts_acked(conn, acked_len);
 }
 #else
 
+#define tcp_ca_select_default(...)
+#define tcp_ca_param_copy(...)
+#define set_tcp_congestion(...) (-ENOPROTOOPT)
+#define get_tcp_congestion(...) (-ENOPROTOOPT)
+
 static void tcp_ca_init(struct tcp *conn) { }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn) { }
@@ -1088,7 +1102,7 @@ static uint8_t *tcp_options_get(struct net_pkt *pkt, int tcp_options_len,
 }
 
 static bool tcp_options_check(struct tcp_options *recv_options,
-			      struct net_pkt *pkt, ssize_t len)
+			      struct net_pkt *pkt, ssize_t len, bool syn)
 {
 	uint8_t options_buf[40]; /* TCP header max options size is 40 */
 	bool result = len > 0 && ((len % 4) == 0) ? true : false;
@@ -1098,8 +1112,14 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
-	recv_options->wnd_found = false;
+	/* MSS, window scale and SACK-permitted are only valid in a SYN, so
+	 * options carried by later segments must not reset them.
+	 */
+	if (syn) {
+		recv_options->mss_found = false;
+		recv_options->wnd_found = false;
+		recv_options->sack_perm_found = false;
+	}
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1148,6 +1168,39 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+#if defined(CONFIG_NET_TCP_SACK)
+		case NET_TCP_SACK_OPT: {
+			uint8_t count = (opt_len - 2) / NET_TCP_SACK_BLOCK_SIZE;
+
+			if (((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE) != 0 ||
+			    count == 0 || count > NET_TCP_SACK_MAX_BLOCKS) {
+				result = false;
+				goto end;
+			}
+
+			for (int i = 0; i < count; i++) {
+				const uint8_t *block = options + 2 +
+						       i * NET_TCP_SACK_BLOCK_SIZE;
+
+				recv_options->sack[i].start =
+					ntohl(UNALIGNED_GET((uint32_t *)block));
+				recv_options->sack[i].end =
+					ntohl(UNALIGNED_GET((uint32_t *)(block + 4)));
+			}
+
+			recv_options->sack_count = count;
+			NET_DBG("SACK blocks=%hu", (uint16_t)count);
+			break;
+		}
+#endif /* CONFIG_NET_TCP_SACK */
 		default:
 			continue;
 		}
@@ -1223,60 +1276,60 @@ static int tcp_update_recv_wnd(struct tcp *conn, int32_t delta)
 static size_t tcp_check_pending_data(struct tcp *conn, struct net_pkt *pkt,
 				     size_t len)
 {
+	struct tcphdr *th = th_get(pkt);
+	uint32_t expected_seq;
 	size_t pending_len = 0;
+	struct net_buf *buf;
 
-	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT &&
-	    !net_pkt_is_empty(conn->queue_recv_data)) {
-		/* Some potentential cases:
-		 * Note: MI = MAX_INT
-		 * Packet | Queued| End off   | Gap size | Required handling
-		 * Seq|Len|Seq|Len|           |          |
-		 *  3 | 3 | 6 | 4 | 3+3-6=  0 | 6-3-3=0  | Append
-		 *  3 | 4 | 6 | 4 | 3+4-6 = 1 | 6-3-4=-1 | Append, pull from queue
-		 *  3 | 7 | 6 | 4 | 3+7-6 = 4 | 6-3-7=-4 | Drop queued data
-		 *  3 | 8 | 6 | 4 | 3+8-6 = 5 | 6-3-8=-5 | Drop queued data
-		 *  6 | 5 | 6 | 4 | 6+5-6 = 5 | 6-6-5=-5 | Drop queued data
-		 *  6 | 4 | 6 | 4 | 6+4-6 = 4 | 6-6-4=-4 | Drop queued data / packet
-		 * 10 | 2 | 6 | 4 | 10+2-6= 6 | 6-10-2=-6| Should not happen, dropping queue
-		 *  7 | 4 | 6 | 4 | 7+4-6 = 5 | 6-7-4=-5 | Should not happen, dropping queue
-		 * 11 | 2 | 6 | 4 | 11+2-6= 7 | 6-11-2=-7| Should not happen, dropping queue
-		 *  2 | 3 | 6 | 4 | 2+3-6= MI | 6-2-3=1  | Keep queued data
-		 */
-		struct tcphdr *th = th_get(pkt);
-		uint32_t expected_seq = th_seq(th) + len;
-		uint32_t pending_seq;
-		int32_t gap_size;
-		uint32_t end_offset;
-
-		pending_seq = tcp_get_seq(conn->queue_recv_data->buffer);
-		end_offset = expected_seq - pending_seq;
-		gap_size = (int32_t)(pending_seq - th_seq(th) - ((uint32_t)len));
-		pending_len = net_pkt_get_len(conn->queue_recv_data);
-		if (end_offset < pending_len) {
-			if (end_offset) {
-				net_pkt_remove_tail(pkt, end_offset);
-				pending_len -= end_offset;
-			}
+	if (!CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT ||
+	    net_pkt_is_empty(conn->queue_recv_data)) {
+		return 0;
+	}
 
-			NET_DBG("Found pending data seq %u len %zd",
-				expected_seq, pending_len);
+	/* The queue is sorted and its fragments do not overlap. Drop the
+	 * fragments the incoming data already covers, and move the run that
+	 * continues the incoming data to the packet. Anything after the first
+	 * hole stays queued.
+	 */
+	expected_seq = th_seq(th) + len;
+	buf = conn->queue_recv_data->buffer;
 
-			net_buf_frag_add(pkt->buffer,
-					 conn->queue_recv_data->buffer);
-			conn->queue_recv_data->buffer = NULL;
+	while (buf) {
+		uint32_t seq = tcp_get_seq(buf);
+		struct net_buf *next;
 
-			k_work_cancel_delayable(&conn->recv_queue_timer);
-		} else {
-			/* Check if the queued data is just a section of the incoming data */
-			if (gap_size <= 0) {
-				net_buf_unref(conn->queue_recv_data->buffer);
-				conn->queue_recv_data->buffer = NULL;
+		if (net_tcp_seq_cmp(seq + buf->len, expected_seq) <= 0) {
+			buf = net_buf_frag_del(NULL, buf);
+			continue;
+		}
 
-				k_work_cancel_delayable(&conn->recv_queue_timer);
-			}
+		if (net_tcp_seq_greater(seq, expected_seq)) {
+			break;
+		}
 
-			pending_len = 0;
+		if (seq != expected_seq) {
+			net_buf_pull(buf, expected_seq - seq);
+			tcp_set_seq(buf, expected_seq);
 		}
+
+		expected_seq += buf->len;
+		pending_len += buf->len;
+
+		next = buf->frags;
+		buf->frags = NULL;
+		net_buf_frag_add(pkt->buffer, buf);
+		buf = next;
+	}
+
+	conn->queue_recv_data->buffer = buf;
+
+	if (pending_len > 0) {
+		NET_DBG("Found pending data seq %u len %zd",
+			th_seq(th) + (uint32_t)len, pending_len);
+	}
+
+	if (!buf) {
+		k_work_cancel_delayable(&conn->recv_queue_timer);
 	}
 
 	return pending_len;
@@ -1339,7 +1392,7 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 }
 
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t opts_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -1353,11 +1406,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, &th->th_sport);
 	UNALIGNED_PUT(conn->dst.sin.sin_port, &th->th_dport);
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + opts_len / sizeof(uint32_t);
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
@@ -1437,6 +1486,150 @@ static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 	return net_pkt_set_data(pkt, &mss_opt_access);
 }
 
+/* Two NOPs for alignment, kind, length and the blocks */
+#define TCP_SACK_OPTS_MAX_SIZE (2 * NET_TCP_NOP_SIZE + 2 + \
+				NET_TCP_SACK_MAX_BLOCKS * NET_TCP_SACK_BLOCK_SIZE)
+
+#if defined(CONFIG_NET_TCP_SACK)
+static struct net_buf *tcp_queue_run_get(struct net_buf *buf,
+					 struct tcp_sack_block *run)
+{
+	run->start = tcp_get_seq(buf);
+	run->end = run->start + buf->len;
+
+	for (buf = buf->frags; buf && tcp_get_seq(buf) == run->end;
+	     buf = buf->frags) {
+		run->end += buf->len;
+	}
+
+	return buf;
+}
+
+/* Report the contiguous runs of the out-of-order queue as SACK blocks. The
+ * run holding the most recently queued segment goes first, as required by
+ * RFC 2018 section 4, and the rest follow in sequence order.
+ */
+static int tcp_sack_blocks_get(struct tcp *conn, struct tcp_sack_block *blocks)
+{
+	struct tcp_sack_block run;
+	struct net_buf *buf;
+	int count = 0;
+
+	if (net_pkt_is_empty(conn->queue_recv_data)) {
+		return 0;
+	}
+
+	buf = conn->queue_recv_data->buffer;
+	while (buf) {
+		buf = tcp_queue_run_get(buf, &run);
+
+		if (net_tcp_seq_cmp(conn->sack.last_queued, run.start) >= 0 &&
+		    net_tcp_seq_cmp(conn->sack.last_queued, run.end) < 0) {
+			blocks[count++] = run;
+			break;
+		}
+	}
+
+	buf = conn->queue_recv_data->buffer;
+	while (buf && count < NET_TCP_SACK_MAX_BLOCKS) {
+		buf = tcp_queue_run_get(buf, &run);
+
+		if (count > 0 && run.start == blocks[0].start) {
+			continue;
+		}
+
+		blocks[count++] = run;
+	}
+
+	return count;
+}
+
+static size_t tcp_sack_opts_build(struct tcp *conn, uint8_t flags, uint8_t *opts)
+{
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t *ptr = opts;
+	int count;
+
+	if (flags & SYN) {
+		/* Offer SACK in a SYN, and accept it in a SYN-ACK only if the
+		 * peer offered it.
+		 */
+		if ((flags & ACK) && !conn->sack.permitted) {
+			return 0;
+		}
+
+		*ptr++ = NET_TCP_NOP_OPT;
+		*ptr++ = NET_TCP_NOP_OPT;
+		*ptr++ = NET_TCP_SACK_PERM_OPT;
+		*ptr++ = NET_TCP_SACK_PERM_SIZE;
+
+		return ptr - opts;
+	}
+
+	if (!(flags & ACK) || !conn->sack.permitted) {
+		return 0;
+	}
+
+	count = tcp_sack_blocks_get(conn, blocks);
+	if (count == 0) {
+		return 0;
+	}
+
+	*ptr++ = NET_TCP_NOP_OPT;
+	*ptr++ = NET_TCP_NOP_OPT;
+	*ptr++ = NET_TCP_SACK_OPT;
+	*ptr++ = 2 + count * NET_TCP_SACK_BLOCK_SIZE;
+
+	for (int i = 0; i < count; i++) {
+		sys_put_be32(blocks[i].start, ptr);
+		sys_put_be32(blocks[i].end, ptr + sizeof(uint32_t));
+		ptr += NET_TCP_SACK_BLOCK_SIZE;
+	}
+
+	return ptr - opts;
+}
+
+/* Room taken by the SACK option in the segments sent now */
+static size_t tcp_sack_opts_len(struct tcp *conn)
+{
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	int count;
+
+	if (!conn->sack.permitted) {
+		return 0;
+	}
+
+	count = tcp_sack_blocks_get(conn, blocks);
+	if (count == 0) {
+		return 0;
+	}
+
+	return 2 * NET_TCP_NOP_SIZE + 2 + count * NET_TCP_SACK_BLOCK_SIZE;
+}
+
+static void tcp_sack_negotiate(struct tcp *conn)
+{
+	conn->sack.permitted = conn->recv_options.sack_perm_found;
+	conn->sack.count = 0;
+	conn->sack.in_recovery = false;
+
+	NET_DBG("conn: %p SACK %s", conn,
+		conn->sack.permitted ? "permitted" : "not permitted");
+}
+#else
+static size_t tcp_sack_opts_build(struct tcp *conn, uint8_t flags, uint8_t *opts)
+{
+	return 0;
+}
+
+static size_t tcp_sack_opts_len(struct tcp *conn)
+{
+	return 0;
+}
+
+static void tcp_sack_negotiate(struct tcp *conn) { }
+#endif /* CONFIG_NET_TCP_SACK */
+
 static bool is_destination_local(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
@@ -1542,13 +1735,20 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
 	size_t alloc_len = sizeof(struct tcphdr);
+	uint8_t sack_opts[TCP_SACK_OPTS_MAX_SIZE];
+	size_t sack_opts_len;
+	size_t opts_len = 0;
 	struct net_pkt *pkt;
 	int ret = 0;
 
 	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
+		opts_len += NET_TCP_MSS_SIZE;
 	}
 
+	sack_opts_len = tcp_sack_opts_build(conn, flags, sack_opts);
+	opts_len += sack_opts_len;
+	alloc_len += opts_len;
+
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
@@ -1567,7 +1767,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, opts_len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
@@ -1581,6 +1781,14 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	if (sack_opts_len > 0) {
+		ret = net_pkt_write(pkt, sack_opts, sack_opts_len);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1736,42 +1944,27 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
-static int tcp_send_data(struct tcp *conn)
+static int tcp_send_segment(struct tcp *conn, int offset, int len,
+			    bool resend)
 {
-	int ret = 0;
-	int len;
 	struct net_pkt *pkt;
-
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
-	if (len < 0) {
-		ret = len;
-		goto out;
-	}
-	if (len == 0) {
-		NET_DBG("conn: %p no data to send", conn);
-		ret = -ENODATA;
-		goto out;
-	}
+	int ret;
 
 	pkt = tcp_pkt_alloc(conn, len);
 	if (!pkt) {
 		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
-		ret = -ENOBUFS;
-		goto out;
+		return -ENOBUFS;
 	}
 
-	ret = tcp_pkt_peek(pkt, conn->send_data, conn->unacked_len, len);
+	ret = tcp_pkt_peek(pkt, conn->send_data, offset, len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
-		ret = -ENOBUFS;
-		goto out;
+		return -ENOBUFS;
 	}
 
-	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + offset);
 	if (ret == 0) {
-		conn->unacked_len += len;
-
-		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
+		if (resend) {
 			net_stats_update_tcp_resent(conn->iface, len);
 			net_stats_update_tcp_seg_rexmit(conn->iface);
 		} else {
@@ -1786,12 +1979,279 @@ static int tcp_send_data(struct tcp *conn)
 	 */
 	tcp_pkt_unref(pkt);
 
+	return ret;
+}
+
+#if defined(CONFIG_NET_TCP_SACK)
+/* Move unacked_len past the data the peer has selectively acknowledged, so
+ * that a retransmission does not send it again.
+ */
+static void tcp_sack_skip(struct tcp *conn)
+{
+	uint32_t next = conn->seq + conn->unacked_len;
+
+	for (int i = 0; i < conn->sack.count; i++) {
+		struct tcp_sack_block *block = &conn->sack.scoreboard[i];
+
+		if (net_tcp_seq_cmp(next, block->start) < 0) {
+			break;
+		}
+
+		if (net_tcp_seq_cmp(next, block->end) < 0) {
+			next = block->end;
+		}
+	}
+
+	conn->unacked_len = MIN(next - conn->seq, conn->send_data_total);
+}
+
+/* Limit the segment so that it ends where the next SACKed range starts */
+static int tcp_sack_limit(struct tcp *conn, uint32_t seq, int len)
+{
+	for (int i = 0; i < conn->sack.count; i++) {
+		struct tcp_sack_block *block = &conn->sack.scoreboard[i];
+
+		if (net_tcp_seq_greater(block->start, seq)) {
+			return MIN(len, block->start - seq);
+		}
+	}
+
+	return len;
+}
+#else
+static void tcp_sack_skip(struct tcp *conn) { }
+
+static int tcp_sack_limit(struct tcp *conn, uint32_t seq, int len)
+{
+	return len;
+}
+#endif /* CONFIG_NET_TCP_SACK */
+
+/* Payload size of a data segment. The options count against the MSS
+ * (RFC 6691), and SACK blocks ride on every data segment while the
+ * receive queue has holes.
+ */
+static int tcp_seg_size(struct tcp *conn)
+{
+	return conn_mss(conn) - tcp_sack_opts_len(conn);
+}
+
+static int tcp_send_data(struct tcp *conn)
+{
+	int ret = 0;
+	int len;
+
+	tcp_sack_skip(conn);
+
+	len = MIN(tcp_unsent_len(conn), tcp_seg_size(conn));
+	if (len < 0) {
+		ret = len;
+		goto out;
+	}
+	if (len == 0) {
+		NET_DBG("conn: %p no data to send", conn);
+		ret = -ENODATA;
+		goto out;
+	}
+
+	len = tcp_sack_limit(conn, conn->seq + conn->unacked_len, len);
+
+	ret = tcp_send_segment(conn, conn->unacked_len, len,
+			       conn->data_mode == TCP_DATA_MODE_RESEND);
+	if (ret == 0) {
+		conn->unacked_len += len;
+	}
+
 	conn_send_data_dump(conn);
 
  out:
 	return ret;
 }
 
+#if defined(CONFIG_NET_TCP_SACK)
+/* Merge a block into the sorted scoreboard. When the scoreboard is full the
+ * highest range is forgotten, as the lowest holes are repaired first.
+ */
+static void tcp_sack_scoreboard_add(struct tcp *conn, uint32_t start,
+				    uint32_t end)
+{
+	struct tcp_sack_block *sb = conn->sack.scoreboard;
+	int count = conn->sack.count;
+	int i = 0;
+	int j;
+
+	while (i < count && net_tcp_seq_cmp(sb[i].end, start) < 0) {
+		i++;
+	}
+
+	/* Absorb all the blocks overlapping or touching the new one */
+	for (j = i; j < count && net_tcp_seq_cmp(sb[j].start, end) <= 0; j++) {
+		if (net_tcp_seq_cmp(sb[j].start, start) < 0) {
+			start = sb[j].start;
+		}
+
+		if (net_tcp_seq_cmp(sb[j].end, end) > 0) {
+			end = sb[j].end;
+		}
+	}
+
+	if (j == i) {
+		if (i == NET_TCP_SACK_MAX_BLOCKS) {
+			return;
+		}
+
+		if (count == NET_TCP_SACK_MAX_BLOCKS) {
+			count--;
+		}
+
+		memmove(&sb[i + 1], &sb[i], (count - i) * sizeof(sb[0]));
+		count++;
+	} else if (j - i > 1) {
+		memmove(&sb[i + 1], &sb[j], (count - j) * sizeof(sb[0]));
+		count -= j - i - 1;
+	}
+
+	sb[i].start = start;
+	sb[i].end = end;
+	conn->sack.count = count;
+}
+
+/* Record the SACK blocks carried by an incoming ACK */
+static void tcp_sack_received(struct tcp *conn, uint32_t ack)
+{
+	uint32_t snd_nxt = conn->seq + conn->unacked_len;
+
+	if (!conn->sack.permitted) {
+		return;
+	}
+
+	for (int i = 0; i < conn->recv_options.sack_count; i++) {
+		struct tcp_sack_block *block = &conn->recv_options.sack[i];
+
+		/* Ignore invalid blocks, the ones reporting data that is
+		 * already cumulatively acknowledged (RFC 2883 D-SACK), and
+		 * the ones reaching past the data sent so far.
+		 */
+		if (!net_tcp_seq_greater(block->end, block->start) ||
+		    !net_tcp_seq_greater(block->start, ack) ||
+		    net_tcp_seq_greater(block->end, snd_nxt)) {
+			continue;
+		}
+
+		tcp_sack_scoreboard_add(conn, block->start, block->end);
+	}
+}
+
+/* Retransmit the first segment of the lowest hole above the cumulative ACK
+ * that has not been retransmitted during this recovery. Only the holes
+ * below the highest SACKed range are considered lost.
+ */
+static void tcp_sack_retransmit_hole(struct tcp *conn)
+{
+	uint32_t start = conn->sack.rexmit;
+	int len;
+
+	if (!conn->sack.in_recovery) {
+		return;
+	}
+
+	if (net_tcp_seq_cmp(start, conn->seq) < 0) {
+		start = conn->seq;
+	}
+
+	for (int i = 0; i < conn->sack.count; i++) {
+		struct tcp_sack_block *block = &conn->sack.scoreboard[i];
+
+		if (net_tcp_seq_cmp(start, block->start) < 0) {
+			len = MIN(block->start - start, tcp_seg_size(conn));
+
+			if (tcp_send_segment(conn, start - conn->seq, len,
+					     true) == 0) {
+				conn->sack.rexmit = start + len;
+			}
+
+			return;
+		}
+
+		if (net_tcp_seq_cmp(start, block->end) < 0) {
+			start = block->end;
+		}
+	}
+}
+
+static void tcp_sack_recovery_start(struct tcp *conn, uint32_t rexmit,
+				    uint32_t recover)
+{
+	if (!conn->sack.permitted) {
+		return;
+	}
+
+	conn->sack.in_recovery = true;
+	conn->sack.rexmit = rexmit;
+	conn->sack.recover = recover;
+}
+
+/* Drop the scoreboard entries covered by the cumulative ACK. A partial ACK
+ * during the recovery repairs the next hole right away.
+ */
+static void tcp_sack_acked(struct tcp *conn)
+{
+	struct tcp_sack_block *sb = conn->sack.scoreboard;
+	int i = 0;
+
+	while (i < conn->sack.count &&
+	       net_tcp_seq_cmp(sb[i].end, conn->seq) <= 0) {
+		i++;
+	}
+
+	if (i > 0) {
+		memmove(sb, &sb[i], (conn->sack.count - i) * sizeof(sb[0]));
+		conn->sack.count -= i;
+	}
+
+	if (conn->sack.count > 0 && net_tcp_seq_greater(conn->seq, sb[0].start)) {
+		sb[0].start = conn->seq;
+	}
+
+	if (!conn->sack.in_recovery) {
+		return;
+	}
+
+	if (net_tcp_seq_cmp(conn->seq, conn->sack.recover) >= 0) {
+		conn->sack.in_recovery = false;
+		return;
+	}
+
+#ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
+	/* Still recovering, do not start a new fast retransmit */
+	conn->dup_ack_cnt = DUPLICATE_ACK_RETRANSMIT_TRHESHOLD + 1;
+#endif
+	tcp_sack_retransmit_hole(conn);
+}
+
+static void tcp_sack_timeout(struct tcp *conn)
+{
+	/* The receiver may have reneged on the SACKed data, e.g. dropped its
+	 * out-of-order queue, so forget the scoreboard and send everything
+	 * again from the cumulative ACK (RFC 2018 section 8, RFC 6675
+	 * section 5.1).
+	 */
+	conn->sack.count = 0;
+	conn->sack.in_recovery = false;
+}
+#else
+static void tcp_sack_received(struct tcp *conn, uint32_t ack) { }
+
+static inline void tcp_sack_retransmit_hole(struct tcp *conn) { }
+
+static inline void tcp_sack_recovery_start(struct tcp *conn, uint32_t rexmit,
+					   uint32_t recover) { }
+
+static void tcp_sack_acked(struct tcp *conn) { }
+
+static void tcp_sack_timeout(struct tcp *conn) { }
+#endif /* CONFIG_NET_TCP_SACK */
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
@@ -1885,6 +2345,7 @@ static void tcp_resend_data(struct k_work *work)
 
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
+	tcp_sack_timeout(conn);
 
 	ret = tcp_send_data(conn);
 	conn->send_data_retries++;
@@ -2141,6 +2602,7 @@ static struct tcp *tcp_conn_alloc(void)
 	 */
 	conn->ca.cwnd = UINT16_MAX;
 #endif
+	tcp_ca_select_default(conn);
 
 	/* The ISN value will be set when we get the connection attempt or
 	 * when trying to create a connection.
@@ -2548,165 +3010,115 @@ static enum tcp_state tcp_enter_time_wait(struct tcp *conn)
 	return TCP_TIME_WAIT;
 }
 
-static bool check_seq_list(struct net_buf *buf)
+/* Insert a single fragment to the sorted out-of-order queue. Queued data
+ * that the fragment fully covers is replaced, and partial overlaps are
+ * trimmed so that every sequence number is stored only once.
+ */
+static bool tcp_queue_insert_frag(struct tcp *conn, struct net_buf *frag)
 {
-	struct net_buf *last = NULL;
-	struct net_buf *tmp = buf;
-	uint32_t seq;
-	uint32_t next_seq = 0;
-	bool result = true;
+	uint32_t seq = tcp_get_seq(frag);
+	struct net_buf *prev = NULL;
+	struct net_buf *cur = conn->queue_recv_data->buffer;
 
-	while (tmp) {
-		seq = tcp_get_seq(tmp);
+	/* Skip the fragments that end before the new one starts */
+	while (cur && net_tcp_seq_cmp(tcp_get_seq(cur) + cur->len, seq) <= 0) {
+		prev = cur;
+		cur = cur->frags;
+	}
 
-		NET_DBG("buf %p seq %u len %d", tmp, seq, tmp->len);
+	if (cur && net_tcp_seq_cmp(tcp_get_seq(cur), seq) <= 0) {
+		uint32_t cur_end = tcp_get_seq(cur) + cur->len;
 
-		if (last != NULL) {
-			if (next_seq != seq) {
-				result = false;
-			}
+		if (net_tcp_seq_cmp(cur_end, seq + frag->len) >= 0) {
+			/* Nothing new in this fragment */
+			net_buf_unref(frag);
+			return false;
 		}
 
-		next_seq = seq + tmp->len;
-		last = tmp;
-		tmp = tmp->frags;
+		net_buf_pull(frag, cur_end - seq);
+		seq = cur_end;
+		tcp_set_seq(frag, seq);
+		prev = cur;
+		cur = cur->frags;
 	}
-	return result;
+
+	while (cur && net_tcp_seq_cmp(tcp_get_seq(cur) + cur->len,
+				      seq + frag->len) <= 0) {
+		cur = net_buf_frag_del(prev, cur);
+		if (!prev) {
+			conn->queue_recv_data->buffer = cur;
+		}
+	}
+
+	if (cur && net_tcp_seq_greater(seq + frag->len, tcp_get_seq(cur))) {
+		uint32_t overlap = seq + frag->len - tcp_get_seq(cur);
+
+		net_buf_pull(cur, overlap);
+		tcp_set_seq(cur, tcp_get_seq(cur) + overlap);
+	}
+
+	frag->frags = cur;
+	if (prev) {
+		prev->frags = frag;
+	} else {
+		conn->queue_recv_data->buffer = frag;
+	}
+
+	return true;
 }
 
 static void tcp_queue_recv_data(struct tcp *conn, struct net_pkt *pkt,
 				size_t len, uint32_t seq)
 {
-	uint32_t seq_start = seq;
+	struct net_buf *buf;
 	bool inserted = false;
-	struct net_buf *tmp;
 
 	NET_DBG("conn: %p len %zd seq %u ack %u", conn, len, seq, conn->ack);
 
-	tmp = pkt->buffer;
-
-	tcp_set_seq(tmp, seq);
-	seq += tmp->len;
-	tmp = tmp->frags;
-
-	while (tmp) {
-		tcp_set_seq(tmp, seq);
-		seq += tmp->len;
-		tmp = tmp->frags;
+	/* Do not hold on to data the peer should not have sent */
+	if (net_tcp_seq_greater(seq + len, conn->ack + conn->recv_win)) {
+		NET_DBG("Cannot add new data to queue, outside of window");
+		return;
 	}
 
 	if (IS_ENABLED(CONFIG_NET_TCP_LOG_LEVEL_DBG)) {
 		NET_DBG("Queuing data: conn %p", conn);
 	}
 
-	if (!net_pkt_is_empty(conn->queue_recv_data)) {
-		/* Place the data to correct place in the list. If the data
-		 * would not be sequential, then drop this packet.
-		 *
-		 * Only work with subtractions between sequence numbers in uint32_t format
-		 * to proper handle cases that are around the wrapping point.
-		 */
-
-		/* Some potentential cases:
-		 * Note: MI = MAX_INT
-		 * Packet | Queued| End off1  | Start off| End off2    | Required handling
-		 * Seq|Len|Seq|Len|           |          |             |
-		 *  3 | 3 | 6 | 4 | 3+3-6=  0 | NA       | NA          | Prepend
-		 *  3 | 4 | 6 | 4 | 3+4-6 = 1 | NA       | NA          | Prepend, pull from buffer
-		 *  3 | 7 | 6 | 4 | 3+7-6 = 4 | 6-3=3    | 6+4-3=7     | Drop queued data
-		 *  3 | 8 | 6 | 4 | 3+8-6 = 5 | 6-3=3    | 6+4-3=7     | Drop queued data
-		 *  6 | 5 | 6 | 4 | 6+5-6 = 5 | 6-6=0    | 6+4-6=4     | Drop queued data
-		 *  6 | 4 | 6 | 4 | 6+4-6 = 4 | 6-6=0    | 6+4-6=4     | Drop queued data / packet
-		 *  7 | 2 | 6 | 4 | 7+2-6 = 3 | 6-7=MI   | 6+4-7=3     | Drop packet
-		 * 10 | 2 | 6 | 4 | 10+2-6= 6 | 6-10=MI-3| 6+4-10=0    | Append
-		 *  7 | 4 | 6 | 4 | 7+4-6 = 5 | 6-7 =MI  | 6+4-7 =3    | Append, pull from packet
-		 * 11 | 2 | 6 | 4 | 11+2-6= 7 | 6-11=MI-6| 6+4-11=MI-1 | Drop incoming packet
-		 *  2 | 3 | 6 | 4 | 2+3-6= MI | 6-2=4    | 6+4-2=8     | Drop incoming packet
-		 */
-
-		uint32_t pending_seq;
-		uint32_t start_offset;
-		uint32_t end_offset;
-		size_t pending_len;
-
-		pending_seq = tcp_get_seq(conn->queue_recv_data->buffer);
-		end_offset = seq - pending_seq;
-		pending_len = net_pkt_get_len(conn->queue_recv_data);
-		if (end_offset < pending_len) {
-			if (end_offset < len) {
-				if (end_offset) {
-					net_pkt_remove_tail(pkt, end_offset);
-				}
-
-				/* Put new data before the pending data */
-				net_buf_frag_add(pkt->buffer,
-						 conn->queue_recv_data->buffer);
-				NET_DBG("Adding at before queue, end_offset %i, pending_len %zu",
-					end_offset, pending_len);
-				conn->queue_recv_data->buffer = pkt->buffer;
-				inserted = true;
-			}
-		} else {
-			struct net_buf *last;
-
-			last = net_buf_frag_last(conn->queue_recv_data->buffer);
-			pending_seq = tcp_get_seq(last);
+	/* The fragments are inserted one by one, so the received data is now
+	 * owned by the queue and the pkt can be freed by the caller.
+	 */
+	buf = pkt->buffer;
+	pkt->buffer = NULL;
 
-			start_offset = pending_seq - seq_start;
-			/* Compute the offset w.r.t. the start point of the new packet */
-			end_offset = (pending_seq + last->len) - seq_start;
+	while (buf) {
+		struct net_buf *next = buf->frags;
 
-			/* Check if queue start with within the within the new packet */
-			if ((start_offset < len) && (end_offset <= len)) {
-				/* The queued data is irrelevant since the new packet overlaps the
-				 * new packet, take the new packet as contents
-				 */
-				net_buf_unref(conn->queue_recv_data->buffer);
-				conn->queue_recv_data->buffer = pkt->buffer;
-				inserted = true;
-			} else {
-				if (end_offset < len) {
-					if (end_offset) {
-						net_pkt_remove_tail(conn->queue_recv_data,
-								    end_offset);
-					}
+		buf->frags = NULL;
+		tcp_set_seq(buf, seq);
+		seq += buf->len;
 
-					/* Put new data after pending data */
-					NET_DBG("Adding at end of queue, start %i, end %i, len %zu",
-						start_offset, end_offset, len);
-					net_buf_frag_add(conn->queue_recv_data->buffer,
-							 pkt->buffer);
-					inserted = true;
-				}
-			}
+		if (buf->len == 0) {
+			net_buf_unref(buf);
+		} else if (tcp_queue_insert_frag(conn, buf)) {
+			inserted = true;
 		}
 
-		if (inserted) {
-			NET_DBG("All pending data: conn %p", conn);
-			if (check_seq_list(conn->queue_recv_data->buffer) == false) {
-				NET_ERR("Incorrect order in out of order sequence for conn %p",
-					conn);
-				/* error in sequence list, drop it */
-				net_buf_unref(conn->queue_recv_data->buffer);
-				conn->queue_recv_data->buffer = NULL;
-			}
-		} else {
-			NET_DBG("Cannot add new data to queue");
-		}
-	} else {
-		net_pkt_append_buffer(conn->queue_recv_data, pkt->buffer);
-		inserted = true;
+		buf = next;
 	}
 
 	if (inserted) {
-		/* We need to keep the received data but free the pkt */
-		pkt->buffer = NULL;
+#if defined(CONFIG_NET_TCP_SACK)
+		conn->sack.last_queued = seq - len;
+#endif
 
 		if (!k_work_delayable_is_pending(&conn->recv_queue_timer)) {
 			k_work_reschedule_for_queue(
 				&tcp_work_q, &conn->recv_queue_timer,
 				K_MSEC(CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT));
 		}
+	} else {
+		NET_DBG("Cannot add new data to queue");
 	}
 }
 
@@ -2869,8 +3281,13 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
+#if defined(CONFIG_NET_TCP_SACK)
+	conn->recv_options.sack_count = 0;
+#endif
+
 	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
-						  tcp_options_len)) {
+						  tcp_options_len,
+						  (th_flags(th) & SYN) != 0)) {
 		NET_DBG("DROP: Invalid TCP option list");
 		tcp_out(conn, RST);
 		do_close = true;
@@ -2928,6 +3345,7 @@ next_state:
 		if (FL(&fl, ==, SYN)) {
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+			tcp_sack_negotiate(conn);
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
 			conn->send_options.mss_found = false;
@@ -2964,6 +3382,7 @@ next_state:
 				accept_cb = conn->accepted_conn->accept_cb;
 				context = conn->accepted_conn->context;
 				keep_alive_param_copy(conn, conn->accepted_conn);
+				tcp_ca_param_copy(conn, conn->accepted_conn);
 			}
 
 			k_work_cancel_delayable(&conn->establish_timer);
@@ -3053,6 +3472,7 @@ next_state:
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			tcp_send_timer_cancel(conn);
+			tcp_sack_negotiate(conn);
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
@@ -3136,6 +3556,10 @@ next_state:
 		 */
 		keep_alive_timer_restart(conn);
 
+		if (th) {
+			tcp_sack_received(conn, th_ack(th));
+		}
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (th && (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0)) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -3163,6 +3587,10 @@ next_state:
 
 				(void)tcp_send_data(conn);
 
+				tcp_sack_recovery_start(conn,
+							conn->seq + conn->unacked_len,
+							conn->seq + temp_unacked_len);
+
 				/* Restore the current transmission */
 				conn->unacked_len = temp_unacked_len;
 
@@ -3170,6 +3598,11 @@ next_state:
 				if (tcp_window_full(conn)) {
 					(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
 				}
+			} else if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
+				   (conn->dup_ack_cnt > DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) &&
+				   (len == 0)) {
+				/* Every further duplicate ACK repairs one more hole */
+				tcp_sack_retransmit_hole(conn);
 			}
 		}
 #endif
@@ -3230,6 +3663,7 @@ next_state:
 				tcp_derive_rto(conn);
 			}
 			conn->data_mode = TCP_DATA_MODE_SEND;
+			tcp_sack_acked(conn);
 			if (conn->send_data_total > 0) {
 				k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer,
 					    K_MSEC(TCP_RTO_MS));
@@ -4108,7 +4542,7 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 	enum net_if_checksum_type type = net_pkt_family(pkt) == AF_INET6 ?
 		NET_IF_CHECKSUM_IPV6_TCP : NET_IF_CHECKSUM_IPV4_TCP;
 
-	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
+	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) && !net_pkt_is_gro(pkt) &&
 	    (net_if_need_calc_rx_checksum(net_pkt_iface(pkt), type) ||
 	     net_pkt_is_ip_reassembled(pkt)) &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
@@ -4554,6 +4988,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = set_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4591,6 +5028,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
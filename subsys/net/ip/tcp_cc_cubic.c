@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* CUBIC congestion control, implementation according to RFC9438.
+ *
+ * Integer arithmetic only: windows are kept in bytes and time in
+ * milliseconds, C = 0.4 and beta_cubic = 0.7 are folded into the constants.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include "tcp_internal.h"
+
+/* beta_cubic = 7 / 10 */
+#define CUBIC_BETA_NUM 7
+#define CUBIC_BETA_DEN 10
+
+/* Fast convergence, (1 + beta_cubic) / 2 = 17 / 20 */
+#define CUBIC_FC_NUM 17
+#define CUBIC_FC_DEN 20
+
+/* alpha_cubic = 3 * (1 - beta_cubic) / (1 + beta_cubic) = 9 / 17 */
+#define CUBIC_ALPHA_NUM 9
+#define CUBIC_ALPHA_DEN 17
+
+/* Limit of |t - K| in ms, keeps 4 * dt^3 * mss within 64 bits. The window
+ * is capped well before this is reached.
+ */
+#define CUBIC_DT_MAX_MS 30000
+
+static void tcp_cubic_log(struct tcp *conn, char *step)
+{
+	NET_DBG("conn: %p, cubic %s, cwnd=%d, ssthres=%d, w_max=%u, k=%u",
+		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
+		conn->cubic.w_max, conn->cubic.k);
+}
+
+static uint32_t tcp_cubic_cbrt(uint64_t x)
+{
+	uint64_t y = 0;
+
+	for (int s = 63; s >= 0; s -= 3) {
+		uint64_t b;
+
+		y <<= 1;
+		b = 3 * y * (y + 1) + 1;
+		if ((x >> s) >= b) {
+			x -= b << s;
+			y++;
+		}
+	}
+
+	return (uint32_t)y;
+}
+
+/* K = cbrt((W_max - cwnd) / C) in seconds, with the window in segments.
+ * In ms and bytes this is cbrt((w_max - cwnd) * 2.5e9 / mss).
+ */
+static uint32_t tcp_cubic_k(uint32_t diff, uint32_t mss)
+{
+	return tcp_cubic_cbrt((uint64_t)diff * 2500000000ULL / mss);
+}
+
+/* W_cubic(t) = C * (t - K)^3 + W_max, with the window in segments. In ms and
+ * bytes this is origin + 4 * (t - K)^3 * mss / 1e10.
+ */
+static uint32_t tcp_cubic_window(struct tcp *conn, uint32_t t, uint32_t mss)
+{
+	int64_t dt = CLAMP((int64_t)t - conn->cubic.k, -CUBIC_DT_MAX_MS, CUBIC_DT_MAX_MS);
+	int64_t w = conn->cubic.origin + 4 * dt * dt * dt * mss / 10000000000LL;
+
+	return CLAMP(w, 0, UINT32_MAX);
+}
+
+static void tcp_cubic_epoch_start(struct tcp *conn, uint32_t mss)
+{
+	conn->cubic.epoch_start = k_uptime_get_32();
+	conn->cubic.in_epoch = true;
+	conn->cubic.w_est = conn->ca.cwnd;
+
+	if (conn->ca.cwnd < conn->cubic.w_max) {
+		conn->cubic.k = tcp_cubic_k(conn->cubic.w_max - conn->ca.cwnd, mss);
+		conn->cubic.origin = conn->cubic.w_max;
+	} else {
+		conn->cubic.k = 0;
+		conn->cubic.origin = conn->ca.cwnd;
+	}
+}
+
+/* Congestion event, remember where it happened and reduce ssthresh */
+static void tcp_cubic_reduce(struct tcp *conn)
+{
+	uint32_t cwnd = conn->ca.cwnd;
+
+	/* Fast convergence, release bandwidth to newer flows */
+	if (cwnd < conn->cubic.w_max) {
+		conn->cubic.w_max = cwnd * CUBIC_FC_NUM / CUBIC_FC_DEN;
+	} else {
+		conn->cubic.w_max = cwnd;
+	}
+
+	conn->ca.ssthresh = MAX(conn_mss(conn) * 2, cwnd * CUBIC_BETA_NUM / CUBIC_BETA_DEN);
+	conn->cubic.in_epoch = false;
+}
+
+static void tcp_cubic_init(struct tcp *conn)
+{
+	memset(&conn->cubic, 0, sizeof(conn->cubic));
+	tcp_new_reno_init(conn);
+}
+
+static void tcp_cubic_fast_retransmit(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		tcp_cubic_reduce(conn);
+		/* Account for the lost segments */
+		conn->ca.cwnd = MIN(conn_mss(conn) * 3 + conn->ca.ssthresh, UINT16_MAX);
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		tcp_cubic_log(conn, "fast_retransmit");
+	}
+}
+
+static void tcp_cubic_timeout(struct tcp *conn)
+{
+	tcp_cubic_reduce(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_cubic_log(conn, "timeout");
+}
+
+static void tcp_cubic_avoidance(struct tcp *conn, uint32_t acked_len)
+{
+	uint32_t mss = conn_mss(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+	uint32_t target;
+
+	if (!conn->cubic.in_epoch) {
+		tcp_cubic_epoch_start(conn, mss);
+	}
+
+	target = tcp_cubic_window(conn, k_uptime_get_32() - conn->cubic.epoch_start, mss);
+	target = CLAMP(target, cwnd, cwnd + cwnd / 2);
+
+	/* Window a Reno flow would have reached, CUBIC must not be slower */
+	conn->cubic.w_est += (uint64_t)CUBIC_ALPHA_NUM * acked_len * mss /
+			     ((uint64_t)CUBIC_ALPHA_DEN * cwnd);
+
+	if (conn->cubic.w_est > target) {
+		cwnd = conn->cubic.w_est;
+	} else if (target > cwnd) {
+		cwnd += MAX((uint64_t)(target - cwnd) * acked_len / cwnd, 1);
+	}
+
+	conn->ca.cwnd = MIN(cwnd, UINT16_MAX);
+}
+
+static void tcp_cubic_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	if (tcp_new_reno_recovery(conn, acked_len)) {
+		tcp_cubic_log(conn, "recovery");
+		return;
+	}
+
+	if (conn->ca.cwnd < conn->ca.ssthresh) {
+		uint32_t new_win = conn->ca.cwnd + MIN(acked_len, conn_mss(conn));
+
+		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	} else {
+		tcp_cubic_avoidance(conn, acked_len);
+	}
+
+	tcp_cubic_log(conn, "pkts_acked");
+}
+
+TCP_CA_OPS_DEFINE(tcp_ca_cubic,
+	.name = "cubic",
+	.init = tcp_cubic_init,
+	.fast_retransmit = tcp_cubic_fast_retransmit,
+	.timeout = tcp_cubic_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_cubic_pkts_acked,
+);
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* New Reno congestion control, implementation according to RFC6582 */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include "tcp_internal.h"
+
+#define TCP_CONGESTION_INITIAL_SSTHRESH 3
+
+/* Bytes per segment in the RFC 6928 upper bound of the initial window */
+#define TCP_CONGESTION_INITIAL_WIN_SEG_BYTES 1460
+
+static void tcp_new_reno_log(struct tcp *conn, char *step)
+{
+	NET_DBG("conn: %p, ca %s, cwnd=%d, ssthres=%d, fast_pend=%i",
+		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
+		conn->ca.pending_fast_retransmit_bytes);
+}
+
+uint16_t tcp_ca_initial_cwnd(struct tcp *conn)
+{
+	uint32_t mss = conn_mss(conn);
+	uint32_t cwnd = mss * CONFIG_NET_TCP_INITIAL_CWND;
+
+	/* RFC 6928: min(10 * MSS, max(2 * MSS, 14600)), so that a large MSS
+	 * does not make the initial burst larger than intended.
+	 */
+	if (CONFIG_NET_TCP_INITIAL_CWND > 2) {
+		cwnd = MIN(cwnd, MAX(2 * mss, TCP_CONGESTION_INITIAL_WIN_SEG_BYTES *
+					      CONFIG_NET_TCP_INITIAL_CWND));
+	}
+
+	return MIN(cwnd, UINT16_MAX);
+}
+
+void tcp_new_reno_init(struct tcp *conn)
+{
+	uint32_t ssthresh = conn_mss(conn) * TCP_CONGESTION_INITIAL_SSTHRESH;
+
+	conn->ca.cwnd = tcp_ca_initial_cwnd(conn);
+	conn->ca.ssthresh = MIN(MAX(ssthresh, conn->ca.cwnd), UINT16_MAX);
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	tcp_new_reno_log(conn, "init");
+}
+
+static void tcp_new_reno_fast_retransmit(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
+		/* Account for the lost segments */
+		conn->ca.cwnd = conn_mss(conn) * 3 + conn->ca.ssthresh;
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		tcp_new_reno_log(conn, "fast_retransmit");
+	}
+}
+
+static void tcp_new_reno_timeout(struct tcp *conn)
+{
+	conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_new_reno_log(conn, "timeout");
+}
+
+/* For every duplicate ack increment the cwnd by mss */
+void tcp_new_reno_dup_ack(struct tcp *conn)
+{
+	int32_t new_win = conn->ca.cwnd;
+
+	new_win += conn_mss(conn);
+	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	tcp_new_reno_log(conn, "dup_ack");
+}
+
+/* Deflate the window while in fast recovery. Returns false when the
+ * connection was not in fast recovery, and the window should grow.
+ */
+bool tcp_new_reno_recovery(struct tcp *conn, uint32_t acked_len)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		return false;
+	}
+
+	/* Check if it is still in fast recovery mode */
+	if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
+		conn->ca.pending_fast_retransmit_bytes = 0;
+		conn->ca.cwnd = conn->ca.ssthresh;
+	} else {
+		conn->ca.pending_fast_retransmit_bytes -= acked_len;
+		conn->ca.cwnd -= acked_len;
+	}
+
+	return true;
+}
+
+static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	int32_t new_win = conn->ca.cwnd;
+	int32_t win_inc = MIN(acked_len, conn_mss(conn));
+
+	if (!tcp_new_reno_recovery(conn, acked_len)) {
+		if (conn->ca.cwnd < conn->ca.ssthresh) {
+			new_win += win_inc;
+		} else {
+			/* Implement a div_ceil	to avoid rounding to 0 */
+			new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
+		}
+		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	}
+	tcp_new_reno_log(conn, "pkts_acked");
+}
+
+TCP_CA_OPS_DEFINE(tcp_ca_new_reno,
+	.name = "reno",
+	.init = tcp_new_reno_init,
+	.fast_retransmit = tcp_new_reno_fast_retransmit,
+	.timeout = tcp_new_reno_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_new_reno_pkts_acked,
+);
@@ -5,6 +5,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <zephyr/sys/iterable_sections.h>
+
 #include "tp.h"
 
 #define is(_a, _b) (strcmp((_a), (_b)) == 0)
@@ -227,20 +229,55 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* Without timestamps, four SACK blocks fit into the 40 byte option space */
+#define NET_TCP_SACK_MAX_BLOCKS   4
+
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
+#if defined(CONFIG_NET_TCP_SACK)
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+	uint8_t sack_count;
+#endif
 	bool mss_found : 1;
 	bool wnd_found : 1;
+	bool sack_perm_found : 1;
 };
 
+#if defined(CONFIG_NET_TCP_SACK)
+struct tcp_sack {
+	/* Ranges above the cumulative ACK the peer has reported as received,
+	 * sorted by sequence number and not overlapping.
+	 */
+	struct tcp_sack_block scoreboard[NET_TCP_SACK_MAX_BLOCKS];
+	/* Highest sequence number sent when the loss recovery started */
+	uint32_t recover;
+	/* Next sequence number to consider for a hole retransmission */
+	uint32_t rexmit;
+	/* Start of the most recently queued out-of-order segment */
+	uint32_t last_queued;
+	uint8_t count;
+	bool permitted : 1;
+	bool in_recovery : 1;
+};
+#endif
+
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
 struct tcp_collision_avoidance_reno {
@@ -248,11 +285,56 @@ struct tcp_collision_avoidance_reno {
 	uint16_t ssthresh;
 	uint16_t pending_fast_retransmit_bytes;
 };
+
+#if defined(CONFIG_NET_TCP_CC_CUBIC)
+struct tcp_ca_cubic {
+	uint32_t epoch_start; /* ms, start of the current growth epoch */
+	uint32_t k;           /* ms, time to reach origin from epoch_start */
+	uint32_t origin;      /* bytes, plateau of the cubic function */
+	uint32_t w_max;       /* bytes, window before the last reduction */
+	uint32_t w_est;       /* bytes, Reno-friendly window estimate */
+	bool in_epoch : 1;
+};
+#endif
 #endif
 
 struct tcp;
 typedef void (*net_tcp_closed_cb_t)(struct tcp *conn, void *user_data);
 
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+
+/* Longest congestion control algorithm name, including the NUL */
+#define TCP_CA_NAME_MAX 16
+
+/* Congestion control algorithm. The callbacks are called with the
+ * connection locked, and keep conn->ca.cwnd and conn->ca.ssthresh up to date.
+ */
+struct tcp_ca_ops {
+	const char *name;
+	/* Connection established */
+	void (*init)(struct tcp *conn);
+	/* Third duplicate ACK, the first lost segment is resent */
+	void (*fast_retransmit)(struct tcp *conn);
+	/* Retransmission timer expired */
+	void (*timeout)(struct tcp *conn);
+	/* Duplicate ACK received */
+	void (*dup_ack)(struct tcp *conn);
+	/* New data acknowledged */
+	void (*pkts_acked)(struct tcp *conn, uint32_t acked_len);
+};
+
+#define TCP_CA_OPS_DEFINE(_name, ...)					\
+	static const STRUCT_SECTION_ITERABLE(tcp_ca_ops, _name) = {	\
+		__VA_ARGS__						\
+	}
+
+/* New Reno building blocks, shared with the other algorithms */
+uint16_t tcp_ca_initial_cwnd(struct tcp *conn);
+void tcp_new_reno_init(struct tcp *conn);
+void tcp_new_reno_dup_ack(struct tcp *conn);
+bool tcp_new_reno_recovery(struct tcp *conn, uint32_t acked_len);
+#endif /* CONFIG_NET_TCP_CONGESTION_AVOIDANCE */
+
 struct tcp { /* TCP connection */
 	sys_snode_t next;
 	struct net_context *context;
@@ -323,7 +405,14 @@ struct tcp { /* TCP connection */
 	uint16_t rto;
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+	const struct tcp_ca_ops *ca_ops;
 	struct tcp_collision_avoidance_reno ca;
+#if defined(CONFIG_NET_TCP_CC_CUBIC)
+	struct tcp_ca_cubic cubic;
+#endif
+#endif
+#if defined(CONFIG_NET_TCP_SACK)
+	struct tcp_sack sack;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -423,6 +423,27 @@ static void print_tc_rx_stats(const struct shell *sh, struct net_if *iface)
 #endif /* NET_TC_RX_COUNT > 1 */
 }
 
+static void print_rx_queue_stats(const struct shell *sh, struct net_if *iface)
+{
+#if NET_TC_RX_QUEUES > 1
+	int i;
+
+	PR("RX queue statistics:\n");
+	PR("TC.Q  Recv pkts\tDrop pkts\tbytes\n");
+
+	for (i = 0; i < NET_TC_RX_QUEUE_COUNT; i++) {
+		PR("[%d.%d] %d\t\t%d\t\t%d\n",
+		   i / NET_TC_RX_QUEUES, i % NET_TC_RX_QUEUES,
+		   GET_STAT(iface, rx_queue[i].pkts),
+		   GET_STAT(iface, rx_queue[i].dropped),
+		   GET_STAT(iface, rx_queue[i].bytes));
+	}
+#else
+	ARG_UNUSED(sh);
+	ARG_UNUSED(iface);
+#endif /* NET_TC_RX_QUEUES > 1 */
+}
+
 static void print_net_pm_stats(const struct shell *sh, struct net_if *iface)
 {
 #if defined(CONFIG_NET_STATISTICS_POWER_MANAGEMENT)
@@ -566,6 +587,7 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 
 	print_tc_tx_stats(sh, iface);
 	print_tc_rx_stats(sh, iface);
+	print_rx_queue_stats(sh, iface);
 
 #if defined(CONFIG_NET_STATISTICS_ETHERNET) && \
 					defined(CONFIG_NET_STATISTICS_USER_API)
@@ -474,6 +474,88 @@ fail:
 #include <zephyr/syscalls/zsock_sendmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int i;
+	ssize_t bytes_sent = 0;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->sendmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	/* Send the whole batch under a single socket lock, each message
+	 * going through the regular sendmsg path of the socket.
+	 */
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (i = 0; i < vlen; i++) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, sendmsg, sock,
+						&msgvec[i].msg_hdr, flags);
+
+		bytes_sent = vtable->sendmsg(obj, &msgvec[i].msg_hdr, flags);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, sendmsg, sock,
+					       bytes_sent < 0 ? -errno : bytes_sent);
+
+		if (bytes_sent < 0) {
+			break;
+		}
+
+		msgvec[i].msg_len = bytes_sent;
+		sock_obj_core_update_send_stats(sock, bytes_sent);
+	}
+
+	k_mutex_unlock(lock);
+
+	if (i == 0U && bytes_sent < 0) {
+		return -1;
+	}
+
+	return i;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	unsigned int i;
+	ssize_t ret = 0;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(struct mmsghdr)));
+
+	/* Every message needs its own deep copy anyway, so reuse the
+	 * sendmsg verification for each of them. This still saves a
+	 * system call per message.
+	 */
+	for (i = 0; i < vlen; i++) {
+		ret = z_vrfy_zsock_sendmsg(sock, &msgvec[i].msg_hdr, flags);
+		if (ret < 0) {
+			break;
+		}
+
+		msgvec[i].msg_len = ret;
+	}
+
+	if (i == 0U && ret < 0) {
+		return -1;
+	}
+
+	return i;
+}
+#include <zephyr/syscalls/zsock_sendmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 ssize_t z_impl_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 			     struct sockaddr *src_addr, socklen_t *addrlen)
 {
@@ -710,6 +792,129 @@ fail:
 #include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int i;
+	ssize_t bytes_received = 0;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->recvmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (i = 0; i < vlen; i++) {
+		int msg_flags = flags & ~ZSOCK_MSG_WAITFORONE;
+
+		if (i > 0U && (flags & ZSOCK_MSG_WAITFORONE) != 0) {
+			msg_flags |= ZSOCK_MSG_DONTWAIT;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, recvmsg, sock,
+						&msgvec[i].msg_hdr, msg_flags);
+
+		bytes_received = vtable->recvmsg(obj, &msgvec[i].msg_hdr, msg_flags);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, recvmsg, sock, &msgvec[i].msg_hdr,
+					       bytes_received < 0 ? -errno : bytes_received);
+
+		if (bytes_received < 0) {
+			break;
+		}
+
+		msgvec[i].msg_len = bytes_received;
+		sock_obj_core_update_recv_stats(sock, bytes_received);
+	}
+
+	k_mutex_unlock(lock);
+
+	if (i == 0U && bytes_received < 0) {
+		return -1;
+	}
+
+	return i;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	unsigned int i;
+	ssize_t ret = 0;
+
+	K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(msgvec, vlen, sizeof(struct mmsghdr)));
+
+	for (i = 0; i < vlen; i++) {
+		int msg_flags = flags & ~ZSOCK_MSG_WAITFORONE;
+
+		if (i > 0U && (flags & ZSOCK_MSG_WAITFORONE) != 0) {
+			msg_flags |= ZSOCK_MSG_DONTWAIT;
+		}
+
+		ret = z_vrfy_zsock_recvmsg(sock, &msgvec[i].msg_hdr, msg_flags);
+		if (ret < 0) {
+			break;
+		}
+
+		msgvec[i].msg_len = ret;
+	}
+
+	if (i == 0U && ret < 0) {
+		return -1;
+	}
+
+	return i;
+}
+#include <zephyr/syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#if defined(CONFIG_NET_SOCKETS_RECV_ZC)
+ssize_t zsock_recvfrom_zc(int sock, struct net_buf **frags, int flags,
+			  struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	void *obj;
+	ssize_t ret;
+
+	if (frags == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	*frags = NULL;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = zvfs_fdtable_call_ioctl((const struct fd_op_vtable *)vtable, obj,
+				      ZFD_IOCTL_RECV_ZC, frags, flags,
+				      src_addr, addrlen);
+
+	k_mutex_unlock(lock);
+
+	sock_obj_core_update_recv_stats(sock, ret);
+
+	return ret;
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_ZC */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
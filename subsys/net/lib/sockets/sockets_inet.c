@@ -1052,6 +1052,41 @@ static int update_msg_controllen(struct msghdr *msg)
 	return 0;
 }
 
+static int zsock_pkt_src_addr(struct net_context *ctx, struct net_pkt *pkt,
+			      struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+	    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+		ret = sock_get_offload_pkt_src_addr(pkt, ctx, src_addr, *addrlen);
+		if (ret < 0) {
+			NET_DBG("sock_get_offload_pkt_src_addr %d", ret);
+			return ret;
+		}
+	} else {
+		ret = sock_get_pkt_src_addr(pkt, net_context_get_proto(ctx),
+					    src_addr, *addrlen);
+		if (ret < 0) {
+			NET_DBG("sock_get_pkt_src_addr %d", ret);
+			return ret;
+		}
+	}
+
+	/* addrlen is a value-result argument, set to actual
+	 * size of source address
+	 */
+	if (src_addr->sa_family == AF_INET) {
+		*addrlen = sizeof(struct sockaddr_in);
+	} else if (src_addr->sa_family == AF_INET6) {
+		*addrlen = sizeof(struct sockaddr_in6);
+	} else {
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
 static ssize_t zsock_recv_dgram(struct net_context *ctx,
 				struct msghdr *msg,
 				void *buf,
@@ -1103,38 +1138,11 @@ static ssize_t zsock_recv_dgram(struct net_context *ctx,
 	net_pkt_cursor_backup(pkt, &backup);
 
 	if (src_addr && addrlen) {
-		if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
-		    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
-			int ret;
-
-			ret  = sock_get_offload_pkt_src_addr(pkt, ctx, src_addr,
-								*addrlen);
-			if (ret < 0) {
-				errno = -ret;
-				NET_DBG("sock_get_offload_pkt_src_addr %d", ret);
-				goto fail;
-			}
-		} else {
-			int ret;
-
-			ret = sock_get_pkt_src_addr(pkt, net_context_get_proto(ctx),
-						   src_addr, *addrlen);
-			if (ret < 0) {
-				errno = -ret;
-				NET_DBG("sock_get_pkt_src_addr %d", ret);
-				goto fail;
-			}
-		}
+		int ret;
 
-		/* addrlen is a value-result argument, set to actual
-		 * size of source address
-		 */
-		if (src_addr->sa_family == AF_INET) {
-			*addrlen = sizeof(struct sockaddr_in);
-		} else if (src_addr->sa_family == AF_INET6) {
-			*addrlen = sizeof(struct sockaddr_in6);
-		} else {
-			errno = ENOTSUP;
+		ret = zsock_pkt_src_addr(ctx, pkt, src_addr, addrlen);
+		if (ret < 0) {
+			errno = -ret;
 			goto fail;
 		}
 	}
@@ -1314,6 +1322,209 @@ static size_t zsock_recv_stream_immediate(struct net_context *ctx, uint8_t **buf
 	return recv_len;
 }
 
+#if defined(CONFIG_NET_SOCKETS_RECV_ZC)
+/* Detach the unread part of the packet as a fragment chain. The chain is
+ * shared when the packet or one of its fragments is referenced elsewhere,
+ * e.g. by a packet socket, so work on a private copy in that case.
+ */
+static struct net_buf *zsock_pkt_lend(struct net_pkt *pkt, size_t *len)
+{
+	struct net_pkt *owner = pkt;
+	struct net_buf *frags;
+	struct net_buf *cur;
+
+	*len = net_pkt_remaining_data(pkt);
+
+	for (frags = pkt->buffer; frags != NULL; frags = frags->frags) {
+		if (frags->ref > 1) {
+			break;
+		}
+	}
+
+	if (frags != NULL || atomic_get(&pkt->atomic_ref) > 1) {
+		owner = net_pkt_clone(pkt, K_NO_WAIT);
+		if (owner == NULL) {
+			return NULL;
+		}
+	}
+
+	cur = owner->cursor.buf;
+	frags = owner->buffer;
+
+	/* Drop the protocol headers and the data already read */
+	while (frags != NULL && frags != cur) {
+		frags = net_buf_frag_del(NULL, frags);
+	}
+
+	if (cur != NULL) {
+		net_buf_pull(cur, owner->cursor.pos - cur->data);
+	}
+
+	owner->buffer = NULL;
+	net_pkt_cursor_init(owner);
+
+	if (owner != pkt) {
+		net_pkt_unref(owner);
+	}
+
+	return frags;
+}
+
+static ssize_t zsock_recv_zc_dgram(struct net_context *ctx, struct net_buf **frags,
+				   k_timeout_t timeout, struct sockaddr *src_addr,
+				   socklen_t *addrlen)
+{
+	struct net_pkt *pkt;
+	size_t len = 0;
+	int ret;
+
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	pkt = k_fifo_get(&ctx->recv_q, timeout);
+	if (pkt == NULL) {
+		return -EAGAIN;
+	}
+
+	if (src_addr != NULL && addrlen != NULL) {
+		ret = zsock_pkt_src_addr(ctx, pkt, src_addr, addrlen);
+		if (ret < 0) {
+			net_pkt_unref(pkt);
+			return ret;
+		}
+	}
+
+	*frags = zsock_pkt_lend(pkt, &len);
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	net_pkt_unref(pkt);
+
+	if (*frags == NULL && len > 0) {
+		return -ENOBUFS;
+	}
+
+	return len;
+}
+
+static ssize_t zsock_recv_zc_stream(struct net_context *ctx, struct net_buf **frags,
+				    k_timeout_t timeout)
+{
+	struct net_pkt *pkt;
+	k_timepoint_t end;
+	size_t len = 0;
+	int ret;
+
+	if (!net_context_is_used(ctx)) {
+		return -EBADF;
+	}
+
+	if (net_context_get_state(ctx) != NET_CONTEXT_CONNECTED) {
+		return -ENOTCONN;
+	}
+
+	for (end = sys_timepoint_calc(timeout); ; timeout = sys_timepoint_timeout(end)) {
+		if (sock_is_error(ctx)) {
+			return -POINTER_TO_INT(ctx->user_data);
+		}
+
+		if (sock_is_eof(ctx)) {
+			return 0;
+		}
+
+		if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			ret = zsock_wait_data(ctx, &timeout);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+
+		pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+		if (pkt == NULL) {
+			if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				return -EAGAIN;
+			}
+
+			continue;
+		}
+
+		if (net_pkt_remaining_data(pkt) > 0) {
+			*frags = zsock_pkt_lend(pkt, &len);
+			if (*frags == NULL) {
+				/* Put the packet back so that no data is lost
+				 * from the stream, it is retried by the next call.
+				 */
+				k_queue_prepend(&ctx->recv_q._queue, pkt);
+				return -ENOBUFS;
+			}
+		}
+
+		if (net_pkt_eof(pkt)) {
+			sock_set_eof(ctx);
+		}
+
+		if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+		    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+			net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+		}
+
+		net_pkt_unref(pkt);
+
+		if (len == 0) {
+			/* Nothing to lend, e.g. the FIN marker */
+			continue;
+		}
+
+		net_context_update_recv_wnd(ctx, len);
+
+		return len;
+	}
+}
+
+static ssize_t zsock_recvfrom_zc_ctx(struct net_context *ctx, struct net_buf **frags,
+				     int flags, struct sockaddr *src_addr,
+				     socklen_t *addrlen)
+{
+	enum net_sock_type sock_type = net_context_get_type(ctx);
+	enum net_ip_protocol proto = net_context_get_proto(ctx);
+	k_timeout_t timeout = K_FOREVER;
+	ssize_t ret;
+
+	if ((flags & ~ZSOCK_MSG_DONTWAIT) != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+	}
+
+	if (sock_type == SOCK_DGRAM && proto == IPPROTO_UDP) {
+		ret = zsock_recv_zc_dgram(ctx, frags, timeout, src_addr, addrlen);
+	} else if (sock_type == SOCK_STREAM && proto == IPPROTO_TCP) {
+		ret = zsock_recv_zc_stream(ctx, frags, timeout);
+	} else {
+		ret = -EOPNOTSUPP;
+	}
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return ret;
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_ZC */
+
 static int zsock_fionread_ctx(struct net_context *ctx)
 {
 	size_t ret = zsock_recv_stream_immediate(ctx, NULL, NULL, 0);
@@ -1604,6 +1815,8 @@ static enum tcp_conn_option get_tcp_option(int optname)
 		return TCP_OPT_KEEPINTVL;
 	case TCP_KEEPCNT:
 		return TCP_OPT_KEEPCNT;
+	case TCP_CONGESTION:
+		return TCP_OPT_CONGESTION;
 	}
 
 	return -EINVAL;
@@ -1888,6 +2101,21 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 				return 0;
 			}
 
+			break;
+
+		case TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_get_option(ctx,
+							 TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
 			break;
 		}
 
@@ -2493,6 +2721,21 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 				return 0;
 			}
 
+			break;
+
+		case TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_set_option(ctx,
+							 TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
 			break;
 		}
 		break;
@@ -2919,6 +3162,22 @@ static int sock_ioctl_vmeth(void *obj, unsigned int request, va_list args)
 		return 0;
 	}
 
+#if defined(CONFIG_NET_SOCKETS_RECV_ZC)
+	case ZFD_IOCTL_RECV_ZC: {
+		struct net_buf **frags;
+		struct sockaddr *src_addr;
+		socklen_t *addrlen;
+		int flags;
+
+		frags = va_arg(args, struct net_buf **);
+		flags = va_arg(args, int);
+		src_addr = va_arg(args, struct sockaddr *);
+		addrlen = va_arg(args, socklen_t *);
+
+		return zsock_recvfrom_zc_ctx(obj, frags, flags, src_addr, addrlen);
+	}
+#endif
+
 	default:
 		errno = EOPNOTSUPP;
 		return -1;
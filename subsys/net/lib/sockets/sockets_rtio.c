@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/socket_rtio.h>
+#include <zephyr/rtio/work.h>
+
+static ssize_t zsock_rtio_rx(struct rtio_iodev_sqe *iodev_sqe, int sock)
+{
+	const struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	uint32_t buf_len;
+	uint8_t *buf;
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_SOCKETS_RECV_ZC) &&
+	    (sqe->iodev_flags & ZSOCK_RTIO_RECV_ZC) != 0) {
+		if (sqe->rx.buf_len < sizeof(struct net_buf *)) {
+			return -EINVAL;
+		}
+
+		return zsock_recvfrom_zc(sock, (struct net_buf **)sqe->rx.buf, 0,
+					 NULL, NULL);
+	}
+
+	ret = rtio_sqe_rx_buf(iodev_sqe, 1, sqe->rx.buf_len, &buf, &buf_len);
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return zsock_recv(sock, buf, buf_len, 0);
+}
+
+static void zsock_rtio_submit_sync(struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	const struct zsock_rtio_iodev_data *data = sqe->iodev->data;
+	ssize_t ret;
+
+	if (data->sock < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, -EBADF);
+		return;
+	}
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		ret = zsock_rtio_rx(iodev_sqe, data->sock);
+		break;
+	case RTIO_OP_TX:
+		ret = zsock_send(data->sock, sqe->tx.buf, sqe->tx.buf_len, 0);
+		break;
+	case RTIO_OP_TINY_TX:
+		ret = zsock_send(data->sock, sqe->tiny_tx.buf, sqe->tiny_tx.buf_len, 0);
+		break;
+	default:
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	if (ret < 0) {
+		NET_DBG("sock %d op %d failed (%d)", data->sock, sqe->op, errno);
+		rtio_iodev_sqe_err(iodev_sqe, -errno);
+		return;
+	}
+
+	rtio_iodev_sqe_ok(iodev_sqe, ret);
+}
+
+static void zsock_rtio_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct rtio_work_req *req = rtio_work_req_alloc();
+
+	if (req == NULL) {
+		NET_DBG("RTIO work item allocation failed");
+		rtio_iodev_sqe_err(iodev_sqe, -ENOMEM);
+		return;
+	}
+
+	/* Socket calls block, run them in the RTIO work queue */
+	rtio_work_req_submit(req, iodev_sqe, zsock_rtio_submit_sync);
+}
+
+const struct rtio_iodev_api zsock_rtio_iodev_api = {
+	.submit = zsock_rtio_submit,
+};
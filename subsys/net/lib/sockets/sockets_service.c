@@ -10,7 +10,7 @@ LOG_MODULE_REGISTER(net_sock_svc, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
 #include <zephyr/net/socket_service.h>
-#include <zephyr/zvfs/eventfd.h>
+#include <zephyr/zvfs/epoll.h>
 
 static int init_socket_service(void);
 
@@ -28,13 +28,14 @@ static K_CONDVAR_DEFINE(wait_start);
 STRUCT_SECTION_START_EXTERN(net_socket_service_desc);
 STRUCT_SECTION_END_EXTERN(net_socket_service_desc);
 
+/* How many ready sockets are handled for each wait */
+#define SOCKET_SERVICE_EVENTS 4
+
 static struct service {
-	struct zsock_pollfd events[CONFIG_ZVFS_POLL_MAX];
-	int count;
+	/* Every registered socket is watched by this epoll instance */
+	int epfd;
 } ctx;
 
-#define get_idx(svc) (*(svc->idx))
-
 void net_socket_service_foreach(net_socket_service_cb_t cb, void *user_data)
 {
 	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
@@ -42,9 +43,35 @@ void net_socket_service_foreach(net_socket_service_cb_t cb, void *user_data)
 	}
 }
 
+/* A socket closed while registered is removed from the epoll instance by
+ * the close, and its descriptor may be reused and registered again. The event
+ * that added a descriptor last owns its watch, the other events with that
+ * descriptor are stale and must not remove it.
+ */
+static void release_stale_events(const struct net_socket_service_event *owner)
+{
+	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
+		for (int i = 0; i < svc->pev_len; i++) {
+			if ((&svc->pev[i] != owner) &&
+			    (svc->pev[i].event.fd == owner->event.fd)) {
+				svc->pev[i].event.fd = -1;
+				svc->pev[i].event.events = 0;
+			}
+		}
+	}
+}
+
 static void cleanup_svc_events(const struct net_socket_service_desc *svc)
 {
 	for (int i = 0; i < svc->pev_len; i++) {
+		if (svc->pev[i].event.fd >= 0) {
+			/* Already gone if the socket was closed, and not
+			 * reused by another event, see release_stale_events()
+			 */
+			(void)zvfs_epoll_ctl(ctx.epfd, ZVFS_EPOLL_CTL_DEL,
+					     svc->pev[i].event.fd, NULL);
+		}
+
 		svc->pev[i].event.fd = -1;
 		svc->pev[i].event.events = 0;
 	}
@@ -71,26 +98,45 @@ int z_impl_net_socket_service_register(const struct net_socket_service_desc *svc
 		goto out;
 	}
 
-	if (fds == NULL) {
-		cleanup_svc_events(svc);
-	} else {
-		if (len > svc->pev_len) {
-			NET_DBG("Too many file descriptors, "
-				"max is %d for service %p",
-				svc->pev_len, svc);
-			ret = -ENOMEM;
-			goto out;
+	if (fds != NULL && len > svc->pev_len) {
+		NET_DBG("Too many file descriptors, "
+			"max is %d for service %p",
+			svc->pev_len, svc);
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	cleanup_svc_events(svc);
+
+	ret = 0;
+
+	for (i = 0; fds != NULL && i < len; i++) {
+		struct zvfs_epoll_event ev = {
+			.events = fds[i].events,
+			.data.fd = fds[i].fd,
+		};
+
+		svc->pev[i].event = fds[i];
+		svc->pev[i].user_data = user_data;
+
+		if (fds[i].fd < 0) {
+			continue;
 		}
 
-		for (i = 0; i < len; i++) {
-			svc->pev[i].event = fds[i];
-			svc->pev[i].user_data = user_data;
+		if (zvfs_epoll_ctl(ctx.epfd, ZVFS_EPOLL_CTL_ADD, fds[i].fd, &ev) < 0) {
+			ret = -errno;
+			NET_DBG("Cannot watch socket %d (%d)", fds[i].fd, ret);
+			/* Not ours to remove, e.g. watched by another service */
+			svc->pev[i].event.fd = -1;
+			break;
 		}
+
+		release_stale_events(&svc->pev[i]);
 	}
 
-	/* Tell the thread to re-read the variables */
-	zvfs_eventfd_write(ctx.events[0].fd, 1);
-	ret = 0;
+	if (ret < 0) {
+		cleanup_svc_events(svc);
+	}
 
 out:
 	k_mutex_unlock(&lock);
@@ -114,10 +160,8 @@ static struct net_socket_service_desc *find_svc_and_event(
 	return NULL;
 }
 
-/* We do not set the user callback to our work struct because we need to
- * hook into the flow and restore the global poll array so that the next poll
- * round will not notice it and call the callback again while we are
- * servicing the callback.
+/* The callback gets a copy of the event so that registering the service
+ * again from the callback does not change what the callback is looking at.
  */
 void net_socket_service_callback(struct net_socket_service_event *pev)
 {
@@ -126,49 +170,42 @@ void net_socket_service_callback(struct net_socket_service_event *pev)
 	ev.callback(&ev);
 }
 
-static int call_work(struct zsock_pollfd *pev, struct net_socket_service_event *event)
-{
-	int ret = 0;
-	int fd = pev->fd;
-
-	/* Mark the global fd non pollable so that we do not
-	 * call the callback second time.
-	 */
-	pev->fd = -1;
-
-	/* Synchronous call */
-	net_socket_service_callback(event);
-
-	/* Restore the fd so that new data can be re-triggered */
-	pev->fd = fd;
-
-	return ret;
-}
-
-static int trigger_work(struct zsock_pollfd *pev)
+static int trigger_work(struct zvfs_epoll_event *ev)
 {
 	struct net_socket_service_event *event;
 	struct net_socket_service_desc *svc;
+	struct zsock_pollfd pev = {
+		.fd = ev->data.fd,
+	};
 
-	svc = find_svc_and_event(pev, &event);
+	k_mutex_lock(&lock, K_FOREVER);
+
+	/* The socket may have been unregistered after the wait returned */
+	svc = find_svc_and_event(&pev, &event);
 	if (svc == NULL) {
+		k_mutex_unlock(&lock);
 		return -ENOENT;
 	}
 
 	event->svc = svc;
 
-	/* Copy the triggered event to our event so that we know what
+	/* Copy the triggered events to our event so that we know what
 	 * was actually causing the event.
 	 */
-	event->event = *pev;
+	event->event.revents = ev->events;
+
+	k_mutex_unlock(&lock);
 
-	return call_work(pev, event);
+	/* Synchronous call */
+	net_socket_service_callback(event);
+
+	return 0;
 }
 
 static void socket_service_thread(void)
 {
-	int ret, i, fd, count = 0;
-	zvfs_eventfd_t value;
+	struct zvfs_epoll_event events[SOCKET_SERVICE_EVENTS];
+	int ret, i, count = 0;
 
 	STRUCT_SECTION_COUNT(net_socket_service_desc, &ret);
 	if (ret == 0) {
@@ -176,91 +213,51 @@ static void socket_service_thread(void)
 		goto fail;
 	}
 
-	/* Create contiguous poll event array to enable socket polling */
 	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
 		NET_DBG("Service %s has %d pollable sockets",
 			COND_CODE_1(CONFIG_NET_SOCKETS_LOG_LEVEL_DBG,
 				    (svc->owner), ("")),
 			svc->pev_len);
-		get_idx(svc) = count + 1;
 		count += svc->pev_len;
 	}
 
-	if ((count + 1) > ARRAY_SIZE(ctx.events)) {
+	if (count > CONFIG_ZVFS_EPOLL_MAX_FDS) {
 		NET_ERR("You have %d services to monitor but "
-			"%zd poll entries configured.",
-			count + 1, ARRAY_SIZE(ctx.events));
+			"%d epoll entries configured.",
+			count, CONFIG_ZVFS_EPOLL_MAX_FDS);
 		NET_ERR("Please increase value of %s to at least %d",
-			"CONFIG_ZVFS_POLL_MAX", count + 1);
+			"CONFIG_ZVFS_EPOLL_MAX_FDS", count);
 		goto fail;
 	}
 
 	NET_DBG("Monitoring %d socket entries", count);
 
-	ctx.count = count + 1;
-
-	/* Create an zvfs_eventfd that can be used to trigger events during polling */
-	fd = zvfs_eventfd(0, 0);
-	if (fd < 0) {
-		fd = -errno;
-		NET_ERR("zvfs_eventfd failed (%d)", fd);
-		goto out;
+	/* Sockets are added to the epoll instance when they are registered,
+	 * so a wait only returns those with pending events.
+	 */
+	ctx.epfd = zvfs_epoll_create(0);
+	if (ctx.epfd < 0) {
+		ret = -errno;
+		NET_ERR("zvfs_epoll_create failed (%d)", ret);
+		goto fail;
 	}
 
 	thread_status = SOCKET_SERVICE_THREAD_RUNNING;
 	k_condvar_broadcast(&wait_start);
 
-	ctx.events[0].fd = fd;
-	ctx.events[0].events = ZSOCK_POLLIN;
-
-restart:
-	i = 1;
-
-	k_mutex_lock(&lock, K_FOREVER);
-
-	/* Copy individual events to the big array */
-	STRUCT_SECTION_FOREACH(net_socket_service_desc, svc) {
-		for (int j = 0; j < svc->pev_len; j++) {
-			ctx.events[get_idx(svc) + j] = svc->pev[j].event;
-		}
-	}
-
-	k_mutex_unlock(&lock);
-
 	while (true) {
-		ret = zsock_poll(ctx.events, count + 1, -1);
+		ret = zvfs_epoll_wait(ctx.epfd, events, ARRAY_SIZE(events), -1);
 		if (ret < 0) {
 			ret = -errno;
-			NET_ERR("poll failed (%d)", ret);
+			NET_ERR("epoll wait failed (%d)", ret);
 			goto out;
 		}
 
-		if (ret == 0) {
-			/* should not happen because timeout is -1 */
-			break;
-		}
-
 		/* Process work here */
-		for (i = 1; i < (count + 1); i++) {
-			if (ctx.events[i].fd < 0) {
-				continue;
+		for (i = 0; i < ret; i++) {
+			if (trigger_work(&events[i]) < 0) {
+				NET_DBG("Socket %d no longer registered", events[i].data.fd);
 			}
-
-			if (ctx.events[i].revents > 0) {
-				ret = trigger_work(&ctx.events[i]);
-				if (ret < 0) {
-					NET_DBG("Triggering work failed (%d)", ret);
-					goto restart;
-				}
-			}
-		}
-
-		/* Relocate after trigger work so the work gets done before restarting */
-		if (ret > 0 && ctx.events[0].revents) {
-			zvfs_eventfd_read(ctx.events[0].fd, &value);
-			ctx.events[0].revents = 0;
-			NET_DBG("Received restart event.");
-			goto restart;
 		}
 	}
 
@@ -18,6 +18,16 @@ static uint8_t sample_packet[sizeof(struct zperf_udp_datagram) +
 			     sizeof(struct zperf_client_hdr_v1) +
 			     PACKET_SIZE_MAX];
 
+#define BATCH_HDR_SIZE (sizeof(struct zperf_udp_datagram) + \
+			sizeof(struct zperf_client_hdr_v1))
+
+/* In batch mode each datagram needs its own header, the payload is
+ * shared by all of them.
+ */
+static uint8_t batch_hdr[CONFIG_NET_ZPERF_UDP_BATCH_MAX][BATCH_HDR_SIZE];
+static struct iovec batch_iov[CONFIG_NET_ZPERF_UDP_BATCH_MAX][2];
+static struct mmsghdr batch_msg[CONFIG_NET_ZPERF_UDP_BATCH_MAX];
+
 static struct zperf_async_upload_context udp_async_upload_ctx;
 
 static inline void zperf_upload_decode_stat(const uint8_t *data,
@@ -138,6 +148,64 @@ static inline int zperf_upload_fin(int sock,
 	return 0;
 }
 
+static void udp_fill_header(uint8_t *buf, uint32_t id, uint32_t secs,
+			    uint32_t usecs, int port, uint32_t rate_in_kbps,
+			    uint32_t packet_size)
+{
+	struct zperf_udp_datagram *datagram;
+	struct zperf_client_hdr_v1 *hdr;
+
+	datagram = (struct zperf_udp_datagram *)buf;
+
+	datagram->id = htonl(id);
+	datagram->tv_sec = htonl(secs);
+	datagram->tv_usec = htonl(usecs);
+
+	hdr = (struct zperf_client_hdr_v1 *)(buf + sizeof(*datagram));
+	hdr->flags = 0;
+	hdr->num_of_threads = htonl(1);
+	hdr->port = htonl(port);
+	hdr->buffer_len = sizeof(sample_packet) -
+		sizeof(*datagram) - sizeof(*hdr);
+	hdr->bandwidth = htonl(rate_in_kbps);
+	hdr->num_of_bytes = htonl(packet_size);
+}
+
+/* Send @batch datagrams with consecutive ids in one zsock_sendmmsg()
+ * call. Returns the number of datagrams sent or a negative errno.
+ */
+static int udp_send_batch(int sock, uint32_t first_id, uint32_t batch,
+			  uint32_t secs, uint32_t usecs, int port,
+			  uint32_t rate_in_kbps, uint32_t packet_size)
+{
+	size_t hdr_len = MIN(packet_size, BATCH_HDR_SIZE);
+	int ret;
+
+	for (uint32_t i = 0; i < batch; i++) {
+		udp_fill_header(batch_hdr[i], first_id + i, secs, usecs, port,
+				rate_in_kbps, packet_size);
+
+		batch_iov[i][0].iov_base = batch_hdr[i];
+		batch_iov[i][0].iov_len = hdr_len;
+		batch_iov[i][1].iov_base = sample_packet + hdr_len;
+		batch_iov[i][1].iov_len = packet_size - hdr_len;
+
+		batch_msg[i] = (struct mmsghdr) {
+			.msg_hdr = {
+				.msg_iov = batch_iov[i],
+				.msg_iovlen = 2,
+			},
+		};
+	}
+
+	ret = zsock_sendmmsg(sock, batch_msg, batch, 0);
+	if (ret < 0) {
+		return -errno;
+	}
+
+	return ret;
+}
+
 static int udp_upload(int sock, int port,
 		      const struct zperf_upload_params *param,
 		      struct zperf_results *results)
@@ -145,8 +213,10 @@ static int udp_upload(int sock, int port,
 	uint32_t duration_in_ms = param->duration_ms;
 	uint32_t packet_size = param->packet_size;
 	uint32_t rate_in_kbps = param->rate_kbps;
+	uint32_t batch = CLAMP(param->options.udp_batch, 1U,
+			       CONFIG_NET_ZPERF_UDP_BATCH_MAX);
 	uint32_t packet_duration_us = zperf_packet_duration(packet_size, rate_in_kbps);
-	uint32_t packet_duration = k_us_to_ticks_ceil32(packet_duration_us);
+	uint32_t packet_duration = k_us_to_ticks_ceil32(packet_duration_us * batch);
 	uint32_t delay = packet_duration;
 	uint32_t nb_packets = 0U;
 	int64_t start_time, end_time;
@@ -177,8 +247,6 @@ static int udp_upload(int sock, int port,
 	(void)memset(sample_packet, 'z', sizeof(sample_packet));
 
 	do {
-		struct zperf_udp_datagram *datagram;
-		struct zperf_client_hdr_v1 *hdr;
 		uint64_t usecs64;
 		uint32_t secs, usecs;
 		int64_t loop_time;
@@ -209,30 +277,28 @@ static int udp_upload(int sock, int port,
 		secs = usecs64 / USEC_PER_SEC;
 		usecs = usecs64 - (uint64_t)secs * USEC_PER_SEC;
 
-		/* Fill the packet header */
-		datagram = (struct zperf_udp_datagram *)sample_packet;
-
-		datagram->id = htonl(nb_packets);
-		datagram->tv_sec = htonl(secs);
-		datagram->tv_usec = htonl(usecs);
-
-		hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
-						     sizeof(*datagram));
-		hdr->flags = 0;
-		hdr->num_of_threads = htonl(1);
-		hdr->port = htonl(port);
-		hdr->buffer_len = sizeof(sample_packet) -
-			sizeof(*datagram) - sizeof(*hdr);
-		hdr->bandwidth = htonl(rate_in_kbps);
-		hdr->num_of_bytes = htonl(packet_size);
+		if (batch > 1U) {
+			ret = udp_send_batch(sock, nb_packets, batch, secs, usecs,
+					     port, rate_in_kbps, packet_size);
+			if (ret < 0) {
+				NET_ERR("Failed to send the packets (%d)", -ret);
+				return ret;
+			}
 
-		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
-		if (ret < 0) {
-			NET_ERR("Failed to send the packet (%d)", errno);
-			return -errno;
+			nb_packets += ret;
 		} else {
-			nb_packets++;
+			/* Fill the packet header */
+			udp_fill_header(sample_packet, nb_packets, secs, usecs,
+					port, rate_in_kbps, packet_size);
+
+			/* Send the packet */
+			ret = zsock_send(sock, sample_packet, packet_size, 0);
+			if (ret < 0) {
+				NET_ERR("Failed to send the packet (%d)", errno);
+				return -errno;
+			} else {
+				nb_packets++;
+			}
 		}
 
 		if (IS_ENABLED(CONFIG_NET_ZPERF_LOG_LEVEL_DBG)) {
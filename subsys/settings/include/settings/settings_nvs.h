@@ -42,12 +42,22 @@ struct settings_nvs {
 	struct {
 		uint16_t name_hash;
 		uint16_t name_id;
+#if CONFIG_SETTINGS_NVS_NAME_CACHE_LOAD
+		uint16_t top_hash;
+#endif
 	} cache[CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE];
 
 	uint16_t cache_next;
 	uint16_t cache_total;
 	bool loaded;
 #endif
+#if CONFIG_SETTINGS_NVS_BATCH
+	struct nvs_batch_entry batch[CONFIG_NVS_WRITE_BATCH_MAX_ENTRIES];
+	uint8_t batch_buf[CONFIG_SETTINGS_NVS_BATCH_BUF_SIZE] __aligned(4);
+	size_t batch_count;
+	size_t batch_used;
+	bool batch_active;
+#endif
 };
 
 /* register nvs to be a source of settings */
@@ -74,6 +74,13 @@ struct settings_zms {
 	uint32_t last_hash_id;
 	uint32_t second_to_last_hash_id;
 	uint8_t hash_collision_num;
+#if CONFIG_SETTINGS_ZMS_BATCH
+	struct zms_batch_entry batch[CONFIG_ZMS_WRITE_BATCH_MAX_ENTRIES];
+	uint8_t batch_buf[CONFIG_SETTINGS_ZMS_BATCH_BUF_SIZE] __aligned(4);
+	size_t batch_count;
+	size_t batch_used;
+	bool batch_active;
+#endif
 };
 
 struct settings_hash_linked_list {
@@ -25,6 +25,101 @@ sys_slist_t settings_handlers;
 
 K_MUTEX_DEFINE(settings_lock);
 
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+/* Static handlers sorted by name. The handler of a key is found with a binary
+ * search per name segment of the key. The count is negative while the index
+ * is not built or when the handlers do not fit, lookups then compare every
+ * handler.
+ */
+static struct settings_handler_static *handler_index[CONFIG_SETTINGS_HANDLER_INDEX_SIZE];
+static int handler_index_cnt = -1;
+
+static void settings_handler_index_init(void)
+{
+	int cnt = 0;
+
+	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
+		int pos;
+
+		if (cnt == ARRAY_SIZE(handler_index)) {
+			LOG_WRN("Too many handlers for the index, increase "
+				"CONFIG_SETTINGS_HANDLER_INDEX_SIZE");
+			return;
+		}
+
+		/* insertion sort, done once */
+		for (pos = cnt; pos > 0; pos--) {
+			if (strcmp(handler_index[pos - 1]->name, ch->name) <= 0) {
+				break;
+			}
+			handler_index[pos] = handler_index[pos - 1];
+		}
+		handler_index[pos] = ch;
+		cnt++;
+	}
+
+	handler_index_cnt = cnt;
+}
+
+/* Find the static handler named by the first len characters of name */
+static struct settings_handler_static *settings_handler_index_find(const char *name,
+								     size_t len)
+{
+	int lo = 0;
+	int hi = handler_index_cnt - 1;
+
+	while (lo <= hi) {
+		int mid = lo + (hi - lo) / 2;
+		const char *hname = handler_index[mid]->name;
+		int cmp = strncmp(hname, name, len);
+
+		if ((cmp == 0) && (hname[len] != '\0')) {
+			/* the handler name is longer than the prefix */
+			cmp = 1;
+		}
+
+		if (cmp == 0) {
+			return handler_index[mid];
+		}
+
+		if (cmp < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return NULL;
+}
+
+/* Find the static handler with the longest name matching the key name */
+static struct settings_handler_static *settings_handler_index_lookup(const char *name,
+								       const char **next)
+{
+	struct settings_handler_static *bestmatch = NULL;
+	struct settings_handler_static *ch;
+	const char *seg = name;
+	const char *seg_next;
+	size_t len = 0;
+
+	do {
+		len += settings_name_next(seg, &seg_next);
+
+		ch = settings_handler_index_find(name, len);
+		if (ch) {
+			bestmatch = ch;
+			if (next) {
+				*next = seg_next;
+			}
+		}
+
+		seg = seg_next;
+		len++;
+	} while (seg);
+
+	return bestmatch;
+}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
 
 void settings_store_init(void);
 
@@ -33,6 +128,9 @@ void settings_init(void)
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	sys_slist_init(&settings_handlers);
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	settings_handler_index_init();
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
 	settings_store_init();
 }
 
@@ -142,16 +240,19 @@ int settings_name_next(const char *name, const char **next)
 	return rc;
 }
 
-struct settings_handler_static *settings_parse_and_lookup(const char *name,
-							const char **next)
+static struct settings_handler_static *settings_static_lookup(const char *name,
+							     const char **next)
 {
 	struct settings_handler_static *bestmatch;
 	const char *tmpnext;
 
-	bestmatch = NULL;
-	if (next) {
-		*next = NULL;
+#if defined(CONFIG_SETTINGS_HANDLER_INDEX)
+	if (name && (handler_index_cnt >= 0)) {
+		return settings_handler_index_lookup(name, next);
 	}
+#endif /* CONFIG_SETTINGS_HANDLER_INDEX */
+
+	bestmatch = NULL;
 
 	STRUCT_SECTION_FOREACH(settings_handler_static, ch) {
 		if (!settings_name_steq(name, ch->name, &tmpnext)) {
@@ -172,8 +273,23 @@ struct settings_handler_static *settings_parse_and_lookup(const char *name,
 		}
 	}
 
+	return bestmatch;
+}
+
+struct settings_handler_static *settings_parse_and_lookup(const char *name,
+							const char **next)
+{
+	struct settings_handler_static *bestmatch;
+
+	if (next) {
+		*next = NULL;
+	}
+
+	bestmatch = settings_static_lookup(name, next);
+
 #if defined(CONFIG_SETTINGS_DYNAMIC_HANDLERS)
 	struct settings_handler *ch;
+	const char *tmpnext;
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&settings_handlers, ch, node) {
 		if (!settings_name_steq(name, ch->name, &tmpnext)) {
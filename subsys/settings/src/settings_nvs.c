@@ -33,13 +33,185 @@ static int settings_nvs_load(struct settings_store *cs,
 static int settings_nvs_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len);
 static void *settings_nvs_storage_get(struct settings_store *cs);
+#if CONFIG_SETTINGS_NVS_BATCH
+static int settings_nvs_save_start(struct settings_store *cs);
+static int settings_nvs_save_end(struct settings_store *cs);
+#endif
 
 static struct settings_store_itf settings_nvs_itf = {
 	.csi_load = settings_nvs_load,
+#if CONFIG_SETTINGS_NVS_BATCH
+	.csi_save_start = settings_nvs_save_start,
+	.csi_save_end = settings_nvs_save_end,
+#endif
 	.csi_save = settings_nvs_save,
 	.csi_storage_get = settings_nvs_storage_get
 };
 
+#if CONFIG_SETTINGS_NVS_BATCH
+/* Between settings_nvs_save_start() and settings_nvs_save_end() the entries
+ * written by settings_nvs_save() are staged and committed to NVS as atomic
+ * batches, reads of staged entries are served from the staging buffer.
+ */
+static int settings_nvs_batch_flush(struct settings_nvs *cf)
+{
+	ssize_t rc;
+
+	if (cf->batch_count == 0) {
+		return 0;
+	}
+
+	rc = nvs_write_batch(&cf->cf_nvs, cf->batch, cf->batch_count);
+	if (rc == -EINVAL) {
+		/* The batch does not fit in a sector, write entries one by one.
+		 * A power loss may then leave only some of them updated.
+		 */
+		LOG_WRN("Settings batch of %zu entries too large, not written atomically",
+			cf->batch_count);
+		for (size_t i = 0; (i < cf->batch_count) && (rc >= 0); i++) {
+			rc = nvs_write(&cf->cf_nvs, cf->batch[i].id, cf->batch[i].data,
+				       cf->batch[i].len);
+		}
+	}
+
+	cf->batch_count = 0;
+	cf->batch_used = 0;
+
+	return (rc < 0) ? rc : 0;
+}
+
+/* Replace the staged entry of an id in place if the new value fits in its
+ * room, otherwise drop it so that the new value is staged or written instead.
+ * An id is staged at most once, so the batch commits its last value.
+ *
+ * @return true if the entry was replaced.
+ */
+static bool settings_nvs_batch_replace(struct settings_nvs *cf, uint16_t id, const void *data,
+				       size_t len)
+{
+	for (size_t i = 0; i < cf->batch_count; i++) {
+		struct nvs_batch_entry *entry = &cf->batch[i];
+
+		if (entry->id != id) {
+			continue;
+		}
+
+		if ((entry->len != 0) &&
+		    (ROUND_UP(len, sizeof(uint32_t)) <= ROUND_UP(entry->len, sizeof(uint32_t)))) {
+			memcpy((void *)entry->data, data, len);
+			entry->len = len;
+			return true;
+		}
+
+		cf->batch_count--;
+		memmove(entry, entry + 1, (cf->batch_count - i) * sizeof(*entry));
+		return false;
+	}
+
+	return false;
+}
+
+static int settings_nvs_write(struct settings_nvs *cf, uint16_t id, const void *data,
+			      size_t len)
+{
+	size_t al_len = ROUND_UP(len, sizeof(uint32_t));
+	int rc;
+
+	if (!cf->batch_active) {
+		rc = nvs_write(&cf->cf_nvs, id, data, len);
+		return (rc < 0) ? rc : 0;
+	}
+
+	if (settings_nvs_batch_replace(cf, id, data, len)) {
+		return 0;
+	}
+
+	if ((cf->batch_count == ARRAY_SIZE(cf->batch)) ||
+	    (cf->batch_used + al_len > sizeof(cf->batch_buf))) {
+		rc = settings_nvs_batch_flush(cf);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	if (al_len > sizeof(cf->batch_buf)) {
+		rc = nvs_write(&cf->cf_nvs, id, data, len);
+		return (rc < 0) ? rc : 0;
+	}
+
+	cf->batch[cf->batch_count].id = id;
+	cf->batch[cf->batch_count].len = len;
+	cf->batch[cf->batch_count].data = NULL;
+	if (len) {
+		memcpy(&cf->batch_buf[cf->batch_used], data, len);
+		cf->batch[cf->batch_count].data = &cf->batch_buf[cf->batch_used];
+		cf->batch_used += al_len;
+	}
+	cf->batch_count++;
+
+	return 0;
+}
+
+static ssize_t settings_nvs_read(struct settings_nvs *cf, uint16_t id, void *data, size_t len)
+{
+	for (size_t i = cf->batch_count; i > 0; i--) {
+		const struct nvs_batch_entry *entry = &cf->batch[i - 1];
+
+		if (entry->id != id) {
+			continue;
+		}
+
+		if (entry->len == 0) {
+			return -ENOENT;
+		}
+
+		memcpy(data, entry->data, MIN(len, entry->len));
+		return entry->len;
+	}
+
+	return nvs_read(&cf->cf_nvs, id, data, len);
+}
+
+static int settings_nvs_save_start(struct settings_store *cs)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+
+	cf->batch_count = 0;
+	cf->batch_used = 0;
+	cf->batch_active = true;
+
+	return 0;
+}
+
+static int settings_nvs_save_end(struct settings_store *cs)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+	int rc;
+
+	rc = settings_nvs_batch_flush(cf);
+	cf->batch_active = false;
+	if (rc < 0) {
+		LOG_ERR("Failed to commit settings batch (%d)", rc);
+	}
+
+	return rc;
+}
+#else
+static inline int settings_nvs_write(struct settings_nvs *cf, uint16_t id, const void *data,
+				     size_t len)
+{
+	int rc = nvs_write(&cf->cf_nvs, id, data, len);
+
+	return (rc < 0) ? rc : 0;
+}
+
+static inline ssize_t settings_nvs_read(struct settings_nvs *cf, uint16_t id, void *data,
+					size_t len)
+{
+	return nvs_read(&cf->cf_nvs, id, data, len);
+}
+#endif /* CONFIG_SETTINGS_NVS_BATCH */
+
 static ssize_t settings_nvs_read_fn(void *back_end, void *data, size_t len)
 {
 	struct settings_nvs_read_fn_arg *rd_fn_arg;
@@ -76,11 +248,22 @@ int settings_nvs_dst(struct settings_nvs *cf)
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 #define SETTINGS_NVS_CACHE_OVFL(cf) ((cf)->cache_total > ARRAY_SIZE((cf)->cache))
 
+#if CONFIG_SETTINGS_NVS_NAME_CACHE_LOAD
+/* hash of the first name segment, shared by all names of a subtree */
+static uint16_t settings_nvs_top_hash(const char *name)
+{
+	return crc16_ccitt(0xffff, name, settings_name_next(name, NULL));
+}
+#endif
+
 static void settings_nvs_cache_add(struct settings_nvs *cf, const char *name,
 				   uint16_t name_id)
 {
 	uint16_t name_hash = crc16_ccitt(0xffff, name, strlen(name));
 
+#if CONFIG_SETTINGS_NVS_NAME_CACHE_LOAD
+	cf->cache[cf->cache_next].top_hash = settings_nvs_top_hash(name);
+#endif
 	cf->cache[cf->cache_next].name_hash = name_hash;
 	cf->cache[cf->cache_next++].name_id = name_id;
 
@@ -102,7 +285,7 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 			continue;
 		}
 
-		rc = nvs_read(&cf->cf_nvs, cf->cache[i].name_id, rdname, len);
+		rc = settings_nvs_read(cf, cf->cache[i].name_id, rdname, len);
 		if (rc < 0) {
 			continue;
 		}
@@ -118,6 +301,57 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 
 	return NVS_NAMECNT_ID;
 }
+
+#if CONFIG_SETTINGS_NVS_NAME_CACHE_LOAD
+/* Load a subtree using the name cache, which holds all stored names: only the
+ * entries in the same top level subtree are read from NVS. Entries left in the
+ * cache by deleted names are detected by the hash of the name read back.
+ */
+static int settings_nvs_load_cached(struct settings_nvs *cf,
+				    const struct settings_load_arg *arg)
+{
+	struct settings_nvs_read_fn_arg read_fn_arg;
+	char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
+	uint16_t top_hash = settings_nvs_top_hash(arg->subtree);
+	uint16_t name_id;
+	char buf;
+	ssize_t rc1, rc2;
+	int ret;
+
+	for (int i = 0; i < CONFIG_SETTINGS_NVS_NAME_CACHE_SIZE; i++) {
+		if (cf->cache[i].top_hash != top_hash) {
+			continue;
+		}
+
+		name_id = cf->cache[i].name_id;
+		if ((name_id <= NVS_NAMECNT_ID) || (name_id > cf->last_name_id)) {
+			continue;
+		}
+
+		rc1 = nvs_read(&cf->cf_nvs, name_id, &name, sizeof(name) - 1);
+		rc2 = nvs_read(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET, &buf, sizeof(buf));
+		if ((rc1 <= 0) || (rc2 <= 0) || ((size_t)rc1 >= sizeof(name))) {
+			continue;
+		}
+
+		name[rc1] = '\0';
+		if (crc16_ccitt(0xffff, name, rc1) != cf->cache[i].name_hash) {
+			continue;
+		}
+
+		read_fn_arg.fs = &cf->cf_nvs;
+		read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
+
+		ret = settings_call_set_handler(name, rc2, settings_nvs_read_fn, &read_fn_arg,
+						arg);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SETTINGS_NVS_NAME_CACHE_LOAD */
 #endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
 static int settings_nvs_load(struct settings_store *cs,
@@ -134,6 +368,16 @@ static int settings_nvs_load(struct settings_store *cs,
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 	uint16_t cached = 0;
 
+#if CONFIG_SETTINGS_NVS_NAME_CACHE_LOAD
+	if (arg && arg->subtree && cf->loaded && !SETTINGS_NVS_CACHE_OVFL(cf)) {
+		return settings_nvs_load_cached(cf, arg);
+	}
+
+	/* the cache is filled again, without stale or duplicate entries */
+	memset(cf->cache, 0, sizeof(cf->cache));
+	cf->cache_next = 0;
+#endif
+
 	cf->loaded = false;
 #endif
 
@@ -257,7 +501,7 @@ static int settings_nvs_save(struct settings_store *cs, const char *name,
 			break;
 		}
 
-		rc = nvs_read(&cf->cf_nvs, name_id, &rdname, sizeof(rdname));
+		rc = settings_nvs_read(cf, name_id, &rdname, sizeof(rdname));
 
 		if (rc < 0) {
 			/* Error or entry not found */
@@ -287,10 +531,10 @@ found:
 			return 0;
 		}
 
-		rc = nvs_delete(&cf->cf_nvs, name_id);
+		rc = settings_nvs_write(cf, name_id, NULL, 0);
 		if (rc >= 0) {
-			rc = nvs_delete(&cf->cf_nvs, name_id +
-					NVS_NAME_ID_OFFSET);
+			rc = settings_nvs_write(cf, name_id + NVS_NAME_ID_OFFSET,
+						NULL, 0);
 		}
 
 		if (rc < 0) {
@@ -299,8 +543,8 @@ found:
 
 		if (name_id == cf->last_name_id) {
 			cf->last_name_id--;
-			rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
-				       &cf->last_name_id, sizeof(uint16_t));
+			rc = settings_nvs_write(cf, NVS_NAMECNT_ID, &cf->last_name_id,
+						sizeof(uint16_t));
 			if (rc < 0) {
 				/* Error: can't to store
 				 * the largest name ID in use.
@@ -320,23 +564,22 @@ found:
 	/* update the last_name_id and write to flash if required*/
 	if (write_name_id > cf->last_name_id) {
 		cf->last_name_id = write_name_id;
-		rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID, &cf->last_name_id,
-			       sizeof(uint16_t));
+		rc = settings_nvs_write(cf, NVS_NAMECNT_ID, &cf->last_name_id,
+					sizeof(uint16_t));
 		if (rc < 0) {
 			return rc;
 		}
 	}
 
 	/* write the value */
-	rc = nvs_write(&cf->cf_nvs, write_name_id + NVS_NAME_ID_OFFSET,
-		       value, val_len);
+	rc = settings_nvs_write(cf, write_name_id + NVS_NAME_ID_OFFSET, value, val_len);
 	if (rc < 0) {
 		return rc;
 	}
 
 	/* write the name if required */
 	if (write_name) {
-		rc = nvs_write(&cf->cf_nvs, write_name_id, name, strlen(name));
+		rc = settings_nvs_write(cf, write_name_id, name, strlen(name));
 		if (rc < 0) {
 			return rc;
 		}
@@ -164,7 +164,11 @@ int settings_save_subtree(const char *subtree)
 #endif /* CONFIG_SETTINGS_DYNAMIC_HANDLERS */
 
 	if (cs->cs_itf->csi_save_end) {
-		cs->cs_itf->csi_save_end(cs);
+		/* Stores batching the writes commit them here */
+		rc2 = cs->cs_itf->csi_save_end(cs);
+		if (!rc) {
+			rc = rc2;
+		}
 	}
 	return rc;
 }
@@ -31,11 +31,182 @@ static int settings_zms_save(struct settings_store *cs, const char *name, const
 			     size_t val_len);
 static void *settings_zms_storage_get(struct settings_store *cs);
 static int settings_zms_get_last_hash_ids(struct settings_zms *cf);
+#if CONFIG_SETTINGS_ZMS_BATCH
+static int settings_zms_save_start(struct settings_store *cs);
+static int settings_zms_save_end(struct settings_store *cs);
+#endif
 
 static struct settings_store_itf settings_zms_itf = {.csi_load = settings_zms_load,
+#if CONFIG_SETTINGS_ZMS_BATCH
+						     .csi_save_start = settings_zms_save_start,
+						     .csi_save_end = settings_zms_save_end,
+#endif
 						     .csi_save = settings_zms_save,
 						     .csi_storage_get = settings_zms_storage_get};
 
+#if CONFIG_SETTINGS_ZMS_BATCH
+/* Between settings_zms_save_start() and settings_zms_save_end() the entries written by
+ * settings_zms_save() are staged and committed to ZMS as atomic batches, reads of staged
+ * entries are served from the staging buffer.
+ */
+static int settings_zms_batch_flush(struct settings_zms *cf)
+{
+	ssize_t rc;
+
+	if (cf->batch_count == 0) {
+		return 0;
+	}
+
+	rc = zms_write_batch(&cf->cf_zms, cf->batch, cf->batch_count);
+	if (rc == -EINVAL) {
+		/* The batch does not fit in a sector, write entries one by one.
+		 * A power loss may then leave only some of them updated.
+		 */
+		LOG_WRN("Settings batch of %zu entries too large, not written atomically",
+			cf->batch_count);
+		for (size_t i = 0; (i < cf->batch_count) && (rc >= 0); i++) {
+			rc = zms_write(&cf->cf_zms, cf->batch[i].id, cf->batch[i].data,
+				       cf->batch[i].len);
+		}
+	}
+
+	cf->batch_count = 0;
+	cf->batch_used = 0;
+
+	return (rc < 0) ? rc : 0;
+}
+
+/* Replace the staged entry of an id in place if the new value fits in its
+ * room, otherwise drop it so that the new value is staged or written instead.
+ * An id is staged at most once, so the batch commits its last value.
+ *
+ * @return true if the entry was replaced.
+ */
+static bool settings_zms_batch_replace(struct settings_zms *cf, uint32_t id, const void *data,
+				       size_t len)
+{
+	for (size_t i = 0; i < cf->batch_count; i++) {
+		struct zms_batch_entry *entry = &cf->batch[i];
+
+		if (entry->id != id) {
+			continue;
+		}
+
+		if ((entry->len != 0) &&
+		    (ROUND_UP(len, sizeof(uint32_t)) <= ROUND_UP(entry->len, sizeof(uint32_t)))) {
+			memcpy((void *)entry->data, data, len);
+			entry->len = len;
+			return true;
+		}
+
+		cf->batch_count--;
+		memmove(entry, entry + 1, (cf->batch_count - i) * sizeof(*entry));
+		return false;
+	}
+
+	return false;
+}
+
+static int settings_zms_write(struct settings_zms *cf, uint32_t id, const void *data, size_t len)
+{
+	size_t al_len = ROUND_UP(len, sizeof(uint32_t));
+	ssize_t rc;
+
+	if (!cf->batch_active) {
+		rc = zms_write(&cf->cf_zms, id, data, len);
+		return (rc < 0) ? rc : 0;
+	}
+
+	if (settings_zms_batch_replace(cf, id, data, len)) {
+		return 0;
+	}
+
+	if ((cf->batch_count == ARRAY_SIZE(cf->batch)) ||
+	    (cf->batch_used + al_len > sizeof(cf->batch_buf))) {
+		rc = settings_zms_batch_flush(cf);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	if (al_len > sizeof(cf->batch_buf)) {
+		rc = zms_write(&cf->cf_zms, id, data, len);
+		return (rc < 0) ? rc : 0;
+	}
+
+	cf->batch[cf->batch_count].id = id;
+	cf->batch[cf->batch_count].len = len;
+	cf->batch[cf->batch_count].data = NULL;
+	if (len) {
+		memcpy(&cf->batch_buf[cf->batch_used], data, len);
+		cf->batch[cf->batch_count].data = &cf->batch_buf[cf->batch_used];
+		cf->batch_used += al_len;
+	}
+	cf->batch_count++;
+
+	return 0;
+}
+
+static ssize_t settings_zms_read(struct settings_zms *cf, uint32_t id, void *data, size_t len)
+{
+	for (size_t i = cf->batch_count; i > 0; i--) {
+		const struct zms_batch_entry *entry = &cf->batch[i - 1];
+
+		if (entry->id != id) {
+			continue;
+		}
+
+		if (entry->len == 0) {
+			return -ENOENT;
+		}
+
+		memcpy(data, entry->data, MIN(len, entry->len));
+		return entry->len;
+	}
+
+	return zms_read(&cf->cf_zms, id, data, len);
+}
+
+static int settings_zms_save_start(struct settings_store *cs)
+{
+	struct settings_zms *cf = CONTAINER_OF(cs, struct settings_zms, cf_store);
+
+	cf->batch_count = 0;
+	cf->batch_used = 0;
+	cf->batch_active = true;
+
+	return 0;
+}
+
+static int settings_zms_save_end(struct settings_store *cs)
+{
+	struct settings_zms *cf = CONTAINER_OF(cs, struct settings_zms, cf_store);
+	int rc;
+
+	rc = settings_zms_batch_flush(cf);
+	cf->batch_active = false;
+	if (rc < 0) {
+		LOG_ERR("Failed to commit settings batch (%d)", rc);
+	}
+
+	return rc;
+}
+#else
+static inline int settings_zms_write(struct settings_zms *cf, uint32_t id, const void *data,
+				     size_t len)
+{
+	ssize_t rc = zms_write(&cf->cf_zms, id, data, len);
+
+	return (rc < 0) ? rc : 0;
+}
+
+static inline ssize_t settings_zms_read(struct settings_zms *cf, uint32_t id, void *data,
+					size_t len)
+{
+	return zms_read(&cf->cf_zms, id, data, len);
+}
+#endif /* CONFIG_SETTINGS_ZMS_BATCH */
+
 static ssize_t settings_zms_read_fn(void *back_end, void *data, size_t len)
 {
 	struct settings_zms_read_fn_arg *rd_fn_arg;
@@ -68,20 +239,20 @@ static int settings_zms_unlink_ll_node(struct settings_zms *cf, uint32_t name_ha
 	struct settings_hash_linked_list settings_update_element;
 
 	/* let's update the linked list */
-	rc = zms_read(&cf->cf_zms, name_hash | 1, &settings_element,
+	rc = settings_zms_read(cf, name_hash | 1, &settings_element,
 		      sizeof(struct settings_hash_linked_list));
 	if (rc < 0) {
 		return rc;
 	}
 	/* update the next element */
 	if (settings_element.next_hash) {
-		rc = zms_read(&cf->cf_zms, settings_element.next_hash, &settings_update_element,
+		rc = settings_zms_read(cf, settings_element.next_hash, &settings_update_element,
 			      sizeof(struct settings_hash_linked_list));
 		if (rc < 0) {
 			return rc;
 		}
 		settings_update_element.previous_hash = settings_element.previous_hash;
-		rc = zms_write(&cf->cf_zms, settings_element.next_hash, &settings_update_element,
+		rc = settings_zms_write(cf, settings_element.next_hash, &settings_update_element,
 			       sizeof(struct settings_hash_linked_list));
 		if (rc < 0) {
 			return rc;
@@ -98,7 +269,7 @@ static int settings_zms_unlink_ll_node(struct settings_zms *cf, uint32_t name_ha
 	}
 	/* update the previous element */
 	if (settings_element.previous_hash) {
-		rc = zms_read(&cf->cf_zms, settings_element.previous_hash, &settings_update_element,
+		rc = settings_zms_read(cf, settings_element.previous_hash, &settings_update_element,
 			      sizeof(struct settings_hash_linked_list));
 		if (rc < 0) {
 			return rc;
@@ -110,7 +281,7 @@ static int settings_zms_unlink_ll_node(struct settings_zms *cf, uint32_t name_ha
 			cf->second_to_last_hash_id = settings_update_element.previous_hash;
 		}
 		settings_update_element.next_hash = settings_element.next_hash;
-		rc = zms_write(&cf->cf_zms, settings_element.previous_hash,
+		rc = settings_zms_write(cf, settings_element.previous_hash,
 			       &settings_update_element, sizeof(struct settings_hash_linked_list));
 		if (rc < 0) {
 			return rc;
@@ -124,9 +295,9 @@ static int settings_zms_delete(struct settings_zms *cf, uint32_t name_hash)
 {
 	int rc = 0;
 
-	rc = zms_delete(&cf->cf_zms, name_hash);
+	rc = settings_zms_write(cf, name_hash, NULL, 0);
 	if (rc >= 0) {
-		rc = zms_delete(&cf->cf_zms, name_hash + ZMS_DATA_ID_OFFSET);
+		rc = settings_zms_write(cf, name_hash + ZMS_DATA_ID_OFFSET, NULL, 0);
 	}
 	if (rc < 0) {
 		return rc;
@@ -138,7 +309,7 @@ static int settings_zms_delete(struct settings_zms *cf, uint32_t name_hash)
 	}
 
 	/* Now delete the current linked list element */
-	rc = zms_delete(&cf->cf_zms, name_hash | 1);
+	rc = settings_zms_write(cf, name_hash | 1, NULL, 0);
 	if (rc < 0) {
 		return rc;
 	}
@@ -157,7 +328,7 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 	ssize_t rc2;
 	uint32_t ll_hash_id;
 
-	ret = zms_read(&cf->cf_zms, ZMS_LL_HEAD_HASH_ID, &settings_element,
+	ret = settings_zms_read(cf, ZMS_LL_HEAD_HASH_ID, &settings_element,
 		       sizeof(struct settings_hash_linked_list));
 	if (ret < 0) {
 		return ret;
@@ -170,7 +341,7 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 		 * entries one for the setting's name and one with the
 		 * setting's value.
 		 */
-		rc1 = zms_read(&cf->cf_zms, ZMS_NAME_ID_FROM_LL_NODE(ll_hash_id), &name,
+		rc1 = settings_zms_read(cf, ZMS_NAME_ID_FROM_LL_NODE(ll_hash_id), &name,
 			       sizeof(name) - 1);
 		/* get the length of data and verify that it exists */
 		rc2 = zms_get_data_length(&cf->cf_zms, ZMS_NAME_ID_FROM_LL_NODE(ll_hash_id) +
@@ -201,7 +372,7 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 		}
 
 		/* update next ll_hash_id */
-		ret = zms_read(&cf->cf_zms, ll_hash_id, &settings_element,
+		ret = settings_zms_read(cf, ll_hash_id, &settings_element,
 			       sizeof(struct settings_hash_linked_list));
 		if (ret < 0) {
 			return ret;
@@ -242,7 +413,7 @@ static int settings_zms_save(struct settings_store *cs, const char *name, const
 	hash_collision = true;
 
 	for (int i = 0; i <= cf->hash_collision_num; i++) {
-		rc = zms_read(&cf->cf_zms, name_hash + i * LSB_GET(ZMS_COLLISIONS_MASK), &rdname,
+		rc = settings_zms_read(cf, name_hash + i * LSB_GET(ZMS_COLLISIONS_MASK), &rdname,
 			      sizeof(rdname));
 		if (rc == -ENOENT) {
 			if (first_available_hash_index < 0) {
@@ -302,14 +473,14 @@ no_hash_collision:
 	}
 
 	/* write the value */
-	rc = zms_write(&cf->cf_zms, name_hash + ZMS_DATA_ID_OFFSET, value, val_len);
+	rc = settings_zms_write(cf, name_hash + ZMS_DATA_ID_OFFSET, value, val_len);
 	if (rc < 0) {
 		return rc;
 	}
 
 	/* write the name if required */
 	if (write_name) {
-		rc = zms_write(&cf->cf_zms, name_hash, name, strlen(name));
+		rc = settings_zms_write(cf, name_hash, name, strlen(name));
 		if (rc < 0) {
 			return rc;
 		}
@@ -326,7 +497,7 @@ no_hash_collision:
 			}
 		}
 		settings_element.previous_hash = cf->last_hash_id;
-		rc = zms_write(&cf->cf_zms, name_hash | 1, &settings_element,
+		rc = settings_zms_write(cf, name_hash | 1, &settings_element,
 			       sizeof(struct settings_hash_linked_list));
 		if (rc < 0) {
 			return rc;
@@ -334,7 +505,7 @@ no_hash_collision:
 		/* Now update the previous linked list element */
 		settings_element.next_hash = name_hash | 1;
 		settings_element.previous_hash = cf->second_to_last_hash_id;
-		rc = zms_write(&cf->cf_zms, cf->last_hash_id, &settings_element,
+		rc = settings_zms_write(cf, cf->last_hash_id, &settings_element,
 			       sizeof(struct settings_hash_linked_list));
 		if (rc < 0) {
 			return rc;
@@ -354,13 +525,13 @@ static int settings_zms_get_last_hash_ids(struct settings_zms *cf)
 
 	cf->hash_collision_num = 0;
 	do {
-		rc = zms_read(&cf->cf_zms, ll_last_hash_id, &settings_element,
+		rc = settings_zms_read(cf, ll_last_hash_id, &settings_element,
 			      sizeof(settings_element));
 		if (rc == -ENOENT) {
 			/* header doesn't exist or linked list broken, reinitialize the header */
 			const struct settings_hash_linked_list settings_element = {
 				.previous_hash = 0, .next_hash = 0};
-			rc = zms_write(&cf->cf_zms, ZMS_LL_HEAD_HASH_ID, &settings_element,
+			rc = settings_zms_write(cf, ZMS_LL_HEAD_HASH_ID, &settings_element,
 				       sizeof(struct settings_hash_linked_list));
 			if (rc < 0) {
 				return rc;
@@ -30,6 +30,25 @@ static int cmd_kernel_heap(const struct shell *sh, size_t argc, char **argv)
 	shell_print(sh, "allocated:      %zu", stats.allocated_bytes);
 	shell_print(sh, "max. allocated: %zu", stats.max_allocated_bytes);
 
+#if defined(CONFIG_K_HEAP_CPU_CACHE) && defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
+	struct k_heap_cache_stats cache_stats;
+
+	/* The sys_heap is the first member of the system k_heap */
+	err = k_heap_cache_stats_get(CONTAINER_OF(&_system_heap, struct k_heap, heap),
+				     &cache_stats);
+	if (err) {
+		shell_error(sh, "Failed to read kernel heap cache statistics (err %d)", err);
+		return -ENOEXEC;
+	}
+
+	shell_print(sh, "cache hits:     %u", cache_stats.hits);
+	shell_print(sh, "cache misses:   %u", cache_stats.misses);
+	shell_print(sh, "cached frees:   %u", cache_stats.frees);
+	shell_print(sh, "cache spills:   %u", cache_stats.spills);
+	shell_print(sh, "cache drains:   %u", cache_stats.drains);
+	shell_print(sh, "cached blocks:  %u", cache_stats.cached_blocks);
+#endif /* CONFIG_K_HEAP_CPU_CACHE && CONFIG_SYS_HEAP_RUNTIME_STATS */
+
 	return 0;
 }
 
@@ -12,6 +12,8 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME, CONFIG_STREAM_FLASH_LOG_LEVEL);
 
 #include <zephyr/types.h>
 #include <string.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/flash.h>
 
 #include <zephyr/storage/stream_flash.h>
@@ -184,7 +186,11 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 
 #endif /* CONFIG_STREAM_FLASH_ERASE */
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+/* Program len bytes of buf at the current write position, erasing the page
+ * it needs first. The buffer is padded to the write block size and, with a
+ * callback, overwritten with the data read back.
+ */
+static int stream_flash_program(struct stream_flash_ctx *ctx, uint8_t *buf, size_t len)
 {
 	int rc = 0;
 	size_t write_addr = ctx->offset + ctx->bytes_written;
@@ -192,33 +198,28 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	size_t fill_length;
 	uint8_t filler;
 
-
-	if (ctx->buf_bytes == 0) {
-		return 0;
-	}
-
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
 
-		rc = stream_flash_erase_to_append(ctx, ctx->buf_bytes);
+		rc = stream_flash_erase_to_append(ctx, len);
 		if (rc < 0) {
 			LOG_ERR("stream_flash_forward_erase %d range=0x%08zx",
-				rc, ctx->buf_bytes);
+				rc, len);
 			return rc;
 		}
 	}
 
 	fill_length = ctx->write_block_size;
-	if (ctx->buf_bytes % fill_length) {
-		fill_length -= ctx->buf_bytes % fill_length;
+	if (len % fill_length) {
+		fill_length -= len % fill_length;
 		filler = ctx->erase_value;
 
-		memset(ctx->buf + ctx->buf_bytes, filler, fill_length);
+		memset(buf + len, filler, fill_length);
 	} else {
 		fill_length = 0;
 	}
 
-	buf_bytes_aligned = ctx->buf_bytes + fill_length;
-	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
+	buf_bytes_aligned = len + fill_length;
+	rc = flash_write(ctx->fdev, write_addr, buf, buf_bytes_aligned);
 
 	if (rc != 0) {
 		LOG_ERR("flash_write error %d offset=0x%08zx", rc,
@@ -232,18 +233,17 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		/* Invert to ensure that caller is able to discover a faulty
 		 * flash_read() even if no error code is returned.
 		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
+		for (int i = 0; i < len; i++) {
+			buf[i] = ~buf[i];
 		}
 
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_read(ctx->fdev, write_addr, buf, len);
 		if (rc != 0) {
 			LOG_ERR("flash read failed: %d", rc);
 			return rc;
 		}
 
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
+		rc = ctx->callback(buf, len, write_addr);
 		if (rc != 0) {
 			LOG_ERR("callback failed: %d", rc);
 			return rc;
@@ -252,6 +252,184 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 
 #endif
 
+	return rc;
+}
+
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+
+static K_THREAD_STACK_DEFINE(stream_flash_workq_stack, CONFIG_STREAM_FLASH_ASYNC_STACK_SIZE);
+static struct k_work_q stream_flash_workq;
+
+static void stream_flash_prog_work(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx = CONTAINER_OF(work, struct stream_flash_ctx, prog_work);
+	size_t ahead;
+	int rc;
+
+	rc = stream_flash_program(ctx, ctx->prog_buf, ctx->prog_bytes);
+
+	/* Erase what the next buffer needs while it is being filled */
+	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE) && (rc == 0)) {
+		ahead = MIN(ctx->prog_bytes + ctx->buf_len, ctx->available - ctx->bytes_written);
+		(void)stream_flash_erase_to_append(ctx, ahead);
+	}
+
+	ctx->prog_rc = rc;
+	k_sem_give(&ctx->prog_done);
+}
+
+/* Wait for the buffer programmed in the background and account for it. On
+ * return, the caller owns the programming buffer until it gives prog_done.
+ *
+ * A failed programming leaves a hole in the flash, the error is kept and
+ * returned until the context is initialized again.
+ */
+static int stream_flash_prog_take(struct stream_flash_ctx *ctx)
+{
+	(void)k_sem_take(&ctx->prog_done, K_FOREVER);
+
+	if (ctx->prog_rc == 0) {
+		ctx->bytes_written += ctx->prog_bytes;
+	} else if (ctx->prog_err == 0) {
+		ctx->prog_err = ctx->prog_rc;
+	}
+
+	ctx->prog_bytes = 0;
+	ctx->prog_rc = 0;
+
+	return ctx->prog_err;
+}
+
+static int stream_flash_prog_wait(struct stream_flash_ctx *ctx)
+{
+	int rc = stream_flash_prog_take(ctx);
+
+	k_sem_give(&ctx->prog_done);
+
+	return rc;
+}
+
+/* Hand the write buffer over to the work queue and continue with the other */
+static int stream_flash_prog_submit(struct stream_flash_ctx *ctx)
+{
+	uint8_t *buf;
+	int rc;
+
+	rc = stream_flash_prog_take(ctx);
+	if (rc != 0) {
+		k_sem_give(&ctx->prog_done);
+		return rc;
+	}
+
+	buf = ctx->prog_buf;
+	ctx->prog_buf = ctx->buf;
+	ctx->prog_bytes = ctx->buf_bytes;
+	ctx->buf = buf;
+	ctx->buf_bytes = 0U;
+
+	(void)k_work_submit_to_queue(&stream_flash_workq, &ctx->prog_work);
+
+	return 0;
+}
+
+int stream_flash_async_enable(struct stream_flash_ctx *ctx, uint8_t *buf)
+{
+	if (!ctx || !buf) {
+		return -EFAULT;
+	}
+
+	if ((ctx->bytes_written != 0) || (ctx->buf_bytes != 0)) {
+		return -EBUSY;
+	}
+
+	ctx->prog_buf = buf;
+	ctx->prog_bytes = 0;
+	ctx->prog_rc = 0;
+	ctx->prog_err = 0;
+	k_work_init(&ctx->prog_work, stream_flash_prog_work);
+	k_sem_init(&ctx->prog_done, 1, 1);
+
+	return 0;
+}
+
+int stream_flash_async_wait(struct stream_flash_ctx *ctx)
+{
+	if (!ctx || !ctx->prog_buf) {
+		return -EFAULT;
+	}
+
+	return stream_flash_prog_wait(ctx);
+}
+
+static int stream_flash_workq_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "stream_flash",
+	};
+
+	k_work_queue_start(&stream_flash_workq, stream_flash_workq_stack,
+			   K_THREAD_STACK_SIZEOF(stream_flash_workq_stack),
+			   CONFIG_STREAM_FLASH_ASYNC_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(stream_flash_workq_init, POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY);
+
+static inline bool stream_flash_is_async(const struct stream_flash_ctx *ctx)
+{
+	return ctx->prog_buf != NULL;
+}
+
+/* Error of a previous background programming, only updated by the writer */
+static inline int stream_flash_prog_error(const struct stream_flash_ctx *ctx)
+{
+	return stream_flash_is_async(ctx) ? ctx->prog_err : 0;
+}
+
+#else
+static inline bool stream_flash_is_async(const struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+	return false;
+}
+
+static inline int stream_flash_prog_error(const struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+	return 0;
+}
+
+static inline int stream_flash_prog_submit(struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+	return -ENOTSUP;
+}
+
+static inline int stream_flash_prog_wait(struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+	return 0;
+}
+#endif /* CONFIG_STREAM_FLASH_ASYNC */
+
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	if (ctx->buf_bytes == 0) {
+		return 0;
+	}
+
+	if (stream_flash_is_async(ctx)) {
+		return stream_flash_prog_submit(ctx);
+	}
+
+	rc = stream_flash_program(ctx, ctx->buf, ctx->buf_bytes);
+	if (rc != 0) {
+		return rc;
+	}
+
 	ctx->bytes_written += ctx->buf_bytes;
 	ctx->buf_bytes = 0U;
 
@@ -269,7 +447,12 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		return -EFAULT;
 	}
 
-	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
+	rc = stream_flash_prog_error(ctx);
+	if (rc != 0) {
+		return rc;
+	}
+
+	if (ctx->bytes_written + stream_flash_bytes_buffered(ctx) + len > ctx->available) {
 		return -ENOMEM;
 	}
 
@@ -299,6 +482,10 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		rc = flash_sync(ctx);
 	}
 
+	if (flush && (rc == 0) && stream_flash_is_async(ctx)) {
+		rc = stream_flash_prog_wait(ctx);
+	}
+
 	return rc;
 }
 
@@ -307,6 +494,15 @@ size_t stream_flash_bytes_written(const struct stream_flash_ctx *ctx)
 	return ctx->bytes_written;
 }
 
+size_t stream_flash_bytes_buffered(const struct stream_flash_ctx *ctx)
+{
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	return ctx->buf_bytes + ctx->prog_bytes;
+#else
+	return ctx->buf_bytes;
+#endif
+}
+
 #ifdef CONFIG_STREAM_FLASH_INSPECT
 struct _inspect_flash {
 	size_t buf_len;
@@ -405,6 +601,11 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	ctx->erased_up_to = 0;
+#endif
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+	ctx->prog_buf = NULL;
+	ctx->prog_bytes = 0;
+	ctx->prog_err = 0;
 #endif
 	ctx->erase_value = params->erase_value;
 
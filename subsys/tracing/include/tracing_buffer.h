@@ -104,6 +104,30 @@ int tracing_buffer_get_finish(uint32_t size);
  */
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size);
 
+#if defined(CONFIG_TRACING_BUFFER_PER_CPU)
+/**
+ * @brief Get the oldest record in the tracing buffer of a CPU.
+ *
+ * @param cpu CPU index.
+ * @param timestamp Set to the cycle count when the record was written.
+ * @param length Set to the record payload length (in bytes).
+ *
+ * @return true if the CPU has a record pending, false if not.
+ */
+bool tracing_buffer_cpu_peek(unsigned int cpu, uint32_t *timestamp, uint32_t *length);
+
+/**
+ * @brief Read the oldest record from the tracing buffer of a CPU.
+ *
+ * @param cpu CPU index.
+ * @param data Address of the output buffer.
+ * @param size Output buffer size (in bytes).
+ *
+ * @retval Number of payload bytes written to the output buffer.
+ */
+uint32_t tracing_buffer_cpu_get(unsigned int cpu, uint8_t *data, uint32_t size);
+#endif
+
 /**
  * @brief Get buffer from tracing command buffer.
  *
@@ -14,9 +14,16 @@
 extern "C" {
 #endif
 
+#if defined(CONFIG_TRACING_BUFFER_PER_CPU)
+/* Each CPU writes to its own buffer, masking local interrupts is enough */
+#define TRACING_LOCK()		{ unsigned int key; key = arch_irq_lock()
+
+#define TRACING_UNLOCK()	{ arch_irq_unlock(key); } }
+#else
 #define TRACING_LOCK()		{ int key; key = irq_lock()
 
 #define TRACING_UNLOCK()	{ irq_unlock(key); } }
+#endif
 
 /**
  * @brief Check tracing enabled or not.
@@ -38,6 +45,15 @@ void tracing_buffer_handle(uint8_t *data, uint32_t length);
  */
 void tracing_packet_drop_handle(void);
 
+/**
+ * @brief Get the number of tracing packets dropped on a CPU.
+ *
+ * @param cpu CPU index.
+ *
+ * @return Number of packets dropped because the tracing buffer was full.
+ */
+uint32_t tracing_packet_drop_get(unsigned int cpu);
+
 /**
  * @brief Handle tracing command.
  *
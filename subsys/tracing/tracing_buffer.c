@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/sys/ring_buffer.h>
+#include <tracing_buffer.h>
 
-static struct ring_buf tracing_ring_buf;
-static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
@@ -17,6 +19,198 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 	return sizeof(tracing_cmd_buffer);
 }
 
+#if defined(CONFIG_TRACING_BUFFER_PER_CPU)
+
+/* Every put is framed as one record so the tracing thread can merge the
+ * buffers of all CPUs by timestamp.
+ */
+struct tracing_record_hdr {
+	uint32_t timestamp;
+	uint32_t length;
+};
+
+struct tracing_cpu_buffer {
+	struct ring_buf rb;
+	/* Header space of the record being written, split if it wraps */
+	uint8_t *hdr[2];
+	uint8_t hdr_len[2];
+	uint32_t timestamp;
+	bool open;
+	uint8_t buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+};
+
+static struct tracing_cpu_buffer tracing_cpu_buffers[CONFIG_MP_MAX_NUM_CPUS];
+
+/* Producers run with local interrupts masked (see TRACING_LOCK()), so
+ * the buffer of the current CPU has a single writer at a time.
+ */
+static inline struct tracing_cpu_buffer *cpu_buffer(void)
+{
+	return &tracing_cpu_buffers[arch_curr_cpu()->id];
+}
+
+static bool record_open(struct tracing_cpu_buffer *cb)
+{
+	uint32_t len = 0U;
+
+	for (int i = 0; i < ARRAY_SIZE(cb->hdr); i++) {
+		cb->hdr_len[i] = ring_buf_put_claim(&cb->rb, &cb->hdr[i],
+						    sizeof(struct tracing_record_hdr) - len);
+		len += cb->hdr_len[i];
+	}
+
+	if (len < sizeof(struct tracing_record_hdr)) {
+		ring_buf_put_finish(&cb->rb, 0);
+		return false;
+	}
+
+	cb->timestamp = k_cycle_get_32();
+	cb->open = true;
+
+	return true;
+}
+
+uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
+{
+	struct tracing_cpu_buffer *cb = cpu_buffer();
+
+	if (!cb->open && !record_open(cb)) {
+		return 0;
+	}
+
+	return ring_buf_put_claim(&cb->rb, data, size);
+}
+
+int tracing_buffer_put_finish(uint32_t size)
+{
+	struct tracing_cpu_buffer *cb = cpu_buffer();
+	struct tracing_record_hdr hdr = {
+		.timestamp = cb->timestamp,
+		.length = size,
+	};
+
+	if (!cb->open) {
+		return ring_buf_put_finish(&cb->rb, size);
+	}
+
+	cb->open = false;
+
+	if (size == 0U) {
+		return ring_buf_put_finish(&cb->rb, 0);
+	}
+
+	memcpy(cb->hdr[0], &hdr, cb->hdr_len[0]);
+	memcpy(cb->hdr[1], (uint8_t *)&hdr + cb->hdr_len[0], cb->hdr_len[1]);
+
+	/* Publish the record only once the header and payload are visible
+	 * to the tracing thread running on another CPU.
+	 */
+	barrier_dmem_fence_full();
+
+	return ring_buf_put_finish(&cb->rb, size + sizeof(hdr));
+}
+
+uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
+{
+	uint32_t claimed, total = 0U;
+	uint8_t *dst;
+
+	do {
+		claimed = tracing_buffer_put_claim(&dst, size - total);
+		memcpy(dst, data + total, claimed);
+		total += claimed;
+	} while (claimed != 0U && total < size);
+
+	if (total < size) {
+		tracing_buffer_put_finish(0);
+		return 0;
+	}
+
+	tracing_buffer_put_finish(total);
+
+	return total;
+}
+
+bool tracing_buffer_cpu_peek(unsigned int cpu, uint32_t *timestamp, uint32_t *length)
+{
+	struct tracing_cpu_buffer *cb = &tracing_cpu_buffers[cpu];
+	struct tracing_record_hdr hdr;
+
+	/* Records are published whole by the producer index, read it first
+	 * and only then the record it covers.
+	 */
+	if (ring_buf_size_get(&cb->rb) < sizeof(hdr)) {
+		return false;
+	}
+
+	barrier_dmem_fence_full();
+
+	ring_buf_peek(&cb->rb, (uint8_t *)&hdr, sizeof(hdr));
+
+	*timestamp = hdr.timestamp;
+	*length = hdr.length;
+
+	return true;
+}
+
+uint32_t tracing_buffer_cpu_get(unsigned int cpu, uint8_t *data, uint32_t size)
+{
+	struct tracing_cpu_buffer *cb = &tracing_cpu_buffers[cpu];
+	struct tracing_record_hdr hdr;
+
+	if (ring_buf_get(&cb->rb, (uint8_t *)&hdr, sizeof(hdr)) < sizeof(hdr)) {
+		return 0;
+	}
+
+	if (hdr.length > size) {
+		/* Cannot happen with a merge buffer of the buffer capacity */
+		ring_buf_get(&cb->rb, NULL, hdr.length);
+		return 0;
+	}
+
+	return ring_buf_get(&cb->rb, data, hdr.length);
+}
+
+void tracing_buffer_init(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(tracing_cpu_buffers); i++) {
+		struct tracing_cpu_buffer *cb = &tracing_cpu_buffers[i];
+
+		ring_buf_init(&cb->rb, sizeof(cb->buffer), cb->buffer);
+		cb->open = false;
+	}
+}
+
+bool tracing_buffer_is_empty(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(tracing_cpu_buffers); i++) {
+		if (!ring_buf_is_empty(&tracing_cpu_buffers[i].rb)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+uint32_t tracing_buffer_capacity_get(void)
+{
+	return ring_buf_capacity_get(&tracing_cpu_buffers[0].rb) -
+	       sizeof(struct tracing_record_hdr);
+}
+
+uint32_t tracing_buffer_space_get(void)
+{
+	uint32_t space = ring_buf_space_get(&cpu_buffer()->rb);
+
+	return space > sizeof(struct tracing_record_hdr) ?
+	       space - sizeof(struct tracing_record_hdr) : 0;
+}
+
+#else /* CONFIG_TRACING_BUFFER_PER_CPU */
+
+static struct ring_buf tracing_ring_buf;
+static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
 	return ring_buf_put_claim(&tracing_ring_buf, data, size);
@@ -67,3 +261,5 @@ uint32_t tracing_buffer_space_get(void)
 {
 	return ring_buf_space_get(&tracing_ring_buf);
 }
+
+#endif /* CONFIG_TRACING_BUFFER_PER_CPU */
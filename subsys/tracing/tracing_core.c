@@ -41,7 +41,7 @@ enum tracing_state {
 };
 
 static atomic_t tracing_state;
-static atomic_t tracing_packet_drop_num;
+static atomic_t tracing_packet_drop_num[CONFIG_MP_MAX_NUM_CPUS];
 static struct tracing_backend *working_backend;
 
 #ifdef CONFIG_TRACING_ASYNC
@@ -54,6 +54,61 @@ static K_SEM_DEFINE(tracing_thread_sem, 0, 1);
 static K_THREAD_STACK_DEFINE(tracing_thread_stack,
 			CONFIG_TRACING_THREAD_STACK_SIZE);
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+static uint8_t tracing_merge_buf[CONFIG_TRACING_BUFFER_SIZE];
+
+/* Return the CPU holding the oldest pending record, or -1 if none */
+static int tracing_merge_next(uint32_t *length)
+{
+	uint32_t timestamp, oldest = 0U, len;
+	int next = -1;
+
+	for (unsigned int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		if (!tracing_buffer_cpu_peek(cpu, &timestamp, &len)) {
+			continue;
+		}
+
+		if (next < 0 || (int32_t)(timestamp - oldest) < 0) {
+			next = cpu;
+			oldest = timestamp;
+			*length = len;
+		}
+	}
+
+	return next;
+}
+
+/* Merge the records of all CPUs by timestamp into one stream */
+static void tracing_merge_output(void)
+{
+	uint32_t used = 0U, length;
+	int cpu;
+
+	while ((cpu = tracing_merge_next(&length)) >= 0) {
+		if (used + length > sizeof(tracing_merge_buf)) {
+			break;
+		}
+
+		used += tracing_buffer_cpu_get(cpu, &tracing_merge_buf[used],
+					       sizeof(tracing_merge_buf) - used);
+	}
+
+	tracing_buffer_handle(tracing_merge_buf, used);
+}
+
+static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
+{
+	tracing_thread_tid = k_current_get();
+
+	while (true) {
+		if (tracing_buffer_is_empty()) {
+			k_sem_take(&tracing_thread_sem, K_FOREVER);
+		} else {
+			tracing_merge_output();
+		}
+	}
+}
+#else
 static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 {
 	uint8_t *transferring_buf;
@@ -77,6 +132,7 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 		}
 	}
 }
+#endif /* CONFIG_TRACING_BUFFER_PER_CPU */
 
 static void tracing_thread_timer_expiry_fn(struct k_timer *timer)
 {
@@ -97,7 +153,9 @@ static int tracing_init(void)
 	working_backend = tracing_backend_get(TRACING_BACKEND_NAME);
 	tracing_backend_init(working_backend);
 
-	atomic_set(&tracing_packet_drop_num, 0);
+	for (int i = 0; i < ARRAY_SIZE(tracing_packet_drop_num); i++) {
+		atomic_set(&tracing_packet_drop_num[i], 0);
+	}
 
 	if (IS_ENABLED(CONFIG_TRACING_HANDLE_HOST_CMD)) {
 		tracing_set_state(TRACING_DISABLE);
@@ -158,5 +216,13 @@ void tracing_buffer_handle(uint8_t *data, uint32_t length)
 
 void tracing_packet_drop_handle(void)
 {
-	atomic_inc(&tracing_packet_drop_num);
+	unsigned int key = arch_irq_lock();
+
+	atomic_inc(&tracing_packet_drop_num[arch_curr_cpu()->id]);
+	arch_irq_unlock(key);
+}
+
+uint32_t tracing_packet_drop_get(unsigned int cpu)
+{
+	return (uint32_t)atomic_get(&tracing_packet_drop_num[cpu]);
 }
@@ -0,0 +1,89 @@
+/* chan_b.c */
+
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "master.h"
+
+/**
+ * @brief Channel transfer speed test
+ */
+void channel_test(void)
+{
+	uint32_t et; /* elapsed time */
+	int i;
+	timing_t  start;
+	timing_t  end;
+	void *slot;
+
+	PRINT_STRING(dashline);
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_MSGQ_RUNS; i++) {
+		k_chan_put(&CHANX4, data_bench, K_FOREVER);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "enqueue 4 bytes msg in CHAN",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
+
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_MSGQ_RUNS; i++) {
+		k_chan_get(&CHANX4, data_bench, K_FOREVER);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "dequeue 4 bytes msg from CHAN",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
+
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_MSGQ_RUNS; i++) {
+		k_chan_put_claim(&CHANX4, &slot, K_FOREVER);
+		*(uint32_t *)slot = i;
+		k_chan_put_commit(&CHANX4, slot);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "enqueue 4 bytes msg in CHAN, zero-copy",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
+
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_MSGQ_RUNS; i++) {
+		k_chan_get_claim(&CHANX4, &slot, K_FOREVER);
+		k_chan_get_finish(&CHANX4, slot);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "dequeue 4 bytes msg from CHAN, zero-copy",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
+
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_MSGQ_RUNS; i++) {
+		k_chan_put(&CHANX192, data_bench, K_FOREVER);
+		k_chan_get(&CHANX192, data_bench, K_FOREVER);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "enqueue and dequeue 192 bytes msg in CHAN",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
+
+	k_sem_give(&STARTRCV);
+
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_MSGQ_RUNS; i++) {
+		k_chan_put(&CHANX4, data_bench, K_FOREVER);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT,
+		"enqueue 4 bytes in CHAN to a waiting higher priority task",
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
+}
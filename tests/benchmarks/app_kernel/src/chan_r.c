@@ -0,0 +1,26 @@
+/* chan_r.c */
+
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "receiver.h"
+#include "master.h"
+
+/* channel transfer speed test */
+
+static BENCH_BMEM char buffer[4];
+
+/**
+ * @brief Data receive task
+ */
+void chanrecvtask(void)
+{
+	int i;
+
+	for (i = 0; i < NR_OF_MSGQ_RUNS; i++) {
+		k_chan_get(&CHANX4, buffer, K_FOREVER);
+	}
+}
@@ -57,6 +57,14 @@ K_MSGQ_DEFINE(DEMOQX192, 192, 500, 4);
 K_MSGQ_DEFINE(MB_COMM, 12, 1, 4);
 K_MSGQ_DEFINE(CH_COMM, 12, 1, 4);
 
+/* Channels are initialized at runtime, for their slots to be accessible to
+ * user mode threads.
+ */
+struct k_chan CHANX4;
+struct k_chan CHANX192;
+static BENCH_BMEM uint8_t __aligned(8) chanx4_buf[K_CHAN_BUF_SIZE(4, 512)];
+static BENCH_BMEM uint8_t __aligned(8) chanx192_buf[K_CHAN_BUF_SIZE(192, 2)];
+
 K_MEM_SLAB_DEFINE(MAP1, 16, 2, 4);
 
 K_SEM_DEFINE(SEM0, 0, 1);
@@ -121,6 +129,7 @@ static void test_thread_entry(void *p1, void *p2, void *p3)
 	PRINT_STRING(dashline);
 
 	message_queue_test();
+	channel_test();
 	sema_test();
 	mutex_test();
 
@@ -148,6 +157,9 @@ int main(void)
 
 	bench_test_init();
 
+	k_chan_init(&CHANX4, chanx4_buf, 4, 512);
+	k_chan_init(&CHANX192, chanx192_buf, 192, 2);
+
 	timing_init();
 
 	timing_start();
@@ -186,7 +198,7 @@ int main(void)
 			5, K_USER, K_FOREVER);
 
 	k_thread_access_grant(&recv_thread, &DEMOQX1, &DEMOQX4, &DEMOQX192,
-			      &MB_COMM, &CH_COMM, &SEM0, &SEM1, &SEM2, &SEM3,
+			      &CHANX4, &CHANX192, &MB_COMM, &CH_COMM, &SEM0, &SEM1, &SEM2, &SEM3,
 			      &SEM4, &STARTRCV, &DEMO_MUTEX,
 			      &PIPE_NOBUFF, &PIPE_SMALLBUFF, &PIPE_BIGBUFF);
 
@@ -210,7 +222,7 @@ int main(void)
 			5, 0, K_FOREVER);
 
 	k_thread_access_grant(&test_thread, &DEMOQX1, &DEMOQX4, &DEMOQX192,
-			      &MB_COMM, &CH_COMM, &SEM0, &SEM1, &SEM2, &SEM3,
+			      &CHANX4, &CHANX192, &MB_COMM, &CH_COMM, &SEM0, &SEM1, &SEM2, &SEM3,
 			      &SEM4, &STARTRCV, &DEMO_MUTEX,
 			      &PIPE_NOBUFF, &PIPE_SMALLBUFF, &PIPE_BIGBUFF);
 
@@ -234,11 +246,11 @@ int main(void)
 			5, K_USER, K_FOREVER);
 
 	k_thread_access_grant(&test_thread, &DEMOQX1, &DEMOQX4, &DEMOQX192,
-			      &MB_COMM, &CH_COMM, &SEM0, &SEM1, &SEM2, &SEM3,
+			      &CHANX4, &CHANX192, &MB_COMM, &CH_COMM, &SEM0, &SEM1, &SEM2, &SEM3,
 			      &SEM4, &STARTRCV, &DEMO_MUTEX,
 			      &PIPE_NOBUFF, &PIPE_SMALLBUFF, &PIPE_BIGBUFF);
 	k_thread_access_grant(&recv_thread, &DEMOQX1, &DEMOQX4, &DEMOQX192,
-			      &MB_COMM, &CH_COMM, &SEM0, &SEM1, &SEM2, &SEM3,
+			      &CHANX4, &CHANX192, &MB_COMM, &CH_COMM, &SEM0, &SEM1, &SEM2, &SEM3,
 			      &SEM4, &STARTRCV, &DEMO_MUTEX,
 			      &PIPE_NOBUFF, &PIPE_SMALLBUFF, &PIPE_BIGBUFF);
 
@@ -31,6 +31,7 @@
 #define SLINE_LEN 256
 
 #define NR_OF_MSGQ_RUNS 500
+#define NR_OF_MSGQ_BATCH 10
 #define NR_OF_SEMA_RUNS 500
 #define NR_OF_MUTEX_RUNS 1000
 #define NR_OF_MAP_RUNS 1000
@@ -77,6 +78,7 @@ extern void recvtask(void *p1, void *p2, void *p3);
 extern void mailbox_test(void);
 extern void sema_test(void);
 extern void message_queue_test(void);
+extern void channel_test(void);
 extern void mutex_test(void);
 extern void memorymap_test(void);
 extern void pipe_test(void);
@@ -97,6 +99,9 @@ extern struct k_msgq DEMOQX192;
 extern struct k_msgq MB_COMM;
 extern struct k_msgq CH_COMM;
 
+extern struct k_chan CHANX4;
+extern struct k_chan CHANX192;
+
 extern struct k_mbox MAILB1;
 
 extern struct k_pipe PIPE_NOBUFF;
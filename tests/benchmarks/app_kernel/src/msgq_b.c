@@ -78,6 +78,26 @@ void message_queue_test(void)
 	PRINT_F(FORMAT, "dequeue 192 bytes msg in MSGQ",
 		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
 
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_MSGQ_RUNS; i += NR_OF_MSGQ_BATCH) {
+		k_msgq_put_many(&DEMOQX4, data_bench, NR_OF_MSGQ_BATCH, K_FOREVER);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "enqueue 4 bytes msg in MSGQ, batches of " STRINGIFY(NR_OF_MSGQ_BATCH),
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
+
+	start = timing_timestamp_get();
+	for (i = 0; i < NR_OF_MSGQ_RUNS; i += NR_OF_MSGQ_BATCH) {
+		k_msgq_get_many(&DEMOQX4, data_bench, NR_OF_MSGQ_BATCH, K_FOREVER);
+	}
+	end = timing_timestamp_get();
+	et = (uint32_t)timing_cycles_get(&start, &end);
+
+	PRINT_F(FORMAT, "dequeue 4 bytes msg in MSGQ, batches of " STRINGIFY(NR_OF_MSGQ_BATCH),
+		SYS_CLOCK_HW_CYCLES_TO_NS_AVG(et, NR_OF_MSGQ_RUNS));
+
 	k_sem_give(&STARTRCV);
 
 	start = timing_timestamp_get();
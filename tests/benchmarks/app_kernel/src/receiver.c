@@ -20,6 +20,7 @@
 BENCH_DMEM char data_recv[MESSAGE_SIZE] = { 0 };
 
 void dequtask(void);
+void chanrecvtask(void);
 void waittask(void);
 void mailrecvtask(void);
 void piperecvtask(void);
@@ -39,6 +40,9 @@ void recvtask(void *p1, void *p2, void *p3)
 	k_sem_take(&STARTRCV, K_FOREVER);
 	dequtask();
 
+	k_sem_take(&STARTRCV, K_FOREVER);
+	chanrecvtask();
+
 	k_sem_take(&STARTRCV, K_FOREVER);
 	waittask();
 
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure the per packet cost of the connection handler lookup.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/printk.h>
+
+#include "connection.h"
+
+#define NUM_CONNS   CONFIG_BENCHMARK_NUM_CONNS
+#define UDP_PORT    5000
+#define TCP_PORT    80
+#define REMOTE_PORT 40000
+
+static const struct in_addr local_ip = { { { 192, 0, 2, 1 } } };
+static const struct in_addr remote_ip = { { { 198, 51, 100, 1 } } };
+
+static uint32_t matched;
+
+static enum net_verdict conn_cb(struct net_conn *conn, struct net_pkt *pkt,
+				union net_ip_header *ip_hdr,
+				union net_proto_header *proto_hdr,
+				void *user_data)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+
+	/* Keep the packet, it is fed again on the next lookup */
+	if (POINTER_TO_UINT(user_data) == matched) {
+		matched++;
+	}
+
+	return NET_OK;
+}
+
+static int register_conns(void)
+{
+	struct sockaddr_in local = {
+		.sin_family = AF_INET,
+		.sin_addr = local_ip,
+	};
+	struct sockaddr_in remote = {
+		.sin_family = AF_INET,
+		.sin_addr = remote_ip,
+	};
+	int ret;
+
+	for (int i = 0; i < NUM_CONNS; i++) {
+		ret = net_conn_register(IPPROTO_UDP, AF_INET, NULL,
+					(struct sockaddr *)&local, 0, UDP_PORT + i,
+					NULL, conn_cb, UINT_TO_POINTER(i), NULL);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	for (int i = 0; i < NUM_CONNS; i++) {
+		ret = net_conn_register(IPPROTO_TCP, AF_INET,
+					(struct sockaddr *)&remote,
+					(struct sockaddr *)&local,
+					REMOTE_PORT + i, TCP_PORT,
+					NULL, conn_cb, UINT_TO_POINTER(i), NULL);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static void report(const char *tag, const char *descr, uint64_t cycles, uint32_t count)
+{
+	uint64_t avg = cycles / count;
+	uint32_t avg_ns = (uint32_t)timing_cycles_to_ns_avg(cycles, count);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s - %s, %d connections, per packet : %7llu cycles , %7u ns :\n",
+	       tag, descr, NUM_CONNS, avg, avg_ns);
+#else
+	ARG_UNUSED(tag);
+
+	printk("%s, %d connections, per packet: %7llu cycles (%7u nsec)\n", descr,
+	       NUM_CONNS, avg, avg_ns);
+#endif
+}
+
+static int run(const char *tag, const char *descr, struct net_pkt *pkt, uint8_t proto)
+{
+	struct net_ipv4_hdr ipv4 = {
+		.vhl = 0x45,
+		.ttl = 64,
+		.proto = proto,
+	};
+	struct net_udp_hdr udp = { 0 };
+	struct net_tcp_hdr tcp = { 0 };
+	union net_ip_header ip_hdr = { .ipv4 = &ipv4 };
+	union net_proto_header proto_hdr;
+	uint64_t cycles = 0;
+	timing_t start;
+	timing_t finish;
+
+	net_ipv4_addr_copy_raw(ipv4.src, (const uint8_t *)&remote_ip);
+	net_ipv4_addr_copy_raw(ipv4.dst, (const uint8_t *)&local_ip);
+
+	if (proto == IPPROTO_UDP) {
+		udp.src_port = htons(REMOTE_PORT);
+		proto_hdr.udp = &udp;
+	} else {
+		tcp.dst_port = htons(TCP_PORT);
+		proto_hdr.tcp = &tcp;
+	}
+
+	for (int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		matched = 0;
+
+		start = timing_counter_get();
+
+		for (int j = 0; j < NUM_CONNS; j++) {
+			if (proto == IPPROTO_UDP) {
+				udp.dst_port = htons(UDP_PORT + j);
+			} else {
+				tcp.src_port = htons(REMOTE_PORT + j);
+			}
+
+			(void)net_conn_input(pkt, &ip_hdr, proto, &proto_hdr);
+		}
+
+		finish = timing_counter_get();
+		cycles += timing_cycles_get(&start, &finish);
+
+		if (matched != NUM_CONNS) {
+			printk("%s: %u of %d packets reached their handler\n", descr,
+			       matched, NUM_CONNS);
+			return -1;
+		}
+	}
+
+	report(tag, descr, cycles, CONFIG_BENCHMARK_NUM_ITERATIONS * NUM_CONNS);
+
+	return 0;
+}
+
+int main(void)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	timing_init();
+	timing_start();
+
+	ret = register_conns();
+	if (ret < 0) {
+		printk("net_conn_register failed (%d)\n", ret);
+		printk("PROJECT EXECUTION FAILED\n");
+		return 0;
+	}
+
+	pkt = net_pkt_alloc_on_iface(net_if_get_default(), K_FOREVER);
+	net_pkt_set_family(pkt, AF_INET);
+
+	printk("Connection lookup, %s\n",
+	       IS_ENABLED(CONFIG_NET_CONN_HASH) ? "hash tables" : "list");
+
+	ret = run("conn.udp_listen", "UDP, listening", pkt, IPPROTO_UDP);
+	if (ret == 0) {
+		ret = run("conn.tcp_connected", "TCP, connected", pkt, IPPROTO_TCP);
+	}
+
+	net_pkt_unref(pkt);
+
+	timing_stop();
+
+	if (ret == 0) {
+		printk("PROJECT EXECUTION SUCCESSFUL\n");
+	} else {
+		printk("PROJECT EXECUTION FAILED\n");
+	}
+
+	return 0;
+}
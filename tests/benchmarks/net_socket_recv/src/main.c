@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Compare copying and zero-copy reception of UDP datagrams on a socket.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/printk.h>
+
+#define BATCH   CONFIG_BENCHMARK_BATCH_SIZE
+#define PAYLOAD CONFIG_BENCHMARK_PAYLOAD_SIZE
+#define PORT    4242
+
+static uint8_t tx_buf[PAYLOAD];
+static uint8_t rx_buf[PAYLOAD];
+
+/* Touch every byte, as an application consuming the data would */
+static uint32_t checksum;
+
+typedef int (*recv_fn_t)(int sock);
+
+static int recv_copy(int sock)
+{
+	ssize_t ret = zsock_recv(sock, rx_buf, sizeof(rx_buf), 0);
+
+	if (ret != PAYLOAD) {
+		return -1;
+	}
+
+	for (size_t i = 0; i < PAYLOAD; i++) {
+		checksum += rx_buf[i];
+	}
+
+	return 0;
+}
+
+static int recv_zc(int sock)
+{
+	struct net_buf *frags;
+	ssize_t ret = zsock_recvfrom_zc(sock, &frags, 0, NULL, NULL);
+
+	if (ret != PAYLOAD) {
+		return -1;
+	}
+
+	for (struct net_buf *frag = frags; frag != NULL; frag = frag->frags) {
+		for (size_t i = 0; i < frag->len; i++) {
+			checksum += frag->data[i];
+		}
+	}
+
+	net_buf_unref(frags);
+
+	return 0;
+}
+
+static int send_batch(int sock, const struct sockaddr_in *addr)
+{
+	for (int i = 0; i < BATCH; i++) {
+		ssize_t ret = zsock_sendto(sock, tx_buf, sizeof(tx_buf), 0,
+					   (const struct sockaddr *)addr, sizeof(*addr));
+
+		if (ret != PAYLOAD) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static void report(const char *tag, const char *descr, uint64_t cycles, uint32_t count)
+{
+	uint64_t avg = cycles / count;
+	uint32_t avg_ns = (uint32_t)timing_cycles_to_ns_avg(cycles, count);
+	uint32_t kib_s = avg_ns > 0 ? (uint32_t)((uint64_t)PAYLOAD * 1000000000ULL /
+						 avg_ns / 1024) : 0;
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: %s - %s, per datagram : %7llu cycles , %7u ns :\n", tag, descr,
+	       avg, avg_ns);
+#else
+	ARG_UNUSED(tag);
+
+	printk("%s, per datagram: %7llu cycles (%7u nsec)\n", descr, avg, avg_ns);
+#endif
+	printk("%s, throughput: %u KiB/s\n", descr, kib_s);
+}
+
+static int run(const char *tag, const char *descr, recv_fn_t fn,
+	       int tx_sock, int rx_sock, const struct sockaddr_in *addr)
+{
+	uint64_t cycles = 0;
+	timing_t start;
+	timing_t finish;
+
+	for (int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		if (send_batch(tx_sock, addr) < 0) {
+			printk("send failed (%d)\n", errno);
+			return -1;
+		}
+
+		/* Let the loopback deliver the whole batch */
+		while (true) {
+			int avail = 0;
+
+			(void)zsock_ioctl(rx_sock, ZFD_IOCTL_FIONREAD, &avail);
+			if (avail >= BATCH * PAYLOAD) {
+				break;
+			}
+
+			k_yield();
+		}
+
+		start = timing_counter_get();
+
+		for (int j = 0; j < BATCH; j++) {
+			if (fn(rx_sock) < 0) {
+				printk("receive failed (%d)\n", errno);
+				return -1;
+			}
+		}
+
+		finish = timing_counter_get();
+		cycles += timing_cycles_get(&start, &finish);
+	}
+
+	report(tag, descr, cycles, CONFIG_BENCHMARK_NUM_ITERATIONS * BATCH);
+
+	return 0;
+}
+
+int main(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(PORT),
+		.sin_addr = INADDR_LOOPBACK_INIT,
+	};
+	int tx_sock;
+	int rx_sock;
+	int ret;
+
+	timing_init();
+	timing_start();
+
+	for (size_t i = 0; i < sizeof(tx_buf); i++) {
+		tx_buf[i] = (uint8_t)i;
+	}
+
+	tx_sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	rx_sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (tx_sock < 0 || rx_sock < 0) {
+		printk("socket failed (%d)\n", errno);
+		return 0;
+	}
+
+	ret = zsock_bind(rx_sock, (struct sockaddr *)&addr, sizeof(addr));
+	if (ret < 0) {
+		printk("bind failed (%d)\n", errno);
+		return 0;
+	}
+
+	printk("UDP receive, %d byte datagrams, batches of %d\n", PAYLOAD, BATCH);
+
+	ret = run("udp.recv_copy", "zsock_recvfrom", recv_copy, tx_sock, rx_sock, &addr);
+	if (ret == 0) {
+		ret = run("udp.recv_zc", "zsock_recvfrom_zc", recv_zc, tx_sock, rx_sock,
+			  &addr);
+	}
+
+	zsock_close(tx_sock);
+	zsock_close(rx_sock);
+
+	timing_stop();
+
+	if (ret == 0) {
+		printk("checksum %08x\n", checksum);
+		printk("PROJECT EXECUTION SUCCESSFUL\n");
+	} else {
+		printk("PROJECT EXECUTION FAILED\n");
+	}
+
+	return 0;
+}
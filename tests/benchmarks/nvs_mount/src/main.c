@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure the time taken to mount a full NVS file system.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/flash.h>
+#include <zephyr/fs/nvs.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/printk.h>
+
+#include "nvs_priv.h"
+
+#define NVS_FLASH_DEV \
+	DEVICE_DT_GET(DT_MTD_FROM_FIXED_PARTITION(DT_NODELABEL(storage_partition)))
+
+#define SECTOR_SIZE  CONFIG_BENCHMARK_NVS_SECTOR_SIZE
+#define SECTOR_COUNT CONFIG_BENCHMARK_NVS_SECTOR_COUNT
+#define NUM_IDS      CONFIG_BENCHMARK_NUM_IDS
+#define DATA_SIZE    32
+
+static struct nvs_fs fs;
+static uint32_t last_seq[NUM_IDS];
+
+static int fill(void)
+{
+	uint32_t data[DATA_SIZE / sizeof(uint32_t)] = { 0 };
+	uint32_t seq = 0U;
+	ssize_t ret;
+
+	/* One sector is always kept free for garbage collection */
+	while ((fs.ate_wra >> ADDR_SECT_SHIFT) != SECTOR_COUNT - 1) {
+		uint16_t id = seq % NUM_IDS;
+
+		data[0] = seq;
+		ret = nvs_write(&fs, id, data, sizeof(data));
+		if (ret != sizeof(data)) {
+			printk("nvs_write failed (%d)\n", (int)ret);
+			return -1;
+		}
+
+		last_seq[id] = seq++;
+	}
+
+	printk("%u entries written\n", seq);
+
+	return 0;
+}
+
+static int check(void)
+{
+	uint32_t data[DATA_SIZE / sizeof(uint32_t)];
+	ssize_t ret;
+
+	for (uint16_t id = 0; id < NUM_IDS; id++) {
+		ret = nvs_read(&fs, id, data, sizeof(data));
+		if (ret != sizeof(data) || data[0] != last_seq[id]) {
+			printk("id %u: unexpected content after mount\n", id);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static void report(uint64_t cycles, uint32_t count)
+{
+	uint64_t avg = cycles / count;
+	uint32_t avg_ns = (uint32_t)timing_cycles_to_ns_avg(cycles, count);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: nvs.mount - mount, %d sectors of %d bytes : %7llu cycles , %7u ns :\n",
+	       SECTOR_COUNT, SECTOR_SIZE, avg, avg_ns);
+#else
+	printk("mount, %d sectors of %d bytes: %7llu cycles (%7u nsec)\n", SECTOR_COUNT,
+	       SECTOR_SIZE, avg, avg_ns);
+#endif
+}
+
+static int run(void)
+{
+	uint64_t cycles = 0;
+	timing_t start;
+	timing_t finish;
+	int ret;
+
+	ret = flash_flatten(fs.flash_device, fs.offset, SECTOR_SIZE * SECTOR_COUNT);
+	if (ret < 0) {
+		printk("flash_flatten failed (%d)\n", ret);
+		return ret;
+	}
+
+	ret = nvs_mount(&fs);
+	if (ret < 0) {
+		printk("nvs_mount failed (%d)\n", ret);
+		return ret;
+	}
+
+	ret = fill();
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		start = timing_counter_get();
+		ret = nvs_mount(&fs);
+		finish = timing_counter_get();
+
+		if (ret < 0) {
+			printk("nvs_mount failed (%d)\n", ret);
+			return ret;
+		}
+
+		cycles += timing_cycles_get(&start, &finish);
+	}
+
+	report(cycles, CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	return check();
+}
+
+int main(void)
+{
+	int ret;
+
+	fs.flash_device = NVS_FLASH_DEV;
+	fs.offset = CONFIG_BENCHMARK_NVS_OFFSET;
+	fs.sector_size = SECTOR_SIZE;
+	fs.sector_count = SECTOR_COUNT;
+
+	if (!device_is_ready(fs.flash_device)) {
+		printk("Flash device not ready\n");
+		printk("PROJECT EXECUTION FAILED\n");
+		return 0;
+	}
+
+	timing_init();
+	timing_start();
+
+	printk("NVS mount, %s\n",
+	       IS_ENABLED(CONFIG_NVS_CHECKPOINT) ? "lookup cache with checkpoints" :
+	       IS_ENABLED(CONFIG_NVS_LOOKUP_CACHE) ? "lookup cache" : "no lookup cache");
+
+	ret = run();
+
+	timing_stop();
+
+	if (ret == 0) {
+		printk("PROJECT EXECUTION SUCCESSFUL\n");
+	} else {
+		printk("PROJECT EXECUTION FAILED\n");
+	}
+
+	return 0;
+}
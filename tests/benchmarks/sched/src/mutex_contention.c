@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* This benchmark measures the throughput of a contended mutex.  For each
+ * thread count from 1 up to the number of CPUs, the threads repeatedly
+ * lock a shared mutex, hold it for a short busy wait, unlock it and do
+ * as much work outside of it, while the (higher priority) main thread
+ * sleeps.  The aggregate number of lock/unlock cycles per second is
+ * then reported.
+ *
+ * Without CONFIG_MUTEX_ADAPTIVE_SPIN every contended lock pends the
+ * caller and every unlock wakes it up again, so the rate drops as soon
+ * as a second thread is added.  With it the waiters spin while the owner
+ * runs on another CPU and the context switches are avoided.
+ */
+
+#define MAX_THREADS CONFIG_MP_MAX_NUM_CPUS
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORKER_PRIO 1
+
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stack, MAX_THREADS, STACK_SIZE);
+static struct k_thread worker_thread[MAX_THREADS];
+
+static K_MUTEX_DEFINE(mutex);
+
+/* Only written by the matching worker thread */
+static volatile uint32_t cycles[MAX_THREADS];
+
+static volatile bool running;
+
+static void worker_fn(void *arg1, void *arg2, void *arg3)
+{
+	uintptr_t i = (uintptr_t)arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (running) {
+		k_mutex_lock(&mutex, K_FOREVER);
+		k_busy_wait(CONFIG_BENCHMARK_SCHED_MUTEX_HOLD_US);
+		k_mutex_unlock(&mutex);
+
+		cycles[i]++;
+		k_busy_wait(CONFIG_BENCHMARK_SCHED_MUTEX_HOLD_US);
+	}
+}
+
+static uint64_t run_threads(unsigned int num_threads)
+{
+	uint64_t total = 0U;
+	unsigned int i;
+
+	running = true;
+
+	for (i = 0; i < num_threads; i++) {
+		cycles[i] = 0U;
+
+		k_thread_create(&worker_thread[i], worker_stack[i], STACK_SIZE,
+				worker_fn, (void *)(uintptr_t)i, NULL, NULL,
+				WORKER_PRIO, 0, K_NO_WAIT);
+	}
+
+	k_msleep(CONFIG_BENCHMARK_SCHED_MUTEX_MS);
+
+	running = false;
+
+	/* Let the workers finish their cycle, not to abort the owner */
+	for (i = 0; i < num_threads; i++) {
+		k_thread_join(&worker_thread[i], K_FOREVER);
+		total += cycles[i];
+	}
+
+	return total;
+}
+
+int main(void)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	printk("Mutex contention, %u CPU(s), hold %u us, adaptive spinning %s\n",
+	       num_cpus, CONFIG_BENCHMARK_SCHED_MUTEX_HOLD_US,
+	       IS_ENABLED(CONFIG_MUTEX_ADAPTIVE_SPIN) ? "on" : "off");
+
+	for (unsigned int threads = 1; threads <= num_cpus; threads++) {
+		uint64_t locks = run_threads(threads);
+		uint64_t rate = (locks * MSEC_PER_SEC) / CONFIG_BENCHMARK_SCHED_MUTEX_MS;
+
+		printk("threads %2u locks/s %8u (per thread %8u)\n", threads,
+		       (uint32_t)rate, (uint32_t)(rate / threads));
+	}
+
+	printk("fin\n");
+	return 0;
+}
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * Measure the time taken to load settings, all of them, one subtree and a
+ * single setting.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/util.h>
+
+#define NUM_SUBTREES 20
+#define NUM_KEYS     CONFIG_BENCHMARK_NUM_KEYS
+
+/* subtree and setting loaded by the subtree and single setting loads */
+#define SUBTREE      "bench7"
+#define SUBTREE_KEYS (NUM_KEYS / NUM_SUBTREES + ((7 < NUM_KEYS % NUM_SUBTREES) ? 1 : 0))
+#define SINGLE_KEY   SUBTREE "/42"
+
+BUILD_ASSERT(NUM_KEYS > 42 * NUM_SUBTREES + 7, "the single setting is not stored");
+
+static uint32_t set_count;
+
+static int bench_set(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg)
+{
+	uint32_t value;
+
+	if (len != sizeof(value) || read_cb(cb_arg, &value, sizeof(value)) != sizeof(value)) {
+		return -EINVAL;
+	}
+
+	set_count++;
+
+	return 0;
+}
+
+static int bench_direct(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+			void *param)
+{
+	return bench_set(key, len, read_cb, cb_arg);
+}
+
+#define BENCH_HANDLER(i, _)                                                                    \
+	SETTINGS_STATIC_HANDLER_DEFINE(bench##i, "bench" STRINGIFY(i), NULL, bench_set, NULL,   \
+				       NULL)
+
+LISTIFY(NUM_SUBTREES, BENCH_HANDLER, (;));
+
+static int fill(void)
+{
+	char name[SETTINGS_MAX_NAME_LEN + 1];
+	int ret;
+
+	for (uint32_t i = 0; i < NUM_KEYS; i++) {
+		snprintk(name, sizeof(name), "bench%u/%u", i % NUM_SUBTREES, i / NUM_SUBTREES);
+		ret = settings_save_one(name, &i, sizeof(i));
+		if (ret < 0) {
+			printk("settings_save_one failed (%d)\n", ret);
+			return ret;
+		}
+	}
+
+	printk("%u settings written\n", NUM_KEYS);
+
+	return 0;
+}
+
+static void report(const char *what, uint64_t cycles, uint32_t count)
+{
+	uint64_t avg = cycles / count;
+	uint32_t avg_ns = (uint32_t)timing_cycles_to_ns_avg(cycles, count);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	printk("REC: settings.load - %s, %d settings : %7llu cycles , %7u ns :\n", what,
+	       NUM_KEYS, avg, avg_ns);
+#else
+	printk("%s, %d settings: %7llu cycles (%7u nsec)\n", what, NUM_KEYS, avg, avg_ns);
+#endif
+}
+
+/* Load the settings with subtree, or a single setting with single, and check
+ * that the handlers are called for the expected settings.
+ */
+static int measure(const char *what, const char *subtree, bool single, uint32_t expected)
+{
+	uint64_t cycles = 0;
+	timing_t start;
+	timing_t finish;
+	int ret;
+
+	for (int i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		set_count = 0;
+
+		start = timing_counter_get();
+		if (single) {
+			ret = settings_load_subtree_direct(subtree, bench_direct, NULL);
+		} else {
+			ret = settings_load_subtree(subtree);
+		}
+		finish = timing_counter_get();
+
+		if (ret < 0) {
+			printk("%s failed (%d)\n", what, ret);
+			return ret;
+		}
+
+		if (set_count != expected) {
+			printk("%s: %u settings loaded, %u expected\n", what, set_count, expected);
+			return -EIO;
+		}
+
+		cycles += timing_cycles_get(&start, &finish);
+	}
+
+	report(what, cycles, CONFIG_BENCHMARK_NUM_ITERATIONS);
+
+	return 0;
+}
+
+static int run(void)
+{
+	const struct flash_area *fa;
+	int ret;
+
+	ret = flash_area_open(FIXED_PARTITION_ID(settings_partition), &fa);
+	if (ret < 0) {
+		printk("flash_area_open failed (%d)\n", ret);
+		return ret;
+	}
+
+	ret = flash_area_flatten(fa, 0, fa->fa_size);
+	flash_area_close(fa);
+	if (ret < 0) {
+		printk("flash_area_flatten failed (%d)\n", ret);
+		return ret;
+	}
+
+	ret = settings_subsys_init();
+	if (ret < 0) {
+		printk("settings_subsys_init failed (%d)\n", ret);
+		return ret;
+	}
+
+	ret = fill();
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = measure("load all", NULL, false, NUM_KEYS);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = measure("load subtree", SUBTREE, false, SUBTREE_KEYS);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return measure("load single", SINGLE_KEY, true, 1);
+}
+
+int main(void)
+{
+	int ret;
+
+	timing_init();
+	timing_start();
+
+	printk("Settings load, %s, %s\n",
+	       IS_ENABLED(CONFIG_SETTINGS_HANDLER_INDEX) ? "handler index" : "no handler index",
+	       IS_ENABLED(CONFIG_SETTINGS_NVS_NAME_CACHE_LOAD) ? "name cache load" :
+	       IS_ENABLED(CONFIG_SETTINGS_NVS_NAME_CACHE) ? "name cache" : "no name cache");
+
+	ret = run();
+
+	timing_stop();
+
+	if (ret == 0) {
+		printk("PROJECT EXECUTION SUCCESSFUL\n");
+	} else {
+		printk("PROJECT EXECUTION FAILED\n");
+	}
+
+	return 0;
+}
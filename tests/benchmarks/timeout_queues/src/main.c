@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file
+ * This file contains the main testing module that invokes all the tests.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timestamp.h>
+#include "utils.h"
+#include <zephyr/tc_util.h>
+#include <timeout_q.h>
+
+/* Delays are spread over this many ticks past MIN_DELAY_TICKS */
+#define MIN_DELAY_TICKS  1000U
+#define DELAY_SPAN_TICKS 0x10000U
+
+uint32_t tm_off;
+
+static struct _timeout test_timeout[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+static k_ticks_t test_delay[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+static uint16_t expiry_order[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+
+static uint64_t add_cycles[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+static uint64_t abort_cycles[CONFIG_BENCHMARK_NUM_TIMEOUTS];
+
+/**
+ * The timeout handler is not expected to execute.
+ */
+static void test_handler(struct _timeout *t)
+{
+	printk("Timeout %u unexpectedly expired\n",
+	       (unsigned int)(t - test_timeout));
+}
+
+static void init_timeouts(unsigned int num_timeouts)
+{
+	uint32_t seed = 0x2545f491U;
+	unsigned int i;
+
+	for (i = 0; i < num_timeouts; i++) {
+		/* Simple LCG so each run uses the same delays */
+		seed = (seed * 1664525U) + 1013904223U;
+		test_delay[i] = MIN_DELAY_TICKS + ((seed >> 8) % DELAY_SPAN_TICKS);
+		z_init_timeout(&test_timeout[i]);
+	}
+
+	/* All timeouts are armed back to back, so sorting by delay gives
+	 * the order in which they become the earliest pending one.
+	 */
+	for (i = 0; i < num_timeouts; i++) {
+		unsigned int j = i;
+
+		while ((j > 0) && (test_delay[expiry_order[j - 1]] > test_delay[i])) {
+			expiry_order[j] = expiry_order[j - 1];
+			j--;
+		}
+		expiry_order[j] = i;
+	}
+}
+
+static void cycles_reset(unsigned int num_timeouts)
+{
+	unsigned int i;
+
+	for (i = 0; i < num_timeouts; i++) {
+		add_cycles[i] = 0ULL;
+		abort_cycles[i] = 0ULL;
+	}
+}
+
+static void test_add_abort(unsigned int num_timeouts)
+{
+	unsigned int i;
+	timing_t start;
+	timing_t finish;
+
+	for (i = 0; i < num_timeouts; i++) {
+		start = timing_counter_get();
+		z_add_timeout(&test_timeout[i], test_handler,
+			      K_TICKS(test_delay[i]));
+		finish = timing_counter_get();
+		add_cycles[i] += timing_cycles_get(&start, &finish);
+	}
+
+	/* Abort in arming order, which is random with respect to expiry */
+	for (i = 0; i < num_timeouts; i++) {
+		start = timing_counter_get();
+		z_abort_timeout(&test_timeout[i]);
+		finish = timing_counter_get();
+		abort_cycles[num_timeouts - i - 1] +=
+			timing_cycles_get(&start, &finish);
+	}
+}
+
+static void test_abort_earliest(unsigned int num_timeouts)
+{
+	unsigned int i;
+	struct _timeout *to;
+	timing_t start;
+	timing_t finish;
+
+	for (i = 0; i < num_timeouts; i++) {
+		z_add_timeout(&test_timeout[i], test_handler,
+			      K_TICKS(test_delay[i]));
+	}
+
+	for (i = num_timeouts; i > 0; i--) {
+		to = &test_timeout[expiry_order[num_timeouts - i]];
+
+		start = timing_counter_get();
+		z_abort_timeout(to);
+		finish = timing_counter_get();
+		abort_cycles[i - 1] += timing_cycles_get(&start, &finish);
+	}
+}
+
+static uint64_t sqrt_u64(uint64_t square)
+{
+	if (square > 1) {
+		uint64_t lo = sqrt_u64(square >> 2) << 1;
+		uint64_t hi = lo + 1;
+
+		return ((hi * hi) > square) ? lo : hi;
+	}
+
+	return square;
+}
+
+static void compute_and_report_stats(unsigned int num_threads, unsigned int num_iterations,
+				     uint64_t *cycles, const char *tag, const char *str)
+{
+	uint64_t minimum = cycles[0];
+	uint64_t maximum = cycles[0];
+	uint64_t total = cycles[0];
+	uint64_t average;
+	uint64_t std_dev = 0;
+	uint64_t tmp;
+	uint64_t diff;
+	unsigned int i;
+
+	for (i = 1; i < num_threads; i++) {
+		if (cycles[i] > maximum) {
+			maximum = cycles[i];
+		}
+
+		if (cycles[i] < minimum) {
+			minimum = cycles[i];
+		}
+
+		total += cycles[i];
+	}
+
+	minimum /= (uint64_t)num_iterations;
+	maximum /= (uint64_t)num_iterations;
+	average = total / (num_threads * num_iterations);
+
+	for (i = 0; i < num_threads; i++) {
+		tmp = cycles[i] / num_iterations;
+		diff = (average > tmp) ? (average - tmp) : (tmp - average);
+
+		std_dev += (diff * diff);
+	}
+	std_dev /= num_threads;
+	std_dev = sqrt_u64(std_dev);
+
+#ifdef CONFIG_BENCHMARK_RECORDING
+	int tag_len = strlen(tag);
+	int descr_len = strlen(str);
+	int stag_len = strlen(".stddev");
+	int sdescr_len = strlen(", stddev.");
+
+	stag_len = (tag_len + stag_len < 40) ? 40 - tag_len : stag_len;
+	sdescr_len = (descr_len + sdescr_len < 50) ? 50 - descr_len : sdescr_len;
+
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".min", str,
+	       sdescr_len, ", min.", minimum, (uint32_t)timing_cycles_to_ns(minimum));
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".max", str,
+	       sdescr_len, ", max.", maximum, (uint32_t)timing_cycles_to_ns(maximum));
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".avg", str,
+	       sdescr_len, ", avg.", average, (uint32_t)timing_cycles_to_ns(average));
+	printk("REC: %s%-*s - %s%-*s : %7llu cycles , %7u ns :\n", tag, stag_len, ".stddev", str,
+	       sdescr_len, ", stddev.", std_dev, (uint32_t)timing_cycles_to_ns(std_dev));
+#else
+	ARG_UNUSED(tag);
+
+	printk("------------------------------------\n");
+	printk("%s\n", str);
+
+	printk("    Minimum : %7llu cycles (%7u nsec)\n", minimum,
+	       (uint32_t)timing_cycles_to_ns(minimum));
+	printk("    Maximum : %7llu cycles (%7u nsec)\n", maximum,
+	       (uint32_t)timing_cycles_to_ns(maximum));
+	printk("    Average : %7llu cycles (%7u nsec)\n", average,
+	       (uint32_t)timing_cycles_to_ns(average));
+	printk("    Std Deviation: %7llu cycles (%7u nsec)\n", std_dev,
+	       (uint32_t)timing_cycles_to_ns(std_dev));
+#endif
+}
+
+int main(void)
+{
+	unsigned int i;
+	unsigned int freq;
+#ifdef CONFIG_BENCHMARK_VERBOSE
+	char description[120];
+	char tag[50];
+#endif
+
+	timing_init();
+
+	bench_test_init();
+
+	freq = timing_freq_get_mhz();
+
+	printk("Time Measurements for %s timeout queue\n",
+	       IS_ENABLED(CONFIG_TIMEOUT_QUEUE_WHEEL) ? "timing wheel" : "delta list");
+	printk("Timing results: Clock frequency: %u MHz\n", freq);
+
+	init_timeouts(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+
+	timing_start();
+
+	cycles_reset(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		test_add_abort(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+	}
+
+	compute_and_report_stats(CONFIG_BENCHMARK_NUM_TIMEOUTS, CONFIG_BENCHMARK_NUM_ITERATIONS,
+				 add_cycles, "timeout.add.random",
+				 "Arm timeouts of random delay");
+
+#ifdef CONFIG_BENCHMARK_VERBOSE
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_TIMEOUTS; i++) {
+		snprintf(tag, sizeof(tag), "TimeoutQ.add.%04u.pending", i);
+		snprintf(description, sizeof(description), "%-40s - Arm timeout of %u ticks",
+			 tag, (unsigned int)test_delay[i]);
+		PRINT_STATS_AVG(description, (uint32_t)add_cycles[i],
+				CONFIG_BENCHMARK_NUM_ITERATIONS);
+	}
+#endif
+
+	compute_and_report_stats(CONFIG_BENCHMARK_NUM_TIMEOUTS, CONFIG_BENCHMARK_NUM_ITERATIONS,
+				 abort_cycles, "timeout.abort.random",
+				 "Abort timeouts in arming order");
+
+#ifdef CONFIG_BENCHMARK_VERBOSE
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_TIMEOUTS; i++) {
+		snprintf(tag, sizeof(tag), "TimeoutQ.abort.%04u.pending", i + 1);
+		snprintf(description, sizeof(description), "%-40s - Abort timeout",
+			 tag);
+		PRINT_STATS_AVG(description, (uint32_t)abort_cycles[i],
+				CONFIG_BENCHMARK_NUM_ITERATIONS);
+	}
+#endif
+
+	cycles_reset(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_ITERATIONS; i++) {
+		test_abort_earliest(CONFIG_BENCHMARK_NUM_TIMEOUTS);
+	}
+
+	compute_and_report_stats(CONFIG_BENCHMARK_NUM_TIMEOUTS, CONFIG_BENCHMARK_NUM_ITERATIONS,
+				 abort_cycles, "timeout.abort.earliest",
+				 "Abort earliest timeout");
+
+#ifdef CONFIG_BENCHMARK_VERBOSE
+	for (i = 0; i < CONFIG_BENCHMARK_NUM_TIMEOUTS; i++) {
+		snprintf(tag, sizeof(tag), "TimeoutQ.abort.head.%04u.pending", i + 1);
+		snprintf(description, sizeof(description), "%-40s - Abort earliest timeout",
+			 tag);
+		PRINT_STATS_AVG(description, (uint32_t)abort_cycles[i],
+				CONFIG_BENCHMARK_NUM_ITERATIONS);
+	}
+#endif
+
+	timing_stop();
+
+	TC_END_REPORT(0);
+
+	return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/storage/disk_access.h>
+
+#define DISK_NAME   "RAM"
+#define SECTOR_SIZE CONFIG_DISK_CACHE_SECTOR_SIZE
+#define BLOCKS      CONFIG_DISK_CACHE_BLOCKS
+#define BURST       CONFIG_DISK_CACHE_BURST_SECTORS
+#define READ_AHEAD  CONFIG_DISK_CACHE_READ_AHEAD
+
+static const char *disk_pdrv = DISK_NAME;
+static uint32_t disk_sector_count;
+static uint8_t wbuf[4 * BLOCKS * SECTOR_SIZE];
+static uint8_t rbuf[4 * BLOCKS * SECTOR_SIZE];
+static struct disk_cache_stats stats;
+
+static void fill_pattern(uint8_t *buf, uint32_t sector, uint32_t count, uint8_t seed)
+{
+	for (uint32_t i = 0; i < count * SECTOR_SIZE; i++) {
+		buf[i] = (uint8_t)(sector + seed + i / SECTOR_SIZE + i);
+	}
+}
+
+/* Write back and drop the cached sectors, next reads come from the disk */
+static void cache_reset(void)
+{
+	int rc;
+
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_DEINIT, NULL);
+	zassert_equal(rc, 0, "Disk deinit failed (%d)", rc);
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_INIT, NULL);
+	zassert_equal(rc, 0, "Disk init failed (%d)", rc);
+
+	disk_cache_stats_get(&stats, true);
+}
+
+static void *disk_cache_setup(void)
+{
+	int rc;
+
+	rc = disk_access_init(disk_pdrv);
+	zassert_equal(rc, 0, "Disk access initialization failed");
+
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_GET_SECTOR_COUNT, &disk_sector_count);
+	zassert_equal(rc, 0, "Disk ioctl get sector count failed");
+
+	return NULL;
+}
+
+static void disk_cache_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	cache_reset();
+}
+
+ZTEST(disk_cache, test_read_hit)
+{
+	int rc;
+
+	rc = disk_access_read(disk_pdrv, rbuf, 10, 1);
+	zassert_equal(rc, 0, "Read failed (%d)", rc);
+	rc = disk_access_read(disk_pdrv, rbuf, 10, 1);
+	zassert_equal(rc, 0, "Read failed (%d)", rc);
+
+	disk_cache_stats_get(&stats, false);
+	zassert_equal(stats.read_misses, 1, "Unexpected misses %u", stats.read_misses);
+	zassert_equal(stats.read_hits, 1, "Unexpected hits %u", stats.read_hits);
+	zassert_equal(stats.disk_reads, 1, "Unexpected disk reads %u", stats.disk_reads);
+}
+
+ZTEST(disk_cache, test_read_ahead)
+{
+	uint32_t count = 1 + 3 * (1 + READ_AHEAD);
+	int rc;
+
+	/* the first read is not sequential, the next misses read ahead */
+	for (uint32_t i = 0; i < count; i++) {
+		rc = disk_access_read(disk_pdrv, rbuf, i, 1);
+		zassert_equal(rc, 0, "Read of sector %u failed (%d)", i, rc);
+	}
+
+	disk_cache_stats_get(&stats, false);
+	zassert_equal(stats.disk_reads, 4, "Unexpected disk reads %u", stats.disk_reads);
+	zassert_equal(stats.read_ahead, 3 * READ_AHEAD, "Unexpected read ahead %u",
+		      stats.read_ahead);
+	zassert_equal(stats.read_hits, 3 * READ_AHEAD, "Unexpected hits %u", stats.read_hits);
+}
+
+ZTEST(disk_cache, test_write_back)
+{
+	int rc;
+
+	fill_pattern(wbuf, 20, BURST, 1);
+
+	for (uint32_t i = 0; i < BURST; i++) {
+		rc = disk_access_write(disk_pdrv, &wbuf[i * SECTOR_SIZE], 20 + i, 1);
+		zassert_equal(rc, 0, "Write failed (%d)", rc);
+	}
+
+	disk_cache_stats_get(&stats, false);
+	zassert_equal(stats.disk_writes, 0, "Writes not cached");
+
+	rc = disk_access_read(disk_pdrv, rbuf, 20, BURST);
+	zassert_equal(rc, 0, "Read failed (%d)", rc);
+	zassert_mem_equal(rbuf, wbuf, BURST * SECTOR_SIZE, "Cached data mismatch");
+
+	/* the adjacent sectors are written with a single command */
+	rc = disk_access_ioctl(disk_pdrv, DISK_IOCTL_CTRL_SYNC, NULL);
+	zassert_equal(rc, 0, "Sync failed (%d)", rc);
+
+	disk_cache_stats_get(&stats, false);
+	zassert_equal(stats.disk_writes, 1, "Unexpected disk writes %u", stats.disk_writes);
+	zassert_equal(stats.disk_written, BURST, "Unexpected sectors written %u",
+		      stats.disk_written);
+
+	cache_reset();
+
+	memset(rbuf, 0, sizeof(rbuf));
+	rc = disk_access_read(disk_pdrv, rbuf, 20, BURST);
+	zassert_equal(rc, 0, "Read failed (%d)", rc);
+	zassert_mem_equal(rbuf, wbuf, BURST * SECTOR_SIZE, "Disk data mismatch");
+}
+
+ZTEST(disk_cache, test_evict)
+{
+	uint32_t count = 3 * BLOCKS;
+	int rc;
+
+	fill_pattern(wbuf, 40, count, 2);
+
+	/* dirty sectors are written back when evicted */
+	for (uint32_t i = 0; i < count; i++) {
+		rc = disk_access_write(disk_pdrv, &wbuf[i * SECTOR_SIZE], 40 + i, 1);
+		zassert_equal(rc, 0, "Write failed (%d)", rc);
+	}
+
+	disk_cache_stats_get(&stats, false);
+	zassert_true(stats.disk_written >= count - BLOCKS, "Evicted sectors not written");
+	zassert_true(stats.disk_writes <= stats.disk_written / 2, "Write backs not coalesced");
+
+	cache_reset();
+
+	memset(rbuf, 0, sizeof(rbuf));
+	for (uint32_t i = 0; i < count; i++) {
+		rc = disk_access_read(disk_pdrv, &rbuf[i * SECTOR_SIZE], 40 + i, 1);
+		zassert_equal(rc, 0, "Read failed (%d)", rc);
+	}
+
+	zassert_mem_equal(rbuf, wbuf, count * SECTOR_SIZE, "Disk data mismatch");
+}
+
+ZTEST(disk_cache, test_large_access)
+{
+	uint32_t count = 2 * BURST;
+	int rc;
+
+	/* a cached sector inside a large write is updated */
+	rc = disk_access_read(disk_pdrv, rbuf, 100 + 1, 1);
+	zassert_equal(rc, 0, "Read failed (%d)", rc);
+
+	fill_pattern(wbuf, 100, count, 3);
+	rc = disk_access_write(disk_pdrv, wbuf, 100, count);
+	zassert_equal(rc, 0, "Write failed (%d)", rc);
+
+	disk_cache_stats_get(&stats, true);
+	zassert_equal(stats.disk_writes, 1, "Large write not passed to the disk");
+
+	memset(rbuf, 0, sizeof(rbuf));
+	rc = disk_access_read(disk_pdrv, rbuf, 100, count);
+	zassert_equal(rc, 0, "Read failed (%d)", rc);
+	zassert_mem_equal(rbuf, wbuf, count * SECTOR_SIZE, "Data mismatch");
+
+	disk_cache_stats_get(&stats, false);
+	zassert_equal(stats.read_hits, 1, "Unexpected hits %u", stats.read_hits);
+	zassert_equal(stats.read_misses, count - 1, "Unexpected misses %u", stats.read_misses);
+}
+
+ZTEST(disk_cache, test_out_of_range)
+{
+	int rc;
+
+	rc = disk_access_read(disk_pdrv, rbuf, disk_sector_count - 1, 2);
+	zassert_not_equal(rc, 0, "Read out of the disk succeeded");
+
+	rc = disk_access_write(disk_pdrv, wbuf, disk_sector_count - 1, 2);
+	zassert_not_equal(rc, 0, "Write out of the disk succeeded");
+}
+
+ZTEST(disk_cache, test_latency)
+{
+	uint32_t count = 4 * BLOCKS;
+	int64_t start;
+	int64_t elapsed;
+	int rc;
+
+	/* sequential single sector reads from the disk with simulated command
+	 * latency take a fraction of the time with read ahead
+	 */
+	start = k_uptime_ticks();
+	for (uint32_t i = 0; i < count; i++) {
+		rc = disk_access_read(disk_pdrv, &rbuf[i * SECTOR_SIZE], i, 1);
+		zassert_equal(rc, 0, "Read failed (%d)", rc);
+	}
+	elapsed = k_ticks_to_us_ceil64(k_uptime_ticks() - start);
+
+	TC_PRINT("%u sequential reads in %lld us\n", count, elapsed);
+	zassert_true(elapsed < count * CONFIG_DISK_RAM_CMD_LATENCY_US / 2,
+		     "Read ahead ineffective");
+}
+
+ZTEST_SUITE(disk_cache, NULL, disk_cache_setup, disk_cache_before, NULL, NULL);
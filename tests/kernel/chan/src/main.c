@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define MAX_MSGS 4
+#define NUM_PRODUCERS 3
+#define MSGS_PER_PRODUCER 64
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct msg {
+	uint32_t producer;
+	uint32_t seq;
+};
+
+K_CHAN_DEFINE(chan, sizeof(struct msg), MAX_MSGS);
+
+static struct k_thread threads[NUM_PRODUCERS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_PRODUCERS, STACK_SIZE);
+
+static void put_entry(void *p1, void *p2, void *p3)
+{
+	struct msg msg = {
+		.producer = POINTER_TO_UINT(p1),
+	};
+
+	k_msleep(POINTER_TO_UINT(p2));
+
+	for (msg.seq = 0; msg.seq < POINTER_TO_UINT(p3); msg.seq++) {
+		zassert_ok(k_chan_put(&chan, &msg, K_FOREVER));
+	}
+}
+
+static k_tid_t start_producer(int i, uint32_t delay_ms, uint32_t count)
+{
+	return k_thread_create(&threads[i], stacks[i], K_THREAD_STACK_SIZEOF(stacks[i]),
+			       put_entry, UINT_TO_POINTER(i), UINT_TO_POINTER(delay_ms),
+			       UINT_TO_POINTER(count), K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+}
+
+static void chan_before(void *fixture)
+{
+	static uint8_t __aligned(8) buffer[K_CHAN_BUF_SIZE(sizeof(struct msg), MAX_MSGS)];
+
+	ARG_UNUSED(fixture);
+
+	/* Reset the statically defined channel between tests */
+	zassert_ok(k_chan_init(&chan, buffer, sizeof(struct msg), MAX_MSGS));
+}
+
+/**
+ * @brief Test messages are copied in and out in order
+ *
+ * @see k_chan_put(), k_chan_get()
+ */
+ZTEST(chan_api, test_chan_put_get)
+{
+	struct msg msg;
+
+	for (uint32_t round = 0; round < 3; round++) {
+		for (uint32_t i = 0; i < MAX_MSGS; i++) {
+			msg.seq = round * MAX_MSGS + i;
+			zassert_ok(k_chan_put(&chan, &msg, K_NO_WAIT));
+		}
+
+		msg.seq = UINT32_MAX;
+		zassert_equal(k_chan_put(&chan, &msg, K_NO_WAIT), -ENOMSG);
+		zassert_equal(k_chan_put(&chan, &msg, K_MSEC(10)), -EAGAIN);
+
+		for (uint32_t i = 0; i < MAX_MSGS; i++) {
+			zassert_ok(k_chan_get(&chan, &msg, K_NO_WAIT));
+			zassert_equal(msg.seq, round * MAX_MSGS + i);
+		}
+
+		zassert_equal(k_chan_get(&chan, &msg, K_NO_WAIT), -ENOMSG);
+		zassert_equal(k_chan_get(&chan, &msg, K_MSEC(10)), -EAGAIN);
+	}
+}
+
+/**
+ * @brief Test claimed slots are only visible to consumers once committed
+ *
+ * @see k_chan_put_claim(), k_chan_put_commit(), k_chan_get_claim(),
+ * k_chan_get_finish()
+ */
+ZTEST(chan_api, test_chan_claim)
+{
+	struct msg *first, *second, *msg;
+
+	zassert_ok(k_chan_put_claim(&chan, (void **)&first, K_NO_WAIT));
+	zassert_ok(k_chan_put_claim(&chan, (void **)&second, K_NO_WAIT));
+	zassert_not_equal(first, second);
+
+	first->seq = 1;
+	second->seq = 2;
+
+	/* Messages are received in claim order, not commit order */
+	zassert_ok(k_chan_put_commit(&chan, second));
+	zassert_equal(k_chan_get_claim(&chan, (void **)&msg, K_NO_WAIT), -ENOMSG);
+
+	zassert_ok(k_chan_put_commit(&chan, first));
+	zassert_ok(k_chan_get_claim(&chan, (void **)&msg, K_NO_WAIT));
+	zassert_equal_ptr(msg, first);
+	zassert_equal(msg->seq, 1);
+
+	/* The slot is not reused until it is finished */
+	for (int i = 0; i < MAX_MSGS - 2; i++) {
+		zassert_ok(k_chan_put_claim(&chan, (void **)&msg, K_NO_WAIT));
+		zassert_ok(k_chan_put_commit(&chan, msg));
+	}
+	zassert_equal(k_chan_put_claim(&chan, (void **)&msg, K_NO_WAIT), -ENOMSG);
+
+	zassert_ok(k_chan_get_finish(&chan, first));
+	zassert_ok(k_chan_put_claim(&chan, (void **)&msg, K_NO_WAIT));
+	zassert_equal_ptr(msg, first);
+	zassert_ok(k_chan_put_commit(&chan, msg));
+
+	zassert_ok(k_chan_get_claim(&chan, (void **)&msg, K_NO_WAIT));
+	zassert_equal_ptr(msg, second);
+	zassert_equal(msg->seq, 2);
+	zassert_ok(k_chan_get_finish(&chan, msg));
+}
+
+/**
+ * @brief Test committing pointers that are not claimed messages fails
+ *
+ * @see k_chan_put_commit(), k_chan_get_finish()
+ */
+ZTEST(chan_api, test_chan_invalid)
+{
+	static uint8_t __aligned(8) buffer[K_CHAN_BUF_SIZE(sizeof(struct msg), MAX_MSGS)];
+	struct k_chan other;
+	struct msg *msg;
+
+	zassert_equal(k_chan_init(&other, buffer, sizeof(struct msg), 1), -EINVAL);
+	zassert_equal(k_chan_init(&other, buffer, sizeof(struct msg), 3), -EINVAL);
+	zassert_equal(k_chan_init(&other, &buffer[1], sizeof(struct msg), MAX_MSGS), -EINVAL);
+
+	zassert_ok(k_chan_put_claim(&chan, (void **)&msg, K_NO_WAIT));
+	zassert_equal(k_chan_put_commit(&chan, (uint8_t *)msg + 1), -EINVAL);
+	zassert_equal(k_chan_put_commit(&chan, buffer), -EINVAL);
+	zassert_ok(k_chan_put_commit(&chan, msg));
+}
+
+/**
+ * @brief Test committing or finishing slots that are not claimed fails
+ *
+ * @see k_chan_put_commit(), k_chan_get_finish()
+ */
+ZTEST(chan_api, test_chan_not_claimed)
+{
+	struct msg *msg, *next;
+
+	/* Commit without a claim, the slot is free */
+	zassert_ok(k_chan_put_claim(&chan, (void **)&msg, K_NO_WAIT));
+	next = (struct msg *)((uint8_t *)msg + K_CHAN_BUF_SIZE(sizeof(struct msg), 1));
+	zassert_equal(k_chan_put_commit(&chan, next), -EINVAL);
+
+	/* Finish without a claim, the message is not committed yet */
+	zassert_equal(k_chan_get_finish(&chan, msg), -EINVAL);
+
+	/* Double commit */
+	zassert_ok(k_chan_put_commit(&chan, msg));
+	zassert_equal(k_chan_put_commit(&chan, msg), -EINVAL);
+
+	/* Finish without a claim, the message is committed */
+	zassert_equal(k_chan_get_finish(&chan, msg), -EINVAL);
+
+	zassert_ok(k_chan_get_claim(&chan, (void **)&msg, K_NO_WAIT));
+	zassert_equal(k_chan_put_commit(&chan, msg), -EINVAL);
+	zassert_ok(k_chan_get_finish(&chan, msg));
+
+	/* Double finish */
+	zassert_equal(k_chan_get_finish(&chan, msg), -EINVAL);
+
+	/* The channel is still usable */
+	zassert_equal(k_chan_get_claim(&chan, (void **)&msg, K_NO_WAIT), -ENOMSG);
+	for (int i = 0; i < MAX_MSGS; i++) {
+		zassert_ok(k_chan_put_claim(&chan, (void **)&msg, K_NO_WAIT));
+		zassert_ok(k_chan_put_commit(&chan, msg));
+	}
+	zassert_equal(k_chan_put_claim(&chan, (void **)&msg, K_NO_WAIT), -ENOMSG);
+	for (int i = 0; i < MAX_MSGS; i++) {
+		zassert_ok(k_chan_get_claim(&chan, (void **)&msg, K_NO_WAIT));
+		zassert_ok(k_chan_get_finish(&chan, msg));
+	}
+}
+
+/**
+ * @brief Test a blocked consumer is woken up by a producer
+ *
+ * @see k_chan_get()
+ */
+ZTEST(chan_api, test_chan_get_blocking)
+{
+	struct msg msg;
+	k_tid_t tid = start_producer(0, 50, 1);
+
+	zassert_ok(k_chan_get(&chan, &msg, K_MSEC(1000)));
+	zassert_equal(msg.producer, 0);
+	zassert_equal(msg.seq, 0);
+
+	k_thread_join(tid, K_FOREVER);
+}
+
+/**
+ * @brief Test producers blocked on a full channel deliver all messages
+ *
+ * @see k_chan_put(), k_chan_get()
+ */
+ZTEST(chan_api, test_chan_producers)
+{
+	uint32_t next[NUM_PRODUCERS] = {0};
+	struct msg msg;
+
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		start_producer(i, 0, MSGS_PER_PRODUCER);
+	}
+
+	for (int i = 0; i < NUM_PRODUCERS * MSGS_PER_PRODUCER; i++) {
+		zassert_ok(k_chan_get(&chan, &msg, K_MSEC(1000)));
+		zassert_true(msg.producer < NUM_PRODUCERS);
+
+		/* Messages of one producer stay in order */
+		zassert_equal(msg.seq, next[msg.producer]);
+		next[msg.producer]++;
+	}
+
+	for (int i = 0; i < NUM_PRODUCERS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	zassert_equal(k_chan_get(&chan, &msg, K_NO_WAIT), -ENOMSG);
+}
+
+#ifdef CONFIG_POLL
+/**
+ * @brief Test polling for data on a channel
+ *
+ * @see k_poll()
+ */
+ZTEST(chan_api, test_chan_poll)
+{
+	struct k_poll_event event;
+	struct msg msg;
+	k_tid_t tid;
+
+	k_poll_event_init(&event, K_POLL_TYPE_CHAN_DATA_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY,
+			  &chan);
+
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	tid = start_producer(0, 50, 1);
+
+	zassert_ok(k_poll(&event, 1, K_MSEC(1000)));
+	zassert_equal(event.state, K_POLL_STATE_CHAN_DATA_AVAILABLE);
+	zassert_ok(k_chan_get(&chan, &msg, K_NO_WAIT));
+
+	k_thread_join(tid, K_FOREVER);
+}
+#endif /* CONFIG_POLL */
+
+ZTEST_SUITE(chan_api, NULL, NULL, chan_before, NULL, NULL);
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_fifo.h"
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define LIST_LEN 5
+
+static struct k_fifo fifo_m;
+static fdata_t data[LIST_LEN];
+
+static K_THREAD_STACK_DEFINE(tstack, STACK_SIZE);
+static struct k_thread thread;
+
+static void t_put_entry(void *p1, void *p2, void *p3)
+{
+	k_sleep(K_MSEC(50));
+	k_fifo_put((struct k_fifo *)p1, &data[0]);
+	k_fifo_put((struct k_fifo *)p1, &data[1]);
+}
+
+/**
+ * @addtogroup kernel_fifo_tests
+ * @{
+ */
+
+/**
+ * @brief Test getting several elements from a FIFO queue with one call
+ * @see k_fifo_get_many()
+ */
+ZTEST(fifo_api, test_fifo_get_many)
+{
+	void *items[LIST_LEN + 1];
+
+	k_fifo_init(&fifo_m);
+	for (int i = 0; i < LIST_LEN; i++) {
+		k_fifo_put(&fifo_m, &data[i]);
+	}
+
+	/**TESTPOINT: elements come out in order, bounded by the array */
+	zassert_equal(k_fifo_get_many(&fifo_m, items, 3, K_NO_WAIT), 3);
+	for (int i = 0; i < 3; i++) {
+		zassert_equal(items[i], &data[i]);
+	}
+
+	zassert_equal(k_fifo_get_many(&fifo_m, items, ARRAY_SIZE(items), K_NO_WAIT), 2);
+	zassert_equal(items[0], &data[3]);
+	zassert_equal(items[1], &data[4]);
+
+	zassert_equal(k_fifo_get_many(&fifo_m, items, ARRAY_SIZE(items), K_NO_WAIT), 0);
+	zassert_true(k_fifo_is_empty(&fifo_m));
+}
+
+/**
+ * @brief Test a blocked FIFO bulk get returns the first element added
+ * @see k_fifo_get_many()
+ */
+ZTEST(fifo_api_1cpu, test_fifo_get_many_wait)
+{
+	void *items[LIST_LEN];
+	k_tid_t tid;
+
+	k_fifo_init(&fifo_m);
+	tid = k_thread_create(&thread, tstack, STACK_SIZE,
+			      t_put_entry, &fifo_m, NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	/**TESTPOINT: a successful wait hands over exactly one element */
+	zassert_equal(k_fifo_get_many(&fifo_m, items, ARRAY_SIZE(items), K_MSEC(500)), 1);
+	zassert_equal(items[0], &data[0]);
+
+	k_thread_join(tid, K_FOREVER);
+	zassert_equal(k_fifo_get_many(&fifo_m, items, ARRAY_SIZE(items), K_NO_WAIT), 1);
+	zassert_equal(items[0], &data[1]);
+}
+
+/**
+ * @}
+ */
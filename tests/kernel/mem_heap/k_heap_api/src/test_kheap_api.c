@@ -291,3 +291,82 @@ ZTEST(k_heap_api, test_k_heap_calloc)
 
 	k_heap_free(&k_heap_test, p);
 }
+
+static size_t fill_heap(void **blocks, size_t max, size_t bytes)
+{
+	size_t n = 0;
+
+	while (n < max) {
+		blocks[n] = k_heap_alloc(&k_heap_test, bytes, K_NO_WAIT);
+		if (blocks[n] == NULL) {
+			break;
+		}
+		n++;
+	}
+
+	return n;
+}
+
+static void empty_heap(void **blocks, size_t n)
+{
+	while (n > 0) {
+		k_heap_free(&k_heap_test, blocks[--n]);
+	}
+}
+
+/**
+ * @brief Test the per-CPU block cache of k_heap
+ *
+ * @ingroup kernel_kheap_api_tests
+ *
+ * @details Verify that a freed small block is handed out again by the
+ * next allocation of the same size class, and that blocks held in the
+ * caches are given back to the heap when an allocation would otherwise
+ * fail.
+ *
+ * @see k_heap_alloc(), k_heap_free(), k_heap_cache_stats_get()
+ */
+ZTEST(k_heap_api, test_k_heap_cpu_cache)
+{
+	if (!IS_ENABLED(CONFIG_K_HEAP_CPU_CACHE)) {
+		ztest_test_skip();
+	}
+
+	static void *blocks[HEAP_SIZE / 16];
+	size_t n;
+	char *p, *q;
+
+	p = k_heap_alloc(&k_heap_test, 20, K_NO_WAIT);
+	zassert_not_null(p, "k_heap_alloc operation failed");
+	k_heap_free(&k_heap_test, p);
+
+	q = k_heap_alloc(&k_heap_test, 24, K_NO_WAIT);
+	zassert_equal_ptr(p, q, "cached block was not reused");
+	k_heap_free(&k_heap_test, q);
+
+	/* Leave the caches full of small blocks, then exhaust the heap
+	 * with a different size class: the cached blocks must be given
+	 * back rather than lost.
+	 */
+	n = fill_heap(blocks, ARRAY_SIZE(blocks), 16);
+	zassert_true(n < ARRAY_SIZE(blocks), "heap was not exhausted");
+	empty_heap(blocks, n);
+
+	n = fill_heap(blocks, ARRAY_SIZE(blocks), 100);
+	zassert_true(n > 0, "k_heap_alloc operation failed");
+	empty_heap(blocks, n);
+
+	p = k_heap_alloc(&k_heap_test, ALLOC_SIZE_1, K_NO_WAIT);
+	zassert_not_null(p, "cached blocks were not returned to the heap");
+	k_heap_free(&k_heap_test, p);
+
+#if defined(CONFIG_K_HEAP_CPU_CACHE) && defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
+	struct k_heap_cache_stats stats;
+
+	zassert_ok(k_heap_cache_stats_get(&k_heap_test, &stats));
+	zassert_true(stats.hits > 0U, "no cache hits recorded");
+	zassert_true(stats.frees > 0U, "no cached frees recorded");
+	zassert_true(stats.drains > 0U, "no cache drains recorded");
+	zassert_equal(k_heap_cache_stats_get(NULL, &stats), -EINVAL);
+#endif
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define MANY_LEN 4
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+extern k_tid_t tids[2];
+extern struct k_msgq msgq;
+static ZTEST_BMEM char __aligned(4) tbuffer[MSG_SIZE * MANY_LEN];
+static ZTEST_DMEM uint32_t data[] = { 1, 2, 3, 4, 5, 6, 7 };
+static ZTEST_BMEM uint32_t rdata[8];
+static ZTEST_BMEM int thread_ret;
+
+static void put_get_many(struct k_msgq *q)
+{
+	uint32_t msg;
+
+	/* move the read and write pointers so the batches wrap around */
+	for (int i = 0; i < 3; i++) {
+		zassert_equal(k_msgq_put(q, &data[i], K_NO_WAIT), 0);
+	}
+	for (int i = 0; i < 2; i++) {
+		zassert_equal(k_msgq_get(q, &msg, K_NO_WAIT), 0);
+		zassert_equal(msg, data[i]);
+	}
+
+	/**TESTPOINT: put as many messages as fit */
+	zassert_equal(k_msgq_put_many(q, &data[3], 4, K_NO_WAIT), 3);
+	zassert_equal(k_msgq_num_free_get(q), 0);
+	zassert_equal(k_msgq_put_many(q, &data[6], 1, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_put_many(q, &data[6], 0, K_NO_WAIT), 0);
+
+	/**TESTPOINT: get all messages in order */
+	zassert_equal(k_msgq_get_many(q, rdata, ARRAY_SIZE(rdata), K_NO_WAIT), MANY_LEN);
+	for (int i = 0; i < MANY_LEN; i++) {
+		zassert_equal(rdata[i], data[i + 2]);
+	}
+
+	zassert_equal(k_msgq_get_many(q, rdata, ARRAY_SIZE(rdata), K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get_many(q, rdata, ARRAY_SIZE(rdata), TIMEOUT), -EAGAIN);
+	zassert_equal(k_msgq_get_many(q, rdata, 0, K_NO_WAIT), 0);
+}
+
+static void put_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret = k_msgq_put((struct k_msgq *)p1, &data[6], K_FOREVER);
+}
+
+static void get_many_entry(void *p1, void *p2, void *p3)
+{
+	thread_ret = k_msgq_get_many((struct k_msgq *)p1, rdata, ARRAY_SIZE(rdata), K_FOREVER);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test moving several messages with one call
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api, test_msgq_put_get_many)
+{
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MANY_LEN);
+
+	put_get_many(&msgq);
+}
+
+#ifdef CONFIG_USERSPACE
+/**
+ * @brief Test moving several messages with one call from user mode
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST_USER(msgq_api, test_msgq_user_put_get_many)
+{
+	struct k_msgq *q;
+
+	q = k_object_alloc(K_OBJ_MSGQ);
+	zassert_not_null(q, "couldn't alloc message queue");
+	zassert_false(k_msgq_alloc_init(q, MSG_SIZE, MANY_LEN));
+
+	put_get_many(q);
+}
+#endif
+
+/**
+ * @brief Test a batch get refills the queue from a waiting writer
+ * @see k_msgq_get_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_get_many_pending_writer)
+{
+	uint32_t msg;
+
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MANY_LEN);
+	zassert_equal(k_msgq_put_many(&msgq, data, MANY_LEN, K_NO_WAIT), MANY_LEN);
+
+	thread_ret = 1;
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE,
+				  put_entry, &msgq, NULL, NULL,
+				  K_PRIO_PREEMPT(0), K_USER | K_INHERIT_PERMS,
+				  K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	/**TESTPOINT: the writer's message lands behind the batch */
+	zassert_equal(k_msgq_get_many(&msgq, rdata, ARRAY_SIZE(rdata), K_NO_WAIT), MANY_LEN);
+	k_thread_join(tids[0], K_FOREVER);
+	tids[0] = NULL;
+	zassert_equal(thread_ret, 0);
+
+	zassert_equal(k_msgq_get(&msgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(msg, data[6]);
+}
+
+/**
+ * @brief Test a batch put serves a waiting reader first
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_put_many_pending_reader)
+{
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MANY_LEN);
+
+	thread_ret = 0;
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE,
+				  get_many_entry, &msgq, NULL, NULL,
+				  K_PRIO_PREEMPT(0), K_USER | K_INHERIT_PERMS,
+				  K_NO_WAIT);
+	k_msleep(TIMEOUT_MS >> 1);
+
+	/**TESTPOINT: a blocked batch get receives exactly one message */
+	zassert_equal(k_msgq_put_many(&msgq, data, 3, K_NO_WAIT), 3);
+	k_thread_join(tids[0], K_FOREVER);
+	tids[0] = NULL;
+	zassert_equal(thread_ret, 1);
+	zassert_equal(rdata[0], data[0]);
+	zassert_equal(k_msgq_num_used_get(&msgq), 2);
+}
+
+/**
+ * @}
+ */
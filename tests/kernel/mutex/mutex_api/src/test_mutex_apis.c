@@ -469,6 +469,66 @@ ZTEST(mutex_api_1cpu, test_mutex_timeout_race_during_priority_inversion)
 	k_mutex_unlock(&tmutex);
 }
 
+#ifdef CONFIG_MUTEX_ADAPTIVE_SPIN
+static atomic_t spin_waiting;
+
+static void tThread_spin_waiter(void *p1, void *p2, void *p3)
+{
+	struct k_mutex *mutex = (struct k_mutex *)p1;
+
+	(void)atomic_set(&spin_waiting, 1);
+	zassert_ok(k_mutex_lock(mutex, K_FOREVER));
+	k_mutex_unlock(mutex);
+}
+
+/**
+ * @brief Test a thread spins on a mutex held by a thread running elsewhere
+ *
+ * - The current thread locks the mutex and keeps running on its CPU.
+ * - A higher priority thread locks the mutex on another CPU.
+ * - The current thread unlocks the mutex before the spinning time runs out.
+ *
+ * The waiting thread must not pend, which would raise the priority of the
+ * current thread through priority inheritance.
+ *
+ * @ingroup kernel_mutex_tests
+ *
+ * @see k_mutex_lock()
+ */
+ZTEST(mutex_api, test_mutex_adaptive_spin)
+{
+	int prio = k_thread_priority_get(k_current_get());
+
+	if (arch_num_cpus() < 2) {
+		ztest_test_skip();
+	}
+
+	/* Cooperative, so that the waiting thread runs on another CPU */
+	k_thread_priority_set(k_current_get(), K_PRIO_COOP(THREAD_MID_PRIORITY));
+
+	k_mutex_init(&tmutex);
+	zassert_ok(k_mutex_lock(&tmutex, K_FOREVER));
+
+	(void)atomic_set(&spin_waiting, 0);
+	k_thread_create(&tdata, tstack, STACK_SIZE, tThread_spin_waiter, &tmutex,
+			NULL, NULL, K_PRIO_COOP(THREAD_HIGH_PRIORITY), 0, K_NO_WAIT);
+
+	while (atomic_get(&spin_waiting) == 0) {
+		arch_spin_relax();
+	}
+
+	k_busy_wait(CONFIG_MUTEX_ADAPTIVE_SPIN_US / 2);
+
+	zassert_equal(k_thread_priority_get(k_current_get()),
+		      K_PRIO_COOP(THREAD_MID_PRIORITY), "waiting thread pended");
+
+	k_mutex_unlock(&tmutex);
+	k_thread_join(&tdata, K_FOREVER);
+
+	k_thread_priority_set(k_current_get(), prio);
+}
+#endif /* CONFIG_MUTEX_ADAPTIVE_SPIN */
+
 static void *mutex_api_tests_setup(void)
 {
 #ifdef CONFIG_USERSPACE
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define SET_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define SET_NUM_SEMS 8
+
+static struct k_poll_set set;
+static struct k_sem set_sems[SET_NUM_SEMS];
+static struct k_poll_event set_events[SET_NUM_SEMS];
+static struct k_poll_signal set_signal;
+static struct k_poll_event set_signal_event;
+
+static struct k_thread set_thread;
+static K_THREAD_STACK_DEFINE(set_stack, SET_STACK_SIZE);
+
+static void set_init(void)
+{
+	k_poll_set_init(&set);
+
+	for (int i = 0; i < SET_NUM_SEMS; i++) {
+		k_sem_init(&set_sems[i], 0, 1);
+		k_poll_event_init(&set_events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &set_sems[i]);
+		set_events[i].tag = i;
+		k_poll_set_add(&set, &set_events[i]);
+	}
+}
+
+static void set_fini(void)
+{
+	for (int i = 0; i < SET_NUM_SEMS; i++) {
+		k_poll_set_remove(&set, &set_events[i]);
+	}
+}
+
+static void set_give_entry(void *p1, void *p2, void *p3)
+{
+	k_msleep(50);
+	k_poll_signal_raise(&set_signal, 0x1ee7);
+}
+
+/**
+ * @brief Test a poll set only returns the events that are ready
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_init(), k_poll_set_add(), k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_ready)
+{
+	struct k_poll_event *ready[SET_NUM_SEMS];
+
+	set_init();
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), -EAGAIN);
+
+	k_sem_give(&set_sems[5]);
+	k_sem_give(&set_sems[2]);
+
+	/* events come out in the order they became ready */
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), 2);
+	zassert_equal(ready[0]->tag, 5);
+	zassert_equal(ready[1]->tag, 2);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE);
+
+	/* still available, so reported again */
+	zassert_equal(k_poll_set_wait(&set, ready, 1, K_NO_WAIT), 1);
+	zassert_equal(ready[0]->tag, 5);
+	zassert_ok(k_sem_take(&set_sems[5], K_NO_WAIT));
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), 1);
+	zassert_equal(ready[0]->tag, 2);
+	zassert_ok(k_sem_take(&set_sems[2], K_NO_WAIT));
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_MSEC(10)), -EAGAIN);
+
+	/* removed events are not reported */
+	k_poll_set_remove(&set, &set_events[3]);
+	k_sem_give(&set_sems[3]);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), -EAGAIN);
+	k_poll_set_add(&set, &set_events[3]);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), 1);
+	zassert_equal(ready[0]->tag, 3);
+	zassert_ok(k_sem_take(&set_sems[3], K_NO_WAIT));
+
+	set_fini();
+}
+
+/**
+ * @brief Test waiting on a poll set wakes up when an event is signaled
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_wait)
+{
+	struct k_poll_event *ready[SET_NUM_SEMS];
+	k_tid_t tid;
+
+	set_init();
+
+	k_poll_signal_init(&set_signal);
+	k_poll_event_init(&set_signal_event, K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY,
+			  &set_signal);
+	k_poll_set_add(&set, &set_signal_event);
+
+	tid = k_thread_create(&set_thread, set_stack, K_THREAD_STACK_SIZEOF(set_stack),
+			      set_give_entry, NULL, NULL, NULL,
+			      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_MSEC(500)), 1);
+	zassert_equal_ptr(ready[0], &set_signal_event);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SIGNALED);
+
+	k_thread_join(tid, K_FOREVER);
+
+	k_poll_signal_reset(&set_signal);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT), -EAGAIN);
+
+	k_poll_set_remove(&set, &set_signal_event);
+	set_fini();
+}
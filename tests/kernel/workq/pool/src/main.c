@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/ztest.h>
+
+#define NUM_WORKERS 2
+#define NUM_ITEMS (NUM_WORKERS + 1)
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define WORK_PRIORITY K_PRIO_PREEMPT(1)
+#define SETTLE_MS 20
+#define DELAY_TIMEOUT K_MSEC(50)
+
+struct test_work {
+	struct k_work work;
+	struct k_sem release;
+	atomic_t active;
+	atomic_t runs;
+};
+
+static struct k_work_q pool;
+static K_THREAD_STACK_DEFINE(pool_stack, STACK_SIZE);
+static struct k_work_q_worker workers[NUM_WORKERS];
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, NUM_WORKERS, STACK_SIZE);
+
+static struct test_work items[NUM_ITEMS];
+static struct k_work_sync work_sync;
+
+/* Number of times a handler was entered while it was already running */
+static atomic_t reentered;
+
+static void test_handler(struct k_work *work)
+{
+	struct test_work *tw = CONTAINER_OF(work, struct test_work, work);
+
+	if (atomic_inc(&tw->active) != 0) {
+		atomic_inc(&reentered);
+	}
+
+	k_sem_take(&tw->release, K_FOREVER);
+
+	atomic_inc(&tw->runs);
+	atomic_dec(&tw->active);
+}
+
+static int release_count;
+
+static void release_cb(struct k_timer *timer)
+{
+	for (int i = 0; i < release_count; i++) {
+		k_sem_give(&items[0].release);
+	}
+}
+
+static K_TIMER_DEFINE(release_timer, release_cb, NULL);
+
+/* Submit the first item, and submit it again once it is running */
+static void submit_running_and_queued(void)
+{
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0].work), 1);
+	k_msleep(SETTLE_MS);
+	zassert_equal(k_work_busy_get(&items[0].work), K_WORK_RUNNING);
+
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0].work), 2);
+	k_msleep(SETTLE_MS);
+
+	/* Idle workers must leave the running item alone */
+	zassert_equal(k_work_busy_get(&items[0].work), K_WORK_RUNNING | K_WORK_QUEUED);
+}
+
+static void *pool_setup(void)
+{
+	k_work_queue_start(&pool, pool_stack, K_THREAD_STACK_SIZEOF(pool_stack),
+			   WORK_PRIORITY, NULL);
+
+	for (int i = 0; i < NUM_WORKERS; i++) {
+		k_work_queue_add_worker(&pool, &workers[i], worker_stacks[i],
+					K_THREAD_STACK_SIZEOF(worker_stacks[i]), -1);
+	}
+
+	return NULL;
+}
+
+static void pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_init(&items[i].work, test_handler);
+		k_sem_init(&items[i].release, 0, K_SEM_MAX_LIMIT);
+		atomic_clear(&items[i].active);
+		atomic_clear(&items[i].runs);
+	}
+
+	atomic_clear(&reentered);
+}
+
+/**
+ * @brief Test the threads of a pool process distinct work items in parallel
+ *
+ * @see k_work_queue_add_worker()
+ */
+ZTEST(workq_pool, test_pool_parallel)
+{
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_submit_to_queue(&pool, &items[i].work), 1);
+	}
+
+	k_msleep(SETTLE_MS);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(k_work_busy_get(&items[i].work), K_WORK_RUNNING,
+			      "item %d not running", i);
+		k_sem_give(&items[i].release);
+	}
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_work_flush(&items[i].work, &work_sync);
+		zassert_equal(atomic_get(&items[i].runs), 1);
+	}
+}
+
+/**
+ * @brief Test a work item submitted while it runs is not run concurrently
+ *
+ * @see k_work_submit_to_queue()
+ */
+ZTEST(workq_pool, test_pool_resubmit_running)
+{
+	submit_running_and_queued();
+
+	k_sem_give(&items[0].release);
+	k_sem_give(&items[0].release);
+
+	k_work_flush(&items[0].work, &work_sync);
+	zassert_equal(atomic_get(&items[0].runs), 2);
+	zassert_equal(atomic_get(&reentered), 0);
+}
+
+/**
+ * @brief Test flushing waits for both the running and the queued instance
+ *
+ * @see k_work_flush()
+ */
+ZTEST(workq_pool, test_pool_flush)
+{
+	submit_running_and_queued();
+
+	release_count = 2;
+	k_timer_start(&release_timer, DELAY_TIMEOUT, K_NO_WAIT);
+
+	zassert_true(k_work_flush(&items[0].work, &work_sync));
+	zassert_equal(atomic_get(&items[0].runs), 2);
+	zassert_equal(k_work_busy_get(&items[0].work), 0);
+	zassert_false(k_work_flush(&items[0].work, &work_sync));
+}
+
+/**
+ * @brief Test cancelling removes the queued instance of a running item
+ *
+ * @see k_work_cancel(), k_work_cancel_sync()
+ */
+ZTEST(workq_pool, test_pool_cancel)
+{
+	submit_running_and_queued();
+
+	zassert_equal(k_work_cancel(&items[0].work), K_WORK_RUNNING | K_WORK_CANCELING);
+
+	release_count = 1;
+	k_timer_start(&release_timer, DELAY_TIMEOUT, K_NO_WAIT);
+
+	zassert_true(k_work_cancel_sync(&items[0].work, &work_sync));
+	zassert_equal(atomic_get(&items[0].runs), 1);
+	zassert_equal(k_work_busy_get(&items[0].work), 0);
+}
+
+/**
+ * @brief Test draining waits for the work items of all the threads
+ *
+ * @see k_work_queue_drain(), k_work_queue_unplug()
+ */
+ZTEST(workq_pool, test_pool_drain)
+{
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		k_sem_give(&items[i].release);
+		zassert_equal(k_work_submit_to_queue(&pool, &items[i].work), 1);
+	}
+
+	zassert_true(k_work_queue_drain(&pool, true) >= 0);
+
+	for (int i = 0; i < NUM_ITEMS; i++) {
+		zassert_equal(atomic_get(&items[i].runs), 1);
+	}
+
+	zassert_equal(k_work_submit_to_queue(&pool, &items[0].work), -EBUSY);
+	zassert_ok(k_work_queue_unplug(&pool));
+}
+
+/**
+ * @brief Test the system work queue threads process work items in parallel
+ *
+ * @see k_work_submit()
+ */
+ZTEST(workq_pool, test_pool_system_queue)
+{
+	if (CONFIG_SYSTEM_WORKQUEUE_WORKERS == 0) {
+		ztest_test_skip();
+	}
+
+	zassert_equal(k_work_submit(&items[0].work), 1);
+	zassert_equal(k_work_submit(&items[1].work), 1);
+	k_msleep(SETTLE_MS);
+
+	zassert_equal(k_work_busy_get(&items[0].work), K_WORK_RUNNING);
+	zassert_equal(k_work_busy_get(&items[1].work), K_WORK_RUNNING);
+
+	k_sem_give(&items[0].release);
+	k_sem_give(&items[1].release);
+	k_work_flush(&items[0].work, &work_sync);
+	k_work_flush(&items[1].work, &work_sync);
+}
+
+ZTEST_SUITE(workq_pool, NULL, pool_setup, pool_before, NULL, NULL);
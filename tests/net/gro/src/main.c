@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "connection.h"
+#include "ipv4.h"
+#include "net_gro.h"
+#include "net_private.h"
+#include "tcp_private.h"
+
+#define MY_PORT 4242
+#define PEER_PORT 4243
+#define HDR_LEN (NET_IPV4H_LEN + NET_TCPH_LEN)
+#define SEG_LEN 100
+
+/* Close to the wrap around, so that merging has to handle it */
+#define PEER_SEQ 0xffffff00U
+#define MY_SEQ 1000U
+
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr peer_addr = { { { 192, 0, 2, 2 } } };
+static struct in_addr other_addr = { { { 192, 0, 2, 3 } } };
+
+static struct net_if *iface;
+static struct net_gro gro;
+
+static uint8_t payload[2 * CONFIG_NET_GRO_MAX_SIZE];
+static uint8_t rx_buf[CONFIG_NET_GRO_MAX_SIZE];
+
+/* Segments as seen by the TCP layer */
+struct delivery {
+	uint16_t src_port;
+	uint32_t offset;
+	uint32_t len;
+	uint8_t flags;
+};
+
+static struct delivery delivered[8];
+static int delivered_count;
+
+static uint8_t net_gro_dummy_data;
+
+static void net_gro_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[6] = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_DUMMY);
+}
+
+static int net_gro_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static struct dummy_api net_gro_if_api = {
+	.iface_api.init = net_gro_iface_init,
+	.send = net_gro_send,
+};
+
+NET_DEVICE_INIT(net_gro_test, "net_gro_test", NULL, NULL, &net_gro_dummy_data, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &net_gro_if_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), NET_IPV4_MTU);
+
+static enum net_verdict tcp_received(struct net_conn *conn, struct net_pkt *pkt,
+				     union net_ip_header *ip_hdr,
+				     union net_proto_header *proto_hdr, void *user_data)
+{
+	struct delivery *d;
+
+	ARG_UNUSED(conn);
+	ARG_UNUSED(user_data);
+
+	zassert_true(delivered_count < ARRAY_SIZE(delivered), "Too many packets");
+
+	d = &delivered[delivered_count++];
+	d->src_port = ntohs(proto_hdr->tcp->src_port);
+	d->offset = sys_get_be32(proto_hdr->tcp->seq) - PEER_SEQ;
+	d->len = ntohs(ip_hdr->ipv4->len) - HDR_LEN;
+	d->flags = proto_hdr->tcp->flags;
+
+	zassert_equal(net_pkt_get_len(pkt), HDR_LEN + d->len, "Invalid packet length");
+	zassert_true(d->len <= sizeof(rx_buf), "Packet too long");
+
+	/* The merged payload must be the segments in sequence order */
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_pkt_skip(pkt, HDR_LEN));
+	zassert_ok(net_pkt_read(pkt, rx_buf, d->len));
+	zassert_mem_equal(rx_buf, &payload[d->offset], d->len, "Invalid payload");
+
+	net_pkt_unref(pkt);
+
+	return NET_OK;
+}
+
+static struct net_pkt *prepare_segment(const struct in_addr *dst, uint16_t src_port,
+				       uint32_t offset, size_t len, uint8_t flags)
+{
+	struct net_tcp_hdr hdr = {
+		.src_port = htons(src_port),
+		.dst_port = htons(MY_PORT),
+		.offset = (NET_TCPH_LEN / 4U) << 4,
+		.flags = flags,
+	};
+	struct net_pkt *pkt;
+
+	sys_put_be32(PEER_SEQ + offset, hdr.seq);
+	sys_put_be32(MY_SEQ, hdr.ack);
+	sys_put_be16(8192U, hdr.wnd);
+
+	pkt = net_pkt_rx_alloc_with_buffer(iface, NET_TCPH_LEN + len, AF_INET,
+					   IPPROTO_TCP, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate packet");
+
+	zassert_ok(net_ipv4_create(pkt, &peer_addr, dst));
+	zassert_ok(net_pkt_write(pkt, &hdr, NET_TCPH_LEN));
+	zassert_ok(net_pkt_write(pkt, &payload[offset], len));
+
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_ipv4_finalize(pkt, IPPROTO_TCP));
+	net_pkt_cursor_init(pkt);
+
+	return pkt;
+}
+
+/* Does what net_core does with a packet received by an RX thread */
+static enum net_verdict gro_input(uint16_t src_port, uint32_t offset, size_t len,
+				  uint8_t flags)
+{
+	struct net_pkt *pkt = prepare_segment(&my_addr, src_port, offset, len, flags);
+	enum net_verdict verdict;
+
+	verdict = net_gro_receive(&gro, pkt);
+	if (verdict == NET_CONTINUE) {
+		net_gro_deliver(pkt);
+	}
+
+	return verdict;
+}
+
+static void check_delivery(int i, uint16_t src_port, uint32_t offset, uint32_t len)
+{
+	zassert_true(i < delivered_count, "Packet %d not delivered", i);
+	zassert_equal(delivered[i].src_port, src_port, "Packet %d of wrong flow", i);
+	zassert_equal(delivered[i].offset, offset, "Packet %d at offset %u", i,
+		      delivered[i].offset);
+	zassert_equal(delivered[i].len, len, "Packet %d of length %u", i, delivered[i].len);
+}
+
+static void *gro_setup(void)
+{
+	static struct net_conn_handle *handle;
+	struct net_if_addr *ifaddr;
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(iface, "No dummy interface");
+
+	ifaddr = net_if_ipv4_addr_add(iface, &my_addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add IPv4 address");
+
+	zassert_ok(net_conn_register(IPPROTO_TCP, AF_INET, NULL, NULL, 0, MY_PORT, NULL,
+				     tcp_received, NULL, &handle));
+
+	for (size_t i = 0; i < sizeof(payload); i++) {
+		payload[i] = (uint8_t)(i * 7U);
+	}
+
+	return NULL;
+}
+
+static void gro_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(&gro, 0, sizeof(gro));
+	delivered_count = 0;
+}
+
+static void gro_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Do not leak segments a failed test left behind */
+	net_gro_flush(&gro);
+}
+
+/**
+ * @brief Test back-to-back segments are merged into one packet
+ */
+ZTEST(net_gro, test_gro_in_order)
+{
+	for (uint32_t i = 0; i < 4; i++) {
+		zassert_equal(gro_input(PEER_PORT, i * SEG_LEN, SEG_LEN, ACK), NET_OK);
+	}
+
+	zassert_equal(delivered_count, 0, "Segments not held");
+
+	net_gro_flush(&gro);
+
+	zassert_equal(delivered_count, 1, "Segments not merged");
+	check_delivery(0, PEER_PORT, 0, 4 * SEG_LEN);
+
+	/* PSH and a short segment both end the merged packet right away */
+	zassert_equal(gro_input(PEER_PORT, 4 * SEG_LEN, SEG_LEN, ACK), NET_OK);
+	zassert_equal(gro_input(PEER_PORT, 5 * SEG_LEN, SEG_LEN, ACK | PSH), NET_OK);
+
+	zassert_equal(delivered_count, 2, "PSH segment not flushed");
+	check_delivery(1, PEER_PORT, 4 * SEG_LEN, 2 * SEG_LEN);
+	zassert_true(delivered[1].flags & PSH, "PSH lost");
+
+	zassert_equal(gro_input(PEER_PORT, 6 * SEG_LEN, SEG_LEN, ACK), NET_OK);
+	zassert_equal(gro_input(PEER_PORT, 7 * SEG_LEN, SEG_LEN / 2, ACK), NET_OK);
+
+	zassert_equal(delivered_count, 3, "Short segment not flushed");
+	check_delivery(2, PEER_PORT, 6 * SEG_LEN, SEG_LEN + SEG_LEN / 2);
+}
+
+/**
+ * @brief Test segments that do not follow the held ones are not merged
+ */
+ZTEST(net_gro, test_gro_out_of_order)
+{
+	/* A gap flushes what was held and starts over */
+	zassert_equal(gro_input(PEER_PORT, 0, SEG_LEN, ACK), NET_OK);
+	zassert_equal(gro_input(PEER_PORT, 2 * SEG_LEN, SEG_LEN, ACK), NET_OK);
+
+	zassert_equal(delivered_count, 1, "Gap not flushed");
+	check_delivery(0, PEER_PORT, 0, SEG_LEN);
+
+	/* And so does a segment from before the held ones */
+	zassert_equal(gro_input(PEER_PORT, SEG_LEN, SEG_LEN, ACK), NET_OK);
+
+	zassert_equal(delivered_count, 2, "Out of order segment not flushed");
+	check_delivery(1, PEER_PORT, 2 * SEG_LEN, SEG_LEN);
+
+	/* A pure ACK is not merged, but must not overtake the held data */
+	zassert_equal(gro_input(PEER_PORT, 2 * SEG_LEN, 0, ACK), NET_CONTINUE);
+
+	zassert_equal(delivered_count, 4, "Held data not flushed before ACK");
+	check_delivery(2, PEER_PORT, SEG_LEN, SEG_LEN);
+	check_delivery(3, PEER_PORT, 2 * SEG_LEN, 0);
+}
+
+/**
+ * @brief Test merged packets stay within the size and segment limits
+ */
+ZTEST(net_gro, test_gro_limits)
+{
+	uint32_t seg_len = CONFIG_NET_GRO_MAX_SIZE / 3 - SEG_LEN / 4;
+	uint32_t segs = CONFIG_NET_GRO_MAX_SIZE / seg_len;
+	uint32_t offset = 0;
+
+	BUILD_ASSERT(CONFIG_NET_GRO_MAX_SEGS * 20 < CONFIG_NET_GRO_MAX_SIZE);
+
+	/* Flushed once another segment would not fit */
+	for (uint32_t i = 0; i < segs; i++) {
+		zassert_equal(delivered_count, 0, "Flushed after %u segments", i);
+		zassert_equal(gro_input(PEER_PORT, offset, seg_len, ACK), NET_OK);
+		offset += seg_len;
+	}
+
+	zassert_equal(delivered_count, 1, "Size limit not enforced");
+	check_delivery(0, PEER_PORT, 0, segs * seg_len);
+
+	/* Flushed once the segment count is reached */
+	for (uint32_t i = 0; i < CONFIG_NET_GRO_MAX_SEGS; i++) {
+		zassert_equal(delivered_count, 1, "Flushed after %u segments", i);
+		zassert_equal(gro_input(PEER_PORT, offset + i * 20U, 20U, ACK), NET_OK);
+	}
+
+	zassert_equal(delivered_count, 2, "Segment limit not enforced");
+	check_delivery(1, PEER_PORT, offset, CONFIG_NET_GRO_MAX_SEGS * 20U);
+}
+
+/**
+ * @brief Test a flow held for too long is flushed by the next packet
+ */
+ZTEST(net_gro, test_gro_timeout)
+{
+	zassert_equal(gro_input(PEER_PORT, 0, SEG_LEN, ACK), NET_OK);
+	zassert_equal(gro_input(PEER_PORT + 1, 0, SEG_LEN, ACK), NET_OK);
+
+	zassert_equal(delivered_count, 0, "Flows flushed too early");
+
+	k_busy_wait(2 * CONFIG_NET_GRO_TIMEOUT_US);
+
+	/* Any packet, here one of a third flow, flushes the expired ones */
+	zassert_equal(gro_input(PEER_PORT + 2, 0, SEG_LEN, ACK), NET_OK);
+
+	zassert_equal(delivered_count, 2, "Expired flows not flushed");
+	check_delivery(0, PEER_PORT, 0, SEG_LEN);
+	check_delivery(1, PEER_PORT + 1, 0, SEG_LEN);
+
+	net_gro_flush(&gro);
+
+	zassert_equal(delivered_count, 3, "Flow not flushed");
+	check_delivery(2, PEER_PORT + 2, 0, SEG_LEN);
+}
+
+/**
+ * @brief Test packets not addressed to this host are left alone
+ */
+ZTEST(net_gro, test_gro_not_local)
+{
+	for (uint32_t i = 0; i < 2; i++) {
+		struct net_pkt *pkt = prepare_segment(&other_addr, PEER_PORT, i * SEG_LEN,
+						      SEG_LEN, ACK);
+
+		zassert_equal(net_gro_receive(&gro, pkt), NET_CONTINUE,
+			      "Forwarded packet taken over");
+		zassert_false(net_pkt_is_gro(pkt), "Forwarded packet modified");
+
+		net_pkt_unref(pkt);
+	}
+
+	ARRAY_FOR_EACH(gro.flows, i) {
+		zassert_is_null(gro.flows[i].head, "Forwarded packet held");
+	}
+}
+
+ZTEST_SUITE(net_gro, NULL, gro_setup, gro_before, gro_after, NULL);
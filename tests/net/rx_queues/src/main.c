@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/ztest.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "net_private.h"
+#include "net_stats.h"
+
+#define NUM_FLOWS 32
+#define FRAG_LEN 16
+#define UDP_HDR_LEN 8
+
+static struct in_addr src_addr = { { { 192, 0, 2, 2 } } };
+static struct in_addr dst_addr = { { { 192, 0, 2, 1 } } };
+
+static struct net_if *iface;
+
+static uint8_t rx_queues_dummy_data;
+
+static void rx_queues_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[6] = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_DUMMY);
+}
+
+static int rx_queues_send(const struct device *dev, struct net_pkt *pkt)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static struct dummy_api rx_queues_if_api = {
+	.iface_api.init = rx_queues_iface_init,
+	.send = rx_queues_send,
+};
+
+NET_DEVICE_INIT(rx_queues_test, "rx_queues_test", NULL, NULL, &rx_queues_dummy_data, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &rx_queues_if_api, DUMMY_L2,
+		NET_L2_GET_CTX_TYPE(DUMMY_L2), NET_IPV4_MTU);
+
+/* Build an IPv4 UDP packet, or a fragment of one when @p flags is not 0.
+ * Only the first fragment carries the UDP header, the payload of the others
+ * is filled with @p port so that it would change the hash if parsed as ports.
+ */
+static struct net_pkt *prepare_pkt(uint16_t id, uint16_t flags, uint16_t port)
+{
+	uint8_t data[NET_IPV4H_LEN + FRAG_LEN] = { 0 };
+	struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)data;
+	struct net_pkt *pkt;
+
+	hdr->vhl = 0x45;
+	sys_put_be16(sizeof(data), hdr->len);
+	sys_put_be16(id, hdr->id);
+	sys_put_be16(flags, hdr->offset);
+	hdr->ttl = 64U;
+	hdr->proto = IPPROTO_UDP;
+	memcpy(hdr->src, &src_addr, sizeof(src_addr));
+	memcpy(hdr->dst, &dst_addr, sizeof(dst_addr));
+
+	if ((flags & NET_IPV4_FRAGH_OFFSET_MASK) == 0U) {
+		sys_put_be16(port, &data[NET_IPV4H_LEN]);
+		sys_put_be16(4242U, &data[NET_IPV4H_LEN + 2]);
+		sys_put_be16(FRAG_LEN, &data[NET_IPV4H_LEN + 4]);
+	} else {
+		for (int i = NET_IPV4H_LEN; i < sizeof(data); i += sizeof(port)) {
+			sys_put_be16(port, &data[i]);
+		}
+	}
+
+	pkt = net_pkt_rx_alloc_with_buffer(iface, sizeof(data), AF_UNSPEC, 0, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate packet");
+	zassert_ok(net_pkt_write(pkt, data, sizeof(data)));
+	net_pkt_cursor_init(pkt);
+
+	return pkt;
+}
+
+/* Receive a packet and find the queue it was steered to */
+static int rx_queue_of(struct net_pkt *pkt)
+{
+	net_stats_t before[NET_TC_RX_QUEUE_COUNT];
+
+	for (int q = 0; q < NET_TC_RX_QUEUE_COUNT; q++) {
+		before[q] = GET_STAT(iface, rx_queue[q].pkts);
+	}
+
+	zassert_ok(net_recv_data(iface, pkt));
+
+	for (int q = 0; q < NET_TC_RX_QUEUE_COUNT; q++) {
+		if (GET_STAT(iface, rx_queue[q].pkts) != before[q]) {
+			return q;
+		}
+	}
+
+	zassert_unreachable("Packet not queued");
+	return -1;
+}
+
+/**
+ * @brief Test the flows are spread over the queues
+ */
+ZTEST(net_rx_queues, test_rx_queues_flows)
+{
+	uint32_t used = 0U;
+
+	for (uint16_t port = 1; port <= NUM_FLOWS; port++) {
+		used |= BIT(rx_queue_of(prepare_pkt(port, 0U, port)));
+	}
+
+	zassert_true(POPCOUNT(used) > 1, "All flows steered to one queue");
+}
+
+/**
+ * @brief Test all fragments of a datagram are steered to the same queue
+ *
+ * The first fragment carries the ports but the others do not, so fragments
+ * must be steered on their addresses and protocol only.
+ */
+ZTEST(net_rx_queues, test_rx_queues_fragments)
+{
+	for (uint16_t port = 1; port <= NUM_FLOWS; port++) {
+		int first = rx_queue_of(prepare_pkt(port, NET_IPV4_MORE_FRAG_MASK, port));
+		int middle = rx_queue_of(prepare_pkt(port, NET_IPV4_MORE_FRAG_MASK |
+						     (FRAG_LEN / 8), port));
+		int last = rx_queue_of(prepare_pkt(port, 2 * FRAG_LEN / 8, port));
+
+		zassert_equal(first, middle, "Fragments of %u steered apart", port);
+		zassert_equal(first, last, "Fragments of %u steered apart", port);
+	}
+}
+
+static void *rx_queues_setup(void)
+{
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(iface, "No dummy interface");
+
+	return NULL;
+}
+
+ZTEST_SUITE(net_rx_queues, NULL, rx_queues_setup, NULL, NULL, NULL);
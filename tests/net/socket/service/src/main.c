@@ -52,6 +52,7 @@ static void tcp_server_handler(struct net_socket_service_event *pev)
 NET_SOCKET_SERVICE_SYNC_DEFINE(udp_service_sync, server_handler, 2);
 NET_SOCKET_SERVICE_SYNC_DEFINE(tcp_service_small_sync, tcp_server_handler, 1);
 NET_SOCKET_SERVICE_SYNC_DEFINE_STATIC(tcp_service_sync, tcp_server_handler, 2);
+NET_SOCKET_SERVICE_SYNC_DEFINE_STATIC(reuse_service_sync, server_handler, 1);
 
 
 void run_test_service(const struct net_socket_service_desc *udp_service,
@@ -180,4 +181,71 @@ ZTEST(net_socket_service, test_service_sync)
 			 &tcp_service_sync);
 }
 
+ZTEST(net_socket_service, test_service_fd_reuse)
+{
+	int ret;
+	int c_sock;
+	int s_sock;
+	int s_sock_new;
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	ssize_t len;
+	char buf[10];
+	struct zsock_pollfd sock[1] = {
+		[0] = { .fd = -1, .events = ZSOCK_POLLIN },
+	};
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	sock[0].fd = s_sock;
+	ret = net_socket_service_register(&udp_service_sync, sock, ARRAY_SIZE(sock), NULL);
+	zassert_equal(ret, 0, "Cannot register udp service (%d)", ret);
+
+	/* Closed while registered, the descriptor is reused by the next socket */
+	ret = close(s_sock);
+	zassert_equal(ret, 0, "close failed");
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock_new, &s_addr);
+	if (s_sock_new != s_sock) {
+		(void)net_socket_service_unregister(&udp_service_sync);
+		(void)close(s_sock_new);
+		ztest_test_skip();
+	}
+
+	sock[0].fd = s_sock_new;
+	ret = net_socket_service_register(&reuse_service_sync, sock, ARRAY_SIZE(sock), NULL);
+	zassert_equal(ret, 0, "Cannot register reuse service (%d)", ret);
+
+	/* Must not remove the watch of the socket now using the descriptor */
+	ret = net_socket_service_unregister(&udp_service_sync);
+	zassert_equal(ret, 0, "Cannot unregister udp service (%d)", ret);
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+
+	ret = bind(s_sock_new, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(ret, 0, "bind failed");
+
+	ret = connect(c_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(ret, 0, "connect failed");
+
+	len = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid send len");
+
+	if (k_sem_take(&wait_data, K_MSEC(WAIT_TIME))) {
+		zassert_true(0, "Timeout while waiting callback");
+	}
+
+	len = recv(s_sock_new, BUF_AND_SIZE(buf), 0);
+	zassert_equal(len, STRLEN(TEST_STR_SMALL), "invalid recv len");
+
+	ret = net_socket_service_unregister(&reuse_service_sync);
+	zassert_equal(ret, 0, "Cannot unregister reuse service (%d)", ret);
+
+	ret = close(c_sock);
+	zassert_equal(ret, 0, "close failed");
+
+	ret = close(s_sock_new);
+	zassert_equal(ret, 0, "close failed");
+}
+
 ZTEST_SUITE(net_socket_service, NULL, NULL, NULL, NULL, NULL);
@@ -262,6 +262,61 @@ ZTEST_USER(net_socket_tcp, test_v4_send_recv)
 	k_sleep(TCP_TEARDOWN_TIMEOUT);
 }
 
+ZTEST(net_socket_tcp, test_v4_send_recv_zc)
+{
+#if defined(CONFIG_NET_SOCKETS_RECV_ZC)
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	char buf[sizeof(TEST_STR_SMALL)];
+	size_t received = 0;
+	struct net_buf *frags;
+	ssize_t ret;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_send(c_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0);
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+
+	/* The data may arrive in several segments */
+	while (received < strlen(TEST_STR_SMALL)) {
+		ret = zsock_recvfrom_zc(new_sock, &frags, 0, NULL, NULL);
+		zassert_true(ret > 0, "recvfrom_zc failed (%d)", errno);
+		zassert_equal(net_buf_frags_len(frags), ret, "wrong chain length");
+		zassert_true(received + ret <= strlen(TEST_STR_SMALL), "too much data");
+
+		net_buf_linearize(buf + received, sizeof(buf) - received, frags, 0, ret);
+		net_buf_unref(frags);
+		received += ret;
+	}
+
+	zassert_mem_equal(buf, TEST_STR_SMALL, strlen(TEST_STR_SMALL), "wrong data");
+
+	test_close(c_sock);
+
+	ret = zsock_recvfrom_zc(new_sock, &frags, 0, NULL, NULL);
+	zassert_equal(ret, 0, "no end of stream (%d)", errno);
+	zassert_is_null(frags, "unexpected fragments");
+
+	test_close(new_sock);
+	test_close(s_sock);
+
+	k_sleep(TCP_TEARDOWN_TIMEOUT);
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST_USER(net_socket_tcp, test_v6_send_recv)
 {
 	/* Test if send() and recv() work on a ipv6 stream socket. */
@@ -2430,6 +2485,58 @@ ZTEST(net_socket_tcp, test_so_keepalive)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_tcp_congestion)
+{
+	struct sockaddr_in bind_addr4;
+	char name[16];
+	socklen_t optlen = sizeof(name);
+	int sock, ret;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+		ztest_test_skip();
+	}
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &bind_addr4);
+
+	ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_str_equal(name, IS_ENABLED(CONFIG_NET_TCP_CC_DEFAULT_CUBIC) ?
+			  "cubic" : "reno", "getsockopt got invalid value");
+	zassert_equal(optlen, strlen(name) + 1, "getsockopt got invalid size");
+
+	ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "foo", strlen("foo"));
+	zassert_equal(ret, -1, "setsockopt should fail");
+	zassert_equal(errno, ENOENT, "setsockopt got invalid errno (%d)", errno);
+
+	ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "reno-with-a-long-name",
+			       strlen("reno-with-a-long-name"));
+	zassert_equal(ret, -1, "setsockopt should fail");
+	zassert_equal(errno, EINVAL, "setsockopt got invalid errno (%d)", errno);
+
+	ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "reno", strlen("reno"));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+	optlen = sizeof(name);
+	ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_str_equal(name, "reno", "getsockopt got invalid value");
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CC_CUBIC)) {
+		ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION,
+				       "cubic", sizeof("cubic"));
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+		optlen = sizeof(name);
+		ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+		zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+		zassert_str_equal(name, "cubic", "getsockopt got invalid value");
+	}
+
+	test_close(sock);
+
+	test_context_cleanup();
+}
+
 ZTEST(net_socket_tcp, test_keepalive_timeout)
 {
 	struct sockaddr_in c_saddr, s_saddr;
@@ -3108,6 +3108,139 @@ ZTEST(net_socket_udp, test_40_clamp_udp_tcp_port_range)
 #endif
 }
 
+#define MMSG_COUNT 4
+
+static ZTEST_BMEM char mmsg_rx_buf[MMSG_COUNT][16];
+
+ZTEST_USER(net_socket_udp, test_41_v4_sendmmsg_recvmmsg)
+{
+	static const char * const payload[MMSG_COUNT] = {
+		"one", "two", "three", "four",
+	};
+	struct iovec tx_iov[MMSG_COUNT];
+	struct iovec rx_iov[MMSG_COUNT];
+	struct mmsghdr tx_msg[MMSG_COUNT] = { 0 };
+	struct mmsghdr rx_msg[MMSG_COUNT] = { 0 };
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	int client_sock;
+	int server_sock;
+	int rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	rv = zsock_connect(client_sock, (struct sockaddr *)&server_addr,
+			   sizeof(server_addr));
+	zassert_equal(rv, 0, "connect failed");
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		tx_iov[i].iov_base = (void *)payload[i];
+		tx_iov[i].iov_len = strlen(payload[i]);
+		tx_msg[i].msg_hdr.msg_iov = &tx_iov[i];
+		tx_msg[i].msg_hdr.msg_iovlen = 1;
+
+		rx_iov[i].iov_base = mmsg_rx_buf[i];
+		rx_iov[i].iov_len = sizeof(mmsg_rx_buf[i]);
+		rx_msg[i].msg_hdr.msg_iov = &rx_iov[i];
+		rx_msg[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	rv = zsock_sendmmsg(client_sock, tx_msg, MMSG_COUNT, 0);
+	zassert_equal(rv, MMSG_COUNT, "sendmmsg failed (%d)", errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(tx_msg[i].msg_len, strlen(payload[i]),
+			      "wrong sent length");
+	}
+
+	/* Only the first receive may block, the rest is what is queued */
+	rv = zsock_recvmmsg(server_sock, rx_msg, MMSG_COUNT,
+			    ZSOCK_MSG_WAITFORONE);
+	zassert_true(rv >= 1, "recvmmsg failed (%d)", errno);
+
+	for (int i = 0; i < rv; i++) {
+		zassert_equal(rx_msg[i].msg_len, strlen(payload[i]),
+			      "wrong received length");
+		zassert_mem_equal(mmsg_rx_buf[i], payload[i], strlen(payload[i]),
+				  "wrong data");
+	}
+
+	/* Nothing left: a non-blocking batch receive reports EAGAIN */
+	if (rv == MMSG_COUNT) {
+		rv = zsock_recvmmsg(server_sock, rx_msg, MMSG_COUNT,
+				    ZSOCK_MSG_DONTWAIT);
+		zassert_equal(rv, -1, "recvmmsg should fail");
+		zassert_equal(errno, EAGAIN, "wrong errno (%d)", errno);
+	}
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_42_v4_recvfrom_zc)
+{
+#if defined(CONFIG_NET_SOCKETS_RECV_ZC)
+	static const char payload[] = "zero-copy payload";
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in src_addr;
+	socklen_t addrlen = sizeof(src_addr);
+	struct net_buf *frags;
+	char buf[sizeof(payload)];
+	int client_sock;
+	int server_sock;
+	ssize_t rv;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock, (struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "bind failed");
+
+	rv = zsock_sendto(client_sock, payload, sizeof(payload), 0,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, sizeof(payload), "sendto failed (%d)", errno);
+
+	rv = zsock_recvfrom_zc(server_sock, &frags, 0,
+			       (struct sockaddr *)&src_addr, &addrlen);
+	zassert_equal(rv, sizeof(payload), "recvfrom_zc failed (%d)", errno);
+	zassert_not_null(frags, "no fragments");
+	zassert_equal(net_buf_frags_len(frags), sizeof(payload), "wrong chain length");
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+	zassert_equal(src_addr.sin_family, AF_INET, "wrong source family");
+
+	net_buf_linearize(buf, sizeof(buf), frags, 0, sizeof(buf));
+	zassert_mem_equal(buf, payload, sizeof(payload), "wrong data");
+	net_buf_unref(frags);
+
+	/* Nothing left: a non-blocking receive reports EAGAIN */
+	rv = zsock_recvfrom_zc(server_sock, &frags, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(rv, -1, "recvfrom_zc should fail");
+	zassert_equal(errno, EAGAIN, "wrong errno (%d)", errno);
+	zassert_is_null(frags, "unexpected fragments");
+
+	/* Only ZSOCK_MSG_DONTWAIT is supported */
+	rv = zsock_recvfrom_zc(server_sock, &frags, ZSOCK_MSG_PEEK, NULL, NULL);
+	zassert_equal(rv, -1, "recvfrom_zc should fail");
+	zassert_equal(errno, EINVAL, "wrong errno (%d)", errno);
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+#else
+	ztest_test_skip();
+#endif
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
@@ -114,6 +114,7 @@ static enum test_case_no {
 	TEST_CLIENT_CLOSING_FAILURE_IPV6 = 16,
 	TEST_CLIENT_FIN_WAIT_2_IPV4_FAILURE = 17,
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
+	TEST_CLIENT_SACK_RENEGING = 19,
 } test_case_no;
 
 static enum test_state t_state;
@@ -138,6 +139,7 @@ static void handle_server_rst_on_closed_port(sa_family_t af, struct tcphdr *th);
 static void handle_server_rst_on_listening_port(sa_family_t af, struct tcphdr *th);
 static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
 static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *th);
+static void handle_client_sack_reneging(struct net_pkt *pkt);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -235,6 +237,18 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+static uint8_t tcp_sack_perm_options[4] = {
+	0x01, 0x01, /* NOP */
+	0x04, 0x02, /* SACK */ };
+
+/* Offer SACK in the SYN sent by the peer */
+static bool peer_sack_permitted;
+
+/* SACK block carried by the ACKs sent by the peer, if not empty */
+static uint32_t peer_sack_start;
+static uint32_t peer_sack_end;
+static uint8_t tcp_sack_block_options[12];
+
 static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -245,11 +259,25 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct net_pkt *pkt;
 	struct tcphdr *th;
+	const uint8_t *opts = NULL;
 	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
 	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+		opts = tcp_options;
 		opts_len = sizeof(tcp_options);
+	} else if (peer_sack_permitted && (flags & SYN)) {
+		opts = tcp_sack_perm_options;
+		opts_len = sizeof(tcp_sack_perm_options);
+	} else if ((peer_sack_start != peer_sack_end) && (flags & ACK)) {
+		tcp_sack_block_options[0] = 0x01; /* NOP */
+		tcp_sack_block_options[1] = 0x01; /* NOP */
+		tcp_sack_block_options[2] = 0x05; /* SACK */
+		tcp_sack_block_options[3] = 0x0a;
+		sys_put_be32(peer_sack_start, &tcp_sack_block_options[4]);
+		sys_put_be32(peer_sack_end, &tcp_sack_block_options[8]);
+		opts = tcp_sack_block_options;
+		opts_len = sizeof(tcp_sack_block_options);
 	}
 
 	/* Allocate buffer */
@@ -284,11 +312,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
+	th->th_off = 5U + opts_len / 4U;
 
 	th->th_flags = flags;
 	th->th_win = NET_IPV6_MTU;
@@ -303,9 +327,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -426,6 +450,56 @@ fail:
 	return -EINVAL;
 }
 
+/* Read the first block of the SACK option, if there is one */
+static int read_tcp_sack_block(struct net_pkt *pkt, struct tcphdr *th,
+			       uint32_t *start, uint32_t *end)
+{
+	uint8_t opts[40];
+	size_t opts_len = (th->th_off - 5U) * 4U;
+	size_t i = 0;
+	int ret;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	ret = net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) +
+			   net_pkt_ip_opts_len(pkt) + sizeof(struct tcphdr));
+	if (ret == 0) {
+		ret = net_pkt_read(pkt, opts, MIN(opts_len, sizeof(opts)));
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	if (ret < 0) {
+		return -EINVAL;
+	}
+
+	while (i + 1 < opts_len) {
+		if (opts[i] == 0x00) {
+			break;
+		}
+
+		if (opts[i] == 0x01) {
+			i++;
+			continue;
+		}
+
+		if (opts[i] == 0x05 && opts[i + 1] >= 10U && i + 10U <= opts_len) {
+			*start = sys_get_be32(&opts[i + 2]);
+			*end = sys_get_be32(&opts[i + 6]);
+			return 0;
+		}
+
+		if (opts[i + 1] < 2U) {
+			break;
+		}
+
+		i += opts[i + 1];
+	}
+
+	return -ENOENT;
+}
+
 static int tester_send(const struct device *dev, struct net_pkt *pkt)
 {
 	struct tcphdr th;
@@ -490,6 +564,9 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_CLIENT_FIN_ACK_WITH_DATA:
 		handle_client_fin_ack_with_data_test(net_pkt_family(pkt), &th);
 		break;
+	case TEST_CLIENT_SACK_RENEGING:
+		handle_client_sack_reneging(pkt);
+		break;
 
 	default:
 		zassert_true(false, "Undefined test case");
@@ -2034,11 +2111,14 @@ ZTEST(net_tcp, test_client_invalid_rst)
 #define MAX_DATA 100
 #define OUT_OF_ORDER_SEQ_INIT -15
 static uint32_t expected_ack;
+static uint32_t expected_sack_start;
+static uint32_t expected_sack_len;
 static struct net_context *ooo_ctx;
 
 static void handle_server_recv_out_of_order(struct net_pkt *pkt)
 {
 	struct tcphdr th;
+	uint32_t sack_start, sack_end;
 	int ret;
 
 	ret = read_tcp_header(pkt, &th);
@@ -2052,6 +2132,21 @@ static void handle_server_recv_out_of_order(struct net_pkt *pkt)
 		      "Expected ACK %u but got %u",
 		      expected_ack, ntohl(th.th_ack));
 
+	/* Verify that the queued data beyond the hole is reported first */
+	ret = read_tcp_sack_block(pkt, &th, &sack_start, &sack_end);
+	if (expected_sack_len == 0) {
+		zassert_true(ret < 0, "Unexpected SACK block %u-%u",
+			     sack_start, sack_end);
+	} else {
+		zassert_equal(ret, 0, "SACK block missing");
+		zassert_equal(expected_sack_start, sack_start,
+			      "Expected SACK start %u but got %u",
+			      expected_sack_start, sack_start);
+		zassert_equal(expected_sack_start + expected_sack_len, sack_end,
+			      "Expected SACK end %u but got %u",
+			      expected_sack_start + expected_sack_len, sack_end);
+	}
+
 	test_sem_give();
 
 	return;
@@ -2066,14 +2161,16 @@ struct out_of_order_check_struct {
 	int length;
 	int ack_offset;
 	int delay_ms;
+	int sack_offset;
+	int sack_length;
 };
 
 static struct out_of_order_check_struct out_of_order_check_list[] = {
 	{ 30, 10, 0, 0}, /* First packet will be out-of-order */
 	{ 20, 12, 0, 0},
 	{ 10,  9, 0, 0}, /* Section with a gap */
-	{ 0,  10, 10, 0},
-	{ 10, 10, 40, 0}, /* First sequence complete */
+	{ 0,  10, 19, 0}, /* Queued data up to the gap is passed too */
+	{ 19,  1, 40, 0}, /* Gap filled, first sequence complete */
 	{ 50,  6, 40, 0},
 	{ 50,  3, 40, 0}, /* Discardable packet */
 	{ 55,  5, 40, 0},
@@ -2108,6 +2205,8 @@ static void checklist_based_out_of_order_test(struct out_of_order_check_struct *
 
 		/* Initial ack for the last correctly received byte = SYN flag */
 		expected_ack = sequence_base + check_ptr->ack_offset;
+		expected_sack_start = sequence_base + check_ptr->sack_offset;
+		expected_sack_len = check_ptr->sack_length;
 
 		ret = net_recv_data(net_iface, pkt);
 		zassert_true(ret == 0, "recv data failed (%d)", ret);
@@ -2201,6 +2300,198 @@ ZTEST(net_tcp, test_server_out_of_order_data)
 	test_server_timeout_out_of_order_data();
 }
 
+static struct out_of_order_check_struct sack_check_list[] = {
+	{ 20, 10,  0, 0, 20, 10}, /* First hole */
+	{ 40, 10,  0, 0, 40, 10}, /* Most recent block is reported first */
+	{ 30,  5,  0, 0, 20, 15}, /* Blocks are merged */
+	{  0, 10, 10, 0, 20, 15}, /* First hole filled */
+	{ 10, 10, 35, 0, 40, 10}, /* Queued data passed, one hole left */
+	{ 35,  5, 50, 0,  0,  0}, /* All holes filled, no SACK */
+};
+
+ZTEST(net_tcp, test_server_out_of_order_sack)
+{
+	struct net_pkt *rst;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_SACK)) {
+		ztest_test_skip();
+	}
+
+	k_sem_reset(&test_sem);
+
+	peer_sack_permitted = true;
+	ooo_ctx = create_server_socket(OUT_OF_ORDER_SEQ_INIT, -15U);
+	peer_sack_permitted = false;
+
+	test_case_no = TEST_SERVER_RECV_OUT_OF_ORDER_DATA;
+
+	checklist_based_out_of_order_test(sack_check_list,
+					  ARRAY_SIZE(sack_check_list),
+					  OUT_OF_ORDER_SEQ_INIT + 1);
+
+	seq = expected_ack + 1;
+	rst = prepare_rst_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT));
+
+	ret = net_recv_data(net_iface, rst);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ooo_ctx);
+	net_context_put(accepted_ctx);
+}
+
+#define SACK_RENEGING_SEGMENTS 3
+#define SACK_RENEGING_SEGMENT_LEN 10
+#define SACK_RENEGING_DATA_LEN (SACK_RENEGING_SEGMENTS * SACK_RENEGING_SEGMENT_LEN)
+
+/* Relative sequence number of the next data the peer expects */
+static uint32_t sack_reneging_next;
+static uint16_t sack_reneging_port;
+
+static void handle_client_sack_reneging(struct net_pkt *pkt)
+{
+	sa_family_t af = net_pkt_family(pkt);
+	struct net_pkt *reply;
+	struct tcphdr th;
+	size_t len;
+	int ret;
+
+	ret = read_tcp_header(pkt, &th);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) -
+	      net_pkt_ip_opts_len(pkt) - th.th_off * 4U;
+
+	switch (t_state) {
+	case T_SYN:
+		test_verify_flags(&th, SYN);
+		device_initial_seq = ntohl(th.th_seq);
+		sack_reneging_port = th.th_sport;
+		seq = 0U;
+		ack = ntohl(th.th_seq) + 1U;
+		reply = prepare_syn_ack_packet(af, htons(MY_PORT), th.th_sport);
+		seq++;
+		t_state = T_SYN_ACK;
+		break;
+	case T_SYN_ACK:
+		test_verify_flags(&th, ACK);
+		sack_reneging_next = 1U;
+		t_state = T_DATA;
+		test_sem_give();
+		return;
+	case T_DATA:
+		/* Lose the first segment, SACK the others */
+		zassert_equal(len, SACK_RENEGING_SEGMENT_LEN, "unexpected segment length %zu",
+			      len);
+		if (get_rel_seq(&th) + len < 1U + SACK_RENEGING_DATA_LEN) {
+			return;
+		}
+
+		peer_sack_start = device_initial_seq + 1U + SACK_RENEGING_SEGMENT_LEN;
+		peer_sack_end = device_initial_seq + 1U + SACK_RENEGING_DATA_LEN;
+		reply = prepare_ack_packet(af, htons(MY_PORT), th.th_sport);
+		peer_sack_start = peer_sack_end = 0U;
+		t_state = T_DATA_ACK;
+		break;
+	case T_DATA_ACK:
+		/* The peer dropped the SACKed data, only the data received
+		 * from now on is acknowledged.
+		 */
+		zassert_equal(get_rel_seq(&th), sack_reneging_next,
+			      "expected retransmission of %u, got %u",
+			      sack_reneging_next, get_rel_seq(&th));
+		zassert_true(len > 0, "expected data");
+
+		sack_reneging_next += len;
+		ack = device_initial_seq + sack_reneging_next;
+		reply = prepare_ack_packet(af, htons(MY_PORT), th.th_sport);
+
+		if (sack_reneging_next == 1U + SACK_RENEGING_DATA_LEN) {
+			t_state = T_CLOSING;
+			test_sem_give();
+		}
+		break;
+	case T_CLOSING:
+		return;
+	default:
+		zassert_true(false, "%s unexpected state", __func__);
+		return;
+	}
+
+	ret = net_recv_data(net_iface, reply);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	return;
+fail:
+	zassert_true(false, "%s failed", __func__);
+}
+
+/* Test case scenario IPv4
+ *   expect SYN, send SYN ACK with SACK permitted,
+ *   expect ACK,
+ *   expect three data segments, SACK the last two,
+ *   let the retransmission timer expire,
+ *   expect the first segment, acknowledge it without SACK,
+ *   expect the SACKed data to be sent again.
+ */
+ZTEST(net_tcp, test_client_sack_reneging)
+{
+	struct net_context *ctx;
+	struct net_pkt *rst;
+	int no_delay = 1;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_SACK)) {
+		ztest_test_skip();
+	}
+
+	k_sem_reset(&test_sem);
+
+	t_state = T_SYN;
+	test_case_no = TEST_CLIENT_SACK_RENEGING;
+	seq = ack = 0;
+	peer_sack_permitted = true;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	zassert_equal(ret, 0, "Failed to get net_context");
+
+	ret = net_context_connect(ctx, (struct sockaddr *)&peer_addr_s,
+				  sizeof(struct sockaddr_in), NULL, K_MSEC(100), NULL);
+	zassert_equal(ret, 0, "Failed to connect to peer");
+
+	peer_sack_permitted = false;
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Send one segment per call */
+	ret = net_tcp_set_option(ctx, TCP_OPT_NODELAY, &no_delay, sizeof(no_delay));
+	zassert_equal(ret, 0, "Failed to set TCP_NODELAY");
+
+	for (int i = 0; i < SACK_RENEGING_SEGMENTS; i++) {
+		ret = net_context_send(ctx, &lorem_ipsum[i * SACK_RENEGING_SEGMENT_LEN],
+				       SACK_RENEGING_SEGMENT_LEN, NULL, K_NO_WAIT, NULL);
+		zassert_equal(ret, SACK_RENEGING_SEGMENT_LEN, "Failed to send data (%d)", ret);
+	}
+
+	/* Peer will release the semaphore once all the data is acknowledged */
+	test_sem_take(K_MSEC(1000), __LINE__);
+
+	rst = prepare_rst_packet(AF_INET, htons(MY_PORT), sack_reneging_port);
+	ret = net_recv_data(net_iface, rst);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+}
+
 static void handle_server_rst_on_closed_port(sa_family_t af, struct tcphdr *th)
 {
 	switch (t_state) {
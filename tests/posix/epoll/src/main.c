@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <unistd.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/posix/sys/epoll.h>
+#include <zephyr/posix/sys/eventfd.h>
+#include <zephyr/ztest.h>
+
+#define NUM_FDS 3
+
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static int epfd = -1;
+static int efd[NUM_FDS] = {-1, -1, -1};
+
+static struct k_thread thread;
+static K_THREAD_STACK_DEFINE(stack, STACK_SIZE);
+
+static void add_fd(int i, uint32_t events)
+{
+	struct epoll_event ev = {
+		.events = events,
+		.data.u32 = i,
+	};
+
+	zassert_ok(epoll_ctl(epfd, EPOLL_CTL_ADD, efd[i], &ev), "add failed (%d)", errno);
+}
+
+static void write_entry(void *p1, void *p2, void *p3)
+{
+	k_msleep(50);
+	zassert_ok(eventfd_write(efd[0], 1));
+}
+
+static void epoll_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	epfd = epoll_create1(EPOLL_CLOEXEC);
+	zassert_true(epfd >= 0, "epoll_create1 failed (%d)", errno);
+
+	for (int i = 0; i < NUM_FDS; i++) {
+		efd[i] = eventfd(0, 0);
+		zassert_true(efd[i] >= 0, "eventfd failed (%d)", errno);
+		add_fd(i, EPOLLIN);
+	}
+}
+
+static void epoll_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (int i = 0; i < NUM_FDS; i++) {
+		if (efd[i] >= 0) {
+			close(efd[i]);
+			efd[i] = -1;
+		}
+	}
+
+	close(epfd);
+	epfd = -1;
+}
+
+ZTEST(posix_epoll, test_epoll_wait)
+{
+	struct epoll_event events[NUM_FDS];
+	eventfd_t val;
+
+	zassert_equal(epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 0);
+
+	zassert_ok(eventfd_write(efd[1], 1));
+	zassert_equal(epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 1);
+	zassert_equal(events[0].events, EPOLLIN);
+	zassert_equal(events[0].data.u32, 1);
+
+	/* level-triggered, reported until consumed */
+	zassert_equal(epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 1);
+	zassert_equal(events[0].data.u32, 1);
+
+	zassert_ok(eventfd_read(efd[1], &val));
+	zassert_equal(epoll_wait(epfd, events, ARRAY_SIZE(events), 10), 0);
+
+	/* a closed descriptor is removed from the instance */
+	zassert_ok(eventfd_write(efd[2], 1));
+	zassert_ok(close(efd[2]));
+	efd[2] = -1;
+	zassert_equal(epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 0);
+}
+
+ZTEST(posix_epoll, test_epoll_wait_blocking)
+{
+	struct epoll_event events[NUM_FDS];
+	k_tid_t tid;
+
+	tid = k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack), write_entry,
+			      NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_equal(epoll_wait(epfd, events, ARRAY_SIZE(events), 1000), 1);
+	zassert_equal(events[0].events, EPOLLIN);
+	zassert_equal(events[0].data.u32, 0);
+
+	k_thread_join(tid, K_FOREVER);
+}
+
+ZTEST(posix_epoll, test_epoll_ctl)
+{
+	struct epoll_event events[NUM_FDS];
+	struct epoll_event ev = {
+		.events = EPOLLOUT,
+		.data.u32 = 42,
+	};
+
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_ADD, efd[0], &ev), -1);
+	zassert_equal(errno, EEXIST);
+
+	/* an eventfd can always be written to */
+	zassert_ok(epoll_ctl(epfd, EPOLL_CTL_MOD, efd[0], &ev));
+	zassert_equal(epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 1);
+	zassert_equal(events[0].events, EPOLLOUT);
+	zassert_equal(events[0].data.u32, 42);
+
+	zassert_ok(epoll_ctl(epfd, EPOLL_CTL_DEL, efd[0], NULL));
+	zassert_equal(epoll_wait(epfd, events, ARRAY_SIZE(events), 0), 0);
+
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_DEL, efd[0], NULL), -1);
+	zassert_equal(errno, ENOENT);
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_MOD, efd[0], &ev), -1);
+	zassert_equal(errno, ENOENT);
+}
+
+ZTEST(posix_epoll, test_epoll_errors)
+{
+	struct epoll_event events[NUM_FDS];
+	struct epoll_event ev = {
+		.events = EPOLLIN,
+	};
+
+	zassert_equal(epoll_create(0), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_ADD, epfd, &ev), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(epoll_ctl(efd[0], EPOLL_CTL_ADD, efd[1], &ev), -1);
+	zassert_equal(errno, EINVAL);
+
+	/* edge-triggered and one-shot events are not supported */
+	ev.events = EPOLLIN | BIT(31);
+	zassert_ok(epoll_ctl(epfd, EPOLL_CTL_DEL, efd[0], NULL));
+	zassert_equal(epoll_ctl(epfd, EPOLL_CTL_ADD, efd[0], &ev), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(epoll_wait(epfd, events, 0, 0), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(epoll_wait(efd[0], events, ARRAY_SIZE(events), 0), -1);
+	zassert_equal(errno, EINVAL);
+}
+
+ZTEST_SUITE(posix_epoll, NULL, NULL, epoll_before, epoll_after, NULL);
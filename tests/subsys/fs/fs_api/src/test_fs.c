@@ -23,6 +23,8 @@ static int file_length;
 static struct fs_mount_t *mp[FS_TYPE_EXTERNAL_BASE];
 static bool nospace;
 static int opendir_result;
+static struct k_sem *mkdir_entered;
+static struct k_sem *mkdir_release;
 
 static
 int temp_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
@@ -197,12 +199,23 @@ static int temp_sync(struct fs_file_t *zfp)
 	return 0;
 }
 
+void mock_mkdir_wait(struct k_sem *entered, struct k_sem *release)
+{
+	mkdir_entered = entered;
+	mkdir_release = release;
+}
+
 static int temp_mkdir(struct fs_mount_t *mountp, const char *path)
 {
 	if (mountp == NULL || path == NULL) {
 		return -EINVAL;
 	}
 
+	if (mkdir_release != NULL) {
+		k_sem_give(mkdir_entered);
+		k_sem_take(mkdir_release, K_FOREVER);
+	}
+
 	if (strcmp(mountp->mnt_point, path) == 0) {
 		return -EPERM;
 	}
@@ -33,4 +33,5 @@ struct test_fs_data {
 };
 
 void mock_opendir_result(int ret);
+void mock_mkdir_wait(struct k_sem *entered, struct k_sem *release);
 #endif
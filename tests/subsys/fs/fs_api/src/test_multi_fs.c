@@ -131,6 +131,115 @@ ZTEST(fs_api_register_mount, test_fs_register)
 	zassert_true(test_fs_deinit() == 0, "Failed to unregister filesystems");
 }
 
+static struct test_fs_data test_data_nested;
+
+static struct fs_mount_t test_fs_mnt_nested = {
+		.type = TEST_FS_2,
+		.mnt_point = TEST_FS_NAND1 "/SUB:",
+		.fs_data = &test_data_nested,
+};
+
+/**
+ * @brief Mount point lookup
+ *
+ * @details
+ *  Find the longest mount point of paths, with nested mount points.
+ *  The test file system fails to create a directory at its mount point.
+ */
+ZTEST(fs_api_register_mount, test_fs_mount_lookup)
+{
+	zassert_ok(fs_register(TEST_FS_1, &temp_fs));
+	zassert_ok(fs_register(TEST_FS_2, &temp_fs));
+	zassert_ok(fs_mount(&test_fs_mnt_1));
+	zassert_ok(fs_mount(&test_fs_mnt_nested));
+
+	zassert_equal(fs_mkdir(TEST_FS_NAND1), -EPERM, "Mount point not found");
+	zassert_equal(fs_mkdir(TEST_FS_NAND1 "/SUB:"), -EPERM, "Nested mount point not found");
+	zassert_ok(fs_mkdir(TEST_FS_NAND1 "/SUB:/dir"), "Nested mount point not found");
+	zassert_ok(fs_mkdir(TEST_FS_NAND1 "/SUBDIR"), "Nested mount point matched");
+	zassert_equal(fs_mkdir("/NAND/dir"), -ENOENT, "Mount point prefix matched");
+
+	zassert_ok(fs_unmount(&test_fs_mnt_nested));
+	zassert_ok(fs_mkdir(TEST_FS_NAND1 "/SUB:"), "Unmounted mount point found");
+
+	zassert_ok(fs_unmount(&test_fs_mnt_1));
+	zassert_equal(fs_mkdir(TEST_FS_NAND1), -ENOENT, "Unmounted mount point found");
+
+	zassert_ok(fs_unregister(TEST_FS_2, &temp_fs));
+	zassert_ok(fs_unregister(TEST_FS_1, &temp_fs));
+}
+
+#define THREAD_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_DEFINE(mkdir_stack, THREAD_STACK_SIZE);
+static K_THREAD_STACK_DEFINE(unmount_stack, THREAD_STACK_SIZE);
+static struct k_thread mkdir_thread;
+static struct k_thread unmount_thread;
+static K_SEM_DEFINE(mkdir_entered, 0, 1);
+static K_SEM_DEFINE(mkdir_release, 0, 1);
+static int mkdir_rc;
+static int unmount_rc;
+
+static void mkdir_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	mkdir_rc = fs_mkdir(TEST_FS_NAND1 "/dir");
+}
+
+static void unmount_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	unmount_rc = fs_unmount(&test_fs_mnt_1);
+}
+
+/**
+ * @brief Unmount with a path operation in progress
+ *
+ * @details
+ *  Unmount waits for the path operation in progress on the mount point,
+ *  while other mount points can be mounted.
+ */
+ZTEST(fs_api_register_mount, test_fs_unmount_wait)
+{
+	zassert_ok(fs_register(TEST_FS_1, &temp_fs));
+	zassert_ok(fs_register(TEST_FS_2, &temp_fs));
+	zassert_ok(fs_mount(&test_fs_mnt_1));
+
+	mock_mkdir_wait(&mkdir_entered, &mkdir_release);
+	mkdir_rc = -EINPROGRESS;
+	unmount_rc = -EINPROGRESS;
+
+	k_thread_create(&mkdir_thread, mkdir_stack, K_THREAD_STACK_SIZEOF(mkdir_stack),
+			mkdir_fn, NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	zassert_ok(k_sem_take(&mkdir_entered, K_SECONDS(1)), "Operation not started");
+
+	k_thread_create(&unmount_thread, unmount_stack, K_THREAD_STACK_SIZEOF(unmount_stack),
+			unmount_fn, NULL, NULL, NULL, K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_sleep(K_MSEC(10));
+	zassert_equal(unmount_rc, -EINPROGRESS, "Unmount did not wait");
+
+	zassert_ok(fs_mount(&test_fs_mnt_2), "Mount blocked by the unmount");
+	zassert_equal(fs_mount(&test_fs_mnt_1), -EBUSY, "Unmounting mount point mounted");
+	zassert_equal(fs_mkdir(TEST_FS_NAND1 "/dir2"), -ENOENT, "Unmounting mount point found");
+
+	mock_mkdir_wait(NULL, NULL);
+	k_sem_give(&mkdir_release);
+	zassert_ok(k_thread_join(&mkdir_thread, K_SECONDS(1)));
+	zassert_ok(k_thread_join(&unmount_thread, K_SECONDS(1)));
+	zassert_ok(mkdir_rc, "Operation in progress failed");
+	zassert_ok(unmount_rc, "Unmount failed");
+
+	zassert_ok(fs_unmount(&test_fs_mnt_2));
+	zassert_ok(fs_unregister(TEST_FS_2, &temp_fs));
+	zassert_ok(fs_unregister(TEST_FS_1, &temp_fs));
+}
+
 /**
  * @}
  */
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <aio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <zephyr/kernel.h>
+#include <zephyr/rtio/work.h>
+#include <zephyr/ztest.h>
+
+#define AIO_FILE "/RAM:/aio.txt"
+#define AIO_FILE_FMT "/RAM:/aio%d.txt"
+
+/* operations holding all the RTIO work items */
+#define HOLD_OPS CONFIG_RTIO_WORKQ_POOL_ITEMS
+
+#ifndef O_SYNC
+/* not defined by the POSIX headers, aio_fsync() then accepts any operation */
+#define O_SYNC 0
+#endif
+
+void test_mount(void);
+
+static const char test_str[] = "hello aio";
+static char rbuf[64];
+static int fd = -1;
+static int notify_value;
+static K_SEM_DEFINE(notify_sem, 0, 1);
+static K_SEM_DEFINE(hold_sem, 0, HOLD_OPS);
+
+static void notify(union sigval val)
+{
+	notify_value = val.sival_int;
+	k_sem_give(&notify_sem);
+}
+
+/* keeps the work item of the operation until hold_sem is given */
+static void hold(union sigval val)
+{
+	ARG_UNUSED(val);
+
+	k_sem_take(&hold_sem, K_FOREVER);
+}
+
+static void aiocb_init(struct aiocb *aiocbp, void *buf, size_t len, off_t offset)
+{
+	memset(aiocbp, 0, sizeof(*aiocbp));
+	aiocbp->aio_fildes = fd;
+	aiocbp->aio_buf = buf;
+	aiocbp->aio_nbytes = len;
+	aiocbp->aio_offset = offset;
+	aiocbp->aio_sigevent.sigev_notify = SIGEV_NONE;
+}
+
+static ssize_t aio_wait(struct aiocb *aiocbp)
+{
+	const struct aiocb *list[] = {aiocbp};
+	int rc;
+
+	while (aio_error(aiocbp) == EINPROGRESS) {
+		rc = aio_suspend(list, ARRAY_SIZE(list), NULL);
+		zassert_equal(rc, 0, "Suspend failed (%d)", errno);
+	}
+
+	return aio_return(aiocbp);
+}
+
+static void *aio_setup(void)
+{
+	test_mount();
+
+	return NULL;
+}
+
+static void aio_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	fd = open(AIO_FILE, O_CREAT | O_RDWR | O_TRUNC, 0660);
+	zassert_true(fd >= 0, "Open failed (%d)", errno);
+	memset(rbuf, 0, sizeof(rbuf));
+}
+
+static void aio_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	close(fd);
+}
+
+ZTEST(fs_rtio_aio, test_aio_write_read)
+{
+	struct aiocb wcb;
+	struct aiocb scb;
+	struct aiocb rcb;
+
+	aiocb_init(&wcb, (void *)test_str, sizeof(test_str), 4);
+	zassert_ok(aio_write(&wcb), "Write failed (%d)", errno);
+
+	aiocb_init(&scb, NULL, 0, 0);
+	zassert_ok(aio_fsync(O_SYNC, &scb), "Sync failed (%d)", errno);
+
+	aiocb_init(&rcb, rbuf, sizeof(rbuf), 4);
+	zassert_ok(aio_read(&rcb), "Read failed (%d)", errno);
+
+	/* the operations on the file run in order */
+	zassert_equal(aio_wait(&rcb), sizeof(test_str), "Unexpected read result");
+	zassert_equal(aio_error(&wcb), 0, "Write not completed");
+	zassert_equal(aio_return(&wcb), sizeof(test_str), "Unexpected write result");
+	zassert_equal(aio_wait(&scb), 0, "Unexpected sync result");
+
+	zassert_mem_equal(rbuf, test_str, sizeof(test_str), "Read data mismatch");
+
+	/* returned operations are forgotten */
+	zassert_equal(aio_error(&wcb), -1);
+	zassert_equal(errno, EINVAL);
+}
+
+ZTEST(fs_rtio_aio, test_aio_notify)
+{
+	struct aiocb wcb;
+
+	aiocb_init(&wcb, (void *)test_str, sizeof(test_str), 0);
+	wcb.aio_sigevent.sigev_notify = SIGEV_THREAD;
+	wcb.aio_sigevent.sigev_notify_function = notify;
+	wcb.aio_sigevent.sigev_value.sival_int = 42;
+
+	zassert_ok(aio_write(&wcb), "Write failed (%d)", errno);
+	zassert_ok(k_sem_take(&notify_sem, K_SECONDS(1)), "No notification");
+	zassert_equal(notify_value, 42, "Unexpected notification value");
+	zassert_equal(aio_wait(&wcb), sizeof(test_str), "Unexpected write result");
+}
+
+ZTEST(fs_rtio_aio, test_lio_listio)
+{
+	struct aiocb cbs[3];
+	struct aiocb *list[ARRAY_SIZE(cbs)];
+
+	for (int i = 0; i < ARRAY_SIZE(cbs); i++) {
+		aiocb_init(&cbs[i], (void *)&test_str[i], 1, i);
+		cbs[i].aio_lio_opcode = LIO_WRITE;
+		list[i] = &cbs[i];
+	}
+	cbs[1].aio_lio_opcode = LIO_NOP;
+	cbs[2].aio_offset = 1;
+
+	zassert_ok(lio_listio(LIO_WAIT, list, ARRAY_SIZE(list), NULL), "List failed (%d)", errno);
+	zassert_equal(aio_return(&cbs[0]), 1, "Unexpected write result");
+	zassert_equal(aio_return(&cbs[2]), 1, "Unexpected write result");
+
+	/* the NOP operation writes nothing */
+	zassert_equal(pread(fd, rbuf, sizeof(rbuf), 0), 2, "Unexpected file size");
+	zassert_equal(rbuf[0], test_str[0]);
+	zassert_equal(rbuf[1], test_str[2]);
+}
+
+ZTEST(fs_rtio_aio, test_aio_errors)
+{
+	struct aiocb cb;
+
+	aiocb_init(&cb, rbuf, sizeof(rbuf), 0);
+	cb.aio_fildes = -1;
+	zassert_equal(aio_read(&cb), -1);
+	zassert_equal(errno, EBADF);
+
+	aiocb_init(&cb, rbuf, sizeof(rbuf), -1);
+	zassert_equal(aio_read(&cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	aiocb_init(&cb, rbuf, sizeof(rbuf), 0);
+	cb.aio_sigevent.sigev_notify = SIGEV_SIGNAL;
+	zassert_equal(aio_read(&cb), -1);
+	zassert_equal(errno, EINVAL);
+
+	zassert_equal(aio_cancel(fd, NULL), AIO_ALLDONE);
+}
+
+ZTEST(fs_rtio_aio, test_aio_no_work_item)
+{
+	struct aiocb cbs[HOLD_OPS + 1];
+	int fds[HOLD_OPS + 1];
+	char path[sizeof(AIO_FILE_FMT) + 10];
+
+	if (CONFIG_POSIX_AIO_MAX <= HOLD_OPS) {
+		ztest_test_skip();
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(fds); i++) {
+		snprintf(path, sizeof(path), AIO_FILE_FMT, i);
+		fds[i] = open(path, O_CREAT | O_RDWR | O_TRUNC, 0660);
+		zassert_true(fds[i] >= 0, "Open of %s failed (%d)", path, errno);
+
+		aiocb_init(&cbs[i], (void *)test_str, sizeof(test_str), 0);
+		cbs[i].aio_fildes = fds[i];
+		cbs[i].aio_sigevent.sigev_notify = SIGEV_THREAD;
+		cbs[i].aio_sigevent.sigev_notify_function = hold;
+	}
+
+	/* one work item per file, running or queued, until the notifications return */
+	for (int i = 0; i < HOLD_OPS; i++) {
+		zassert_ok(aio_write(&cbs[i]), "Write failed (%d)", errno);
+	}
+
+	/* the operation that gets no work item completes with an error */
+	cbs[HOLD_OPS].aio_sigevent.sigev_notify_function = notify;
+	cbs[HOLD_OPS].aio_sigevent.sigev_value.sival_int = 7;
+	zassert_ok(aio_write(&cbs[HOLD_OPS]), "Write failed (%d)", errno);
+	zassert_ok(k_sem_take(&notify_sem, K_NO_WAIT), "No notification");
+	zassert_equal(notify_value, 7, "Unexpected notification value");
+	zassert_equal(aio_error(&cbs[HOLD_OPS]), EAGAIN, "Operation not completed");
+	zassert_equal(aio_return(&cbs[HOLD_OPS]), -1);
+	zassert_equal(errno, EAGAIN);
+
+	for (int i = 0; i < HOLD_OPS; i++) {
+		k_sem_give(&hold_sem);
+	}
+
+	for (int i = 0; i < HOLD_OPS; i++) {
+		zassert_equal(aio_wait(&cbs[i]), sizeof(test_str), "Unexpected write result");
+	}
+
+	/* the work items are freed once the work queue threads are done with them */
+	while (rtio_work_req_used_count_get() != 0) {
+		k_msleep(1);
+	}
+
+	cbs[HOLD_OPS].aio_sigevent.sigev_notify = SIGEV_NONE;
+	zassert_ok(aio_write(&cbs[HOLD_OPS]), "Write failed (%d)", errno);
+	zassert_equal(aio_wait(&cbs[HOLD_OPS]), sizeof(test_str), "Unexpected write result");
+
+	for (int i = 0; i < ARRAY_SIZE(fds); i++) {
+		close(fds[i]);
+	}
+}
+
+ZTEST_SUITE(fs_rtio_aio, NULL, aio_setup, aio_before, aio_after, NULL);
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <ff.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_rtio.h>
+#include <zephyr/rtio/rtio.h>
+
+#define MNTP       "/RAM:"
+#define TEST_FILE  MNTP "/rtio.txt"
+#define TEST_FILE2 MNTP "/rtio2.txt"
+
+static FATFS fat_fs;
+static struct fs_mount_t fatfs_mnt = {
+	.type = FS_FATFS,
+	.mnt_point = MNTP,
+	.fs_data = &fat_fs,
+};
+
+RTIO_DEFINE(fs_rtio_ctx, 8, 8);
+
+static struct fs_file_t zfp;
+static struct fs_file_t zfp2;
+static struct fs_rtio_file file;
+static struct fs_rtio_file file2;
+
+static const uint8_t test_str[] = "hello rtio";
+static uint8_t rbuf[64];
+
+static void seek_start(struct rtio *r, const struct rtio_sqe *sqe, void *arg0)
+{
+	ARG_UNUSED(r);
+	ARG_UNUSED(sqe);
+
+	/* runs on the RTIO work queue, a failure shows in the next read */
+	(void)fs_seek(arg0, 0, FS_SEEK_SET);
+}
+
+static void open_file(struct fs_file_t *f, struct fs_rtio_file *rf, const char *path)
+{
+	int rc;
+
+	fs_file_t_init(f);
+	rc = fs_open(f, path, FS_O_CREATE | FS_O_RDWR | FS_O_TRUNC);
+	zassert_equal(rc, 0, "Open of %s failed (%d)", path, rc);
+
+	fs_rtio_file_init(rf, f);
+}
+
+static int consume(void **userdata)
+{
+	struct rtio_cqe *cqe = rtio_cqe_consume_block(&fs_rtio_ctx);
+	int result = cqe->result;
+
+	*userdata = cqe->userdata;
+	rtio_cqe_release(&fs_rtio_ctx, cqe);
+
+	return result;
+}
+
+/* Mount the file system, for the first test suite that runs */
+void test_mount(void)
+{
+	static bool mounted;
+	int rc;
+
+	if (mounted) {
+		return;
+	}
+
+	rc = fs_mount(&fatfs_mnt);
+	zassert_equal(rc, 0, "Mount failed (%d)", rc);
+	mounted = true;
+}
+
+static void *fs_rtio_setup(void)
+{
+	test_mount();
+
+	return NULL;
+}
+
+static void fs_rtio_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	fs_close(&zfp);
+	fs_close(&zfp2);
+}
+
+ZTEST(fs_rtio, test_write_sync_read)
+{
+	struct rtio_sqe *sqe;
+	void *userdata;
+	int rc;
+
+	open_file(&zfp, &file, TEST_FILE);
+	memset(rbuf, 0, sizeof(rbuf));
+
+	/* the chain runs in order: write, sync, rewind, read back */
+	sqe = rtio_sqe_acquire(&fs_rtio_ctx);
+	rtio_sqe_prep_write(sqe, &file.iodev, RTIO_PRIO_NORM, test_str, sizeof(test_str),
+			    (void *)1);
+	sqe->flags |= RTIO_SQE_CHAINED;
+
+	sqe = rtio_sqe_acquire(&fs_rtio_ctx);
+	fs_rtio_sqe_prep_sync(sqe, &file, RTIO_PRIO_NORM, (void *)2);
+	sqe->flags |= RTIO_SQE_CHAINED;
+
+	sqe = rtio_sqe_acquire(&fs_rtio_ctx);
+	rtio_sqe_prep_callback(sqe, seek_start, &zfp, (void *)3);
+	sqe->iodev = &file.iodev;
+	sqe->flags |= RTIO_SQE_CHAINED;
+
+	sqe = rtio_sqe_acquire(&fs_rtio_ctx);
+	rtio_sqe_prep_read(sqe, &file.iodev, RTIO_PRIO_NORM, rbuf, sizeof(rbuf), (void *)4);
+
+	rc = rtio_submit(&fs_rtio_ctx, 4);
+	zassert_equal(rc, 0, "Submit failed (%d)", rc);
+
+	zassert_equal(consume(&userdata), sizeof(test_str), "Unexpected write result");
+	zassert_equal_ptr(userdata, (void *)1);
+	zassert_equal(consume(&userdata), 0, "Unexpected sync result");
+	zassert_equal_ptr(userdata, (void *)2);
+	zassert_equal(consume(&userdata), 0, "Unexpected callback result");
+	zassert_equal_ptr(userdata, (void *)3);
+	zassert_equal(consume(&userdata), sizeof(test_str), "Unexpected read result");
+	zassert_equal_ptr(userdata, (void *)4);
+
+	zassert_mem_equal(rbuf, test_str, sizeof(test_str), "Read data mismatch");
+}
+
+ZTEST(fs_rtio, test_file_order)
+{
+	const uint8_t data[] = "abc";
+	const uint8_t data2[] = "xyz";
+	struct rtio_sqe *sqe;
+	void *userdata;
+	char expected[2 * sizeof(rbuf)];
+	int rc;
+
+	open_file(&zfp, &file, TEST_FILE);
+	open_file(&zfp2, &file2, TEST_FILE2);
+
+	/* independent submissions to each file, run in submission order per file */
+	for (int i = 0; i < 3; i++) {
+		sqe = rtio_sqe_acquire(&fs_rtio_ctx);
+		rtio_sqe_prep_tiny_write(sqe, &file.iodev, RTIO_PRIO_NORM, &data[i], 1, NULL);
+		sqe = rtio_sqe_acquire(&fs_rtio_ctx);
+		rtio_sqe_prep_tiny_write(sqe, &file2.iodev, RTIO_PRIO_NORM, &data2[i], 1, NULL);
+	}
+
+	rc = rtio_submit(&fs_rtio_ctx, 6);
+	zassert_equal(rc, 0, "Submit failed (%d)", rc);
+
+	for (int i = 0; i < 6; i++) {
+		zassert_equal(consume(&userdata), 1, "Unexpected write result");
+	}
+
+	memset(expected, 0, sizeof(expected));
+	fs_seek(&zfp, 0, FS_SEEK_SET);
+	rc = fs_read(&zfp, expected, sizeof(expected));
+	zassert_equal(rc, 3, "Unexpected file size %d", rc);
+	zassert_mem_equal(expected, "abc", 3, "Writes out of order");
+
+	memset(expected, 0, sizeof(expected));
+	fs_seek(&zfp2, 0, FS_SEEK_SET);
+	rc = fs_read(&zfp2, expected, sizeof(expected));
+	zassert_equal(rc, 3, "Unexpected file size %d", rc);
+	zassert_mem_equal(expected, "xyz", 3, "Writes out of order");
+}
+
+ZTEST(fs_rtio, test_error)
+{
+	struct rtio_sqe *sqe;
+	void *userdata;
+	int rc;
+
+	open_file(&zfp, &file, TEST_FILE);
+
+	/* closed file */
+	fs_close(&zfp);
+
+	sqe = rtio_sqe_acquire(&fs_rtio_ctx);
+	rtio_sqe_prep_read(sqe, &file.iodev, RTIO_PRIO_NORM, rbuf, sizeof(rbuf), NULL);
+
+	rc = rtio_submit(&fs_rtio_ctx, 1);
+	zassert_equal(rc, 0, "Submit failed (%d)", rc);
+	zassert_true(consume(&userdata) < 0, "Read of a closed file succeeded");
+}
+
+ZTEST_SUITE(fs_rtio, NULL, fs_rtio_setup, NULL, fs_rtio_after, NULL);
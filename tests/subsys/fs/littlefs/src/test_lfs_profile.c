@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* littlefs runtime cache profiles and block access statistics */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/littlefs.h>
+#include "testfs_tests.h"
+#include "testfs_lfs.h"
+
+#if defined(CONFIG_FS_LITTLEFS_PROFILE) || defined(CONFIG_FS_LITTLEFS_STATS)
+
+#define PROFILE_CACHE_SIZE 256
+#define DATA_SIZE 1024
+
+static uint8_t data[DATA_SIZE];
+static uint8_t rdata[DATA_SIZE];
+
+static struct fs_mount_t *mp = &testfs_small_mnt;
+
+static void write_read(const char *name)
+{
+	struct testfs_path path;
+	struct fs_file_t file;
+
+	for (size_t i = 0; i < sizeof(data); ++i) {
+		data[i] = i;
+	}
+
+	testfs_path_init(&path, mp, name, TESTFS_PATH_END);
+	fs_file_t_init(&file);
+
+	zassert_ok(fs_open(&file, path.path, FS_O_CREATE | FS_O_RDWR), "open failed");
+	zassert_equal(fs_write(&file, data, sizeof(data)), sizeof(data), "write failed");
+	zassert_ok(fs_sync(&file), "sync failed");
+	zassert_ok(fs_seek(&file, 0, FS_SEEK_SET), "seek failed");
+	zassert_equal(fs_read(&file, rdata, sizeof(rdata)), sizeof(rdata), "read failed");
+	zassert_ok(fs_close(&file), "close failed");
+
+	zassert_mem_equal(rdata, data, sizeof(data), "read data mismatch");
+}
+
+#ifdef CONFIG_FS_LITTLEFS_PROFILE
+ZTEST(littlefs, test_lfs_profile)
+{
+	const struct lfs_config *lcp = &((const struct fs_littlefs *)mp->fs_data)->cfg;
+	struct fs_littlefs_profile profile = {
+		.cache_size = PROFILE_CACHE_SIZE,
+		.lookahead_size = FS_LITTLEFS_LOOKAHEAD_ALL,
+	};
+	lfs_size_t cache_size = lcp->cache_size;
+
+	zassert_equal(testfs_lfs_wipe_partition(mp), TC_PASS, "wipe failed");
+
+	profile.lookahead_size = 12;
+	zassert_equal(fs_littlefs_profile_set(mp, &profile), -EINVAL, "bad lookahead accepted");
+	profile.lookahead_size = FS_LITTLEFS_LOOKAHEAD_ALL;
+
+	profile.cache_size = PROFILE_CACHE_SIZE + 1;
+	zassert_equal(fs_littlefs_profile_set(mp, &profile), -EINVAL, "bad cache size accepted");
+
+	/* not dividing the block size, rejected by the mount if not by the profile */
+	profile.cache_size = 3 * PROFILE_CACHE_SIZE;
+	if (fs_littlefs_profile_set(mp, &profile) == 0) {
+		zassert_equal(fs_mount(mp), -EINVAL, "bad cache size mounted");
+		zassert_equal(lcp->cache_size, cache_size, "configuration not restored");
+	}
+	profile.cache_size = PROFILE_CACHE_SIZE;
+
+	zassert_ok(fs_littlefs_profile_set(mp, &profile), "profile set failed");
+	zassert_ok(fs_mount(mp), "mount failed");
+
+	zassert_equal(lcp->cache_size, PROFILE_CACHE_SIZE, "profile cache size not applied");
+	zassert_equal(lcp->lookahead_size, ROUND_UP(DIV_ROUND_UP(lcp->block_count, 8U), 8U),
+		      "lookahead does not cover the partition");
+	zassert_equal(fs_littlefs_profile_set(mp, NULL), -EBUSY, "profile set while mounted");
+
+	write_read("profile");
+
+	zassert_ok(fs_unmount(mp), "unmount failed");
+
+	/* the configuration is back to its own buffers */
+	zassert_equal(lcp->cache_size, cache_size, "configuration not restored");
+	zassert_ok(fs_littlefs_profile_set(mp, NULL), "profile clear failed");
+
+	zassert_ok(fs_mount(mp), "mount without profile failed");
+	write_read("profile");
+	zassert_ok(fs_unmount(mp), "unmount failed");
+}
+#endif /* CONFIG_FS_LITTLEFS_PROFILE */
+
+#ifdef CONFIG_FS_LITTLEFS_STATS
+ZTEST(littlefs, test_lfs_stats)
+{
+	struct fs_littlefs_op_stats stats[FS_LITTLEFS_OP_COUNT];
+
+	zassert_equal(testfs_lfs_wipe_partition(mp), TC_PASS, "wipe failed");
+	zassert_equal(fs_littlefs_stats_get(mp, stats, false), -ENODEV, "stats while unmounted");
+
+	zassert_ok(fs_mount(mp), "mount failed");
+	zassert_ok(fs_littlefs_stats_get(mp, stats, true), "stats get failed");
+	zassert_equal(stats[FS_LITTLEFS_OP_MOUNT].count, 1, "mount not counted");
+	zassert_true(stats[FS_LITTLEFS_OP_MOUNT].reads > 0, "mount reads not counted");
+
+	write_read("stats");
+
+	zassert_ok(fs_littlefs_stats_get(mp, stats, true), "stats get failed");
+	zassert_equal(stats[FS_LITTLEFS_OP_MOUNT].count, 0, "stats not reset");
+	zassert_equal(stats[FS_LITTLEFS_OP_OPEN].count, 2, "open and close not counted");
+	zassert_equal(stats[FS_LITTLEFS_OP_WRITE].count, 1, "write not counted");
+	zassert_equal(stats[FS_LITTLEFS_OP_SYNC].count, 1, "sync not counted");
+	zassert_true((stats[FS_LITTLEFS_OP_WRITE].progs + stats[FS_LITTLEFS_OP_SYNC].progs) > 0,
+		     "programs not counted");
+
+#ifdef CONFIG_FS_LITTLEFS_PROFILE
+	struct fs_littlefs_profile profile = {
+		.lookahead_size = FS_LITTLEFS_LOOKAHEAD_ALL,
+		.background_scan = true,
+	};
+	int rc;
+
+	zassert_ok(fs_unmount(mp), "unmount failed");
+
+	rc = fs_littlefs_profile_set(mp, &profile);
+	if (rc == -ENOTSUP) {
+		ztest_test_skip();
+	}
+	zassert_ok(rc, "profile set failed");
+	zassert_ok(fs_mount(mp), "mount failed");
+
+	for (int i = 0; i < 100; i++) {
+		zassert_ok(fs_littlefs_stats_get(mp, stats, false), "stats get failed");
+		if (stats[FS_LITTLEFS_OP_SCAN].count != 0) {
+			break;
+		}
+		k_sleep(K_MSEC(10));
+	}
+	zassert_equal(stats[FS_LITTLEFS_OP_SCAN].count, 1, "background scan did not run");
+
+	zassert_equal(fs_littlefs_profile_set(mp, NULL), -EBUSY, "profile set while mounted");
+	zassert_ok(fs_unmount(mp), "unmount failed");
+	zassert_ok(fs_littlefs_profile_set(mp, NULL), "profile clear failed");
+#else
+	zassert_ok(fs_unmount(mp), "unmount failed");
+#endif /* CONFIG_FS_LITTLEFS_PROFILE */
+}
+#endif /* CONFIG_FS_LITTLEFS_STATS */
+
+#endif /* CONFIG_FS_LITTLEFS_PROFILE || CONFIG_FS_LITTLEFS_STATS */
@@ -964,6 +964,301 @@ ZTEST_F(nvs, test_nvs_cache_hash_quality)
 #endif
 }
 
+#ifdef CONFIG_NVS_CHECKPOINT
+static int flash_sim_read_calls_find(struct stats_hdr *hdr, void *arg,
+				     const char *name, uint16_t off)
+{
+	if (!strcmp(name, "flash_read_calls")) {
+		uint32_t **flash_read_stat = (uint32_t **) arg;
+		*flash_read_stat = (uint32_t *)((uint8_t *)hdr + off);
+	}
+
+	return 0;
+}
+#endif
+
+/*
+ * Test that the NVS lookup cache restored from a checkpoint on nvs_mount()
+ * matches the one maintained while writing.
+ */
+ZTEST_F(nvs, test_nvs_checkpoint)
+{
+#ifdef CONFIG_NVS_CHECKPOINT
+	static uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+	const uint16_t max_id = 16;
+	uint16_t last[16];
+	uint16_t i, id, data;
+	uint32_t *flash_read_stat;
+	uint32_t sector1_ates = 0;
+	int err;
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	/* The id of checkpoint ates is not available to users */
+	err = nvs_write(&fixture->fs, 0xFFFF, &i, sizeof(i));
+	zassert_equal(err, -EINVAL, "nvs_write of reserved id: %d", err);
+	err = nvs_delete(&fixture->fs, 0xFFFF);
+	zassert_equal(err, -EINVAL, "nvs_delete of reserved id: %d", err);
+
+	/* Write until gc of sector 0 stored a checkpoint in sector 2 */
+
+	for (i = 0; (fixture->fs.ate_wra >> ADDR_SECT_SHIFT) != 2; i++) {
+		if ((fixture->fs.ate_wra >> ADDR_SECT_SHIFT) == 1) {
+			sector1_ates++;
+		}
+		id = i % max_id;
+		last[id] = i;
+		err = nvs_write(&fixture->fs, id, &i, sizeof(i));
+		zassert_equal(err, sizeof(i), "nvs_write call failure: %d", err);
+	}
+
+	/* Entries written after the checkpoint have to be replayed */
+
+	for (id = 0; id < max_id / 2; id++, i++) {
+		last[id] = i;
+		err = nvs_write(&fixture->fs, id, &i, sizeof(i));
+		zassert_equal(err, sizeof(i), "nvs_write call failure: %d", err);
+	}
+
+	memcpy(lookup_cache, fixture->fs.lookup_cache, sizeof(lookup_cache));
+	memset(fixture->fs.lookup_cache, 0xAA, sizeof(fixture->fs.lookup_cache));
+
+	stats_walk(fixture->sim_stats, flash_sim_read_calls_find, &flash_read_stat);
+	*flash_read_stat = 0;
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	/* Without the checkpoint, rebuilding the cache alone reads every ate
+	 * of sector 1.
+	 */
+	zassert_true(*flash_read_stat < sector1_ates,
+		     "checkpoint not used: %u flash reads for %u ates", *flash_read_stat,
+		     sector1_ates);
+
+	zassert_mem_equal(fixture->fs.lookup_cache, lookup_cache, sizeof(lookup_cache),
+			  "cache differs after restart");
+
+	for (id = 0; id < max_id; id++) {
+		err = nvs_read(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "nvs_read call failure: %d", err);
+		zassert_equal(data, last[id], "incorrect data read");
+	}
+#endif
+}
+
+/*
+ * Test that a batch write updates either all or none of its entries when
+ * power is lost while it is written.
+ */
+ZTEST_F(nvs, test_nvs_write_batch)
+{
+#ifdef CONFIG_NVS_WRITE_BATCH
+	struct nvs_batch_entry entries[3];
+	uint32_t values[ARRAY_SIZE(entries)];
+	uint32_t *flash_write_stat;
+	uint32_t *flash_max_write_calls;
+	uint32_t batch_writes, data;
+	ssize_t len;
+	int err;
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	stats_walk(fixture->sim_thresholds, flash_sim_max_write_calls_find,
+		   &flash_max_write_calls);
+	stats_walk(fixture->sim_stats, flash_sim_write_calls_find, &flash_write_stat);
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		values[i] = i;
+		entries[i].id = TEST_DATA_ID + i;
+		entries[i].len = sizeof(values[i]);
+		entries[i].data = &values[i];
+	}
+
+	*flash_write_stat = 0;
+	len = nvs_write_batch(&fixture->fs, entries, ARRAY_SIZE(entries));
+	zassert_equal(len, ARRAY_SIZE(entries), "nvs_write_batch call failure: %d", len);
+	batch_writes = *flash_write_stat;
+
+	len = nvs_write_batch(&fixture->fs, entries, ARRAY_SIZE(entries));
+	zassert_equal(len, 0, "unchanged entries written: %d", len);
+
+	/* The id of batch ates is not available to users */
+	entries[1].id = 0xFFFF;
+	len = nvs_write_batch(&fixture->fs, entries, ARRAY_SIZE(entries));
+	zassert_equal(len, -EINVAL, "batch with reserved id written: %d", len);
+	entries[1].id = TEST_DATA_ID + 1;
+
+	/* Lose power before the batch ate is written: the write of the batch
+	 * ate and of the member ates, one flash write each, are dropped.
+	 */
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		values[i] = 0x100 + i;
+	}
+
+	*flash_max_write_calls = batch_writes - ARRAY_SIZE(entries);
+	*flash_write_stat = 0;
+	len = nvs_write_batch(&fixture->fs, entries, ARRAY_SIZE(entries));
+	zassert_equal(len, ARRAY_SIZE(entries), "nvs_write_batch call failure: %d", len);
+	*flash_max_write_calls = 0;
+
+	memset(&fixture->fs, 0, sizeof(fixture->fs));
+	(void)setup();
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		len = nvs_read(&fixture->fs, entries[i].id, &data, sizeof(data));
+		zassert_equal(len, sizeof(data), "nvs_read call failure: %d", len);
+		zassert_equal(data, i, "uncommitted batch entry %d updated", i);
+	}
+
+	/* Lose power after the batch ate and the first member ate are
+	 * written: the batch is completed on mount.
+	 */
+	*flash_max_write_calls = batch_writes - 1;
+	*flash_write_stat = 0;
+	len = nvs_write_batch(&fixture->fs, entries, ARRAY_SIZE(entries));
+	zassert_equal(len, ARRAY_SIZE(entries), "nvs_write_batch call failure: %d", len);
+	*flash_max_write_calls = 0;
+
+	memset(&fixture->fs, 0, sizeof(fixture->fs));
+	(void)setup();
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		len = nvs_read(&fixture->fs, entries[i].id, &data, sizeof(data));
+		zassert_equal(len, sizeof(data), "nvs_read call failure: %d", len);
+		zassert_equal(data, 0x100 + i, "committed batch entry %d not updated", i);
+	}
+
+	/* Completing the batch is done only once */
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+	len = nvs_write_batch(&fixture->fs, entries, ARRAY_SIZE(entries));
+	zassert_equal(len, 0, "unchanged entries written: %d", len);
+#endif
+}
+
+/*
+ * Test that an id present several times in a batch is written with its last
+ * entry, also when that entry is identical to the stored one.
+ */
+ZTEST_F(nvs, test_nvs_write_batch_duplicate)
+{
+#ifdef CONFIG_NVS_WRITE_BATCH
+	uint32_t stored = 1, stale = 2, other = 3;
+	struct nvs_batch_entry entries[] = {
+		{ .id = TEST_DATA_ID, .len = sizeof(stale), .data = &stale },
+		{ .id = TEST_DATA_ID + 1, .len = sizeof(other), .data = &other },
+		{ .id = TEST_DATA_ID, .len = sizeof(stored), .data = &stored },
+	};
+	uint32_t data;
+	ssize_t len;
+	int err;
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	len = nvs_write(&fixture->fs, TEST_DATA_ID, &stored, sizeof(stored));
+	zassert_equal(len, sizeof(stored), "nvs_write call failure: %d", len);
+
+	len = nvs_write_batch(&fixture->fs, entries, ARRAY_SIZE(entries));
+	zassert_equal(len, 1, "nvs_write_batch call failure: %d", len);
+
+	memset(&fixture->fs, 0, sizeof(fixture->fs));
+	(void)setup();
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	len = nvs_read(&fixture->fs, TEST_DATA_ID, &data, sizeof(data));
+	zassert_equal(len, sizeof(data), "nvs_read call failure: %d", len);
+	zassert_equal(data, stored, "earlier entry of the id written");
+
+	len = nvs_read(&fixture->fs, TEST_DATA_ID + 1, &data, sizeof(data));
+	zassert_equal(len, sizeof(data), "nvs_read call failure: %d", len);
+	zassert_equal(data, other, "batch entry not written");
+#endif
+}
+
+#ifdef CONFIG_NVS_GC_BACKGROUND
+static int flash_sim_erase_calls_find(struct stats_hdr *hdr, void *arg,
+				      const char *name, uint16_t off)
+{
+	if (!strcmp(name, "flash_erase_calls")) {
+		uint32_t **flash_erase_stat = (uint32_t **) arg;
+		*flash_erase_stat = (uint32_t *)((uint8_t *)hdr + off);
+	}
+
+	return 0;
+}
+#endif
+
+/*
+ * Test that writes do not erase sectors when background garbage collection
+ * is given the time to drain the next sector, and that no data is lost.
+ */
+ZTEST_F(nvs, test_nvs_gc_background)
+{
+#ifdef CONFIG_NVS_GC_BACKGROUND
+	const uint16_t max_id = 10;
+	uint32_t last[10];
+	struct nvs_gc_stats stats;
+	uint32_t *flash_erase_stat;
+	uint32_t i, data, write_erases;
+	uint16_t id;
+	ssize_t len;
+	int err;
+
+	fixture->fs.sector_count = 4;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	stats_walk(fixture->sim_stats, flash_sim_erase_calls_find, &flash_erase_stat);
+	nvs_gc_stats_get(&fixture->fs, &stats, true);
+
+	/* Write enough to wrap around the sectors several times, running
+	 * background gc to completion after each write.
+	 */
+	write_erases = 0;
+	for (i = 0; i < 3 * fixture->fs.sector_count * fixture->fs.sector_size / 16; i++) {
+		id = i % max_id;
+		last[id] = i;
+
+		*flash_erase_stat = 0;
+		len = nvs_write(&fixture->fs, id, &i, sizeof(i));
+		zassert_equal(len, sizeof(i), "nvs_write call failure: %d", len);
+		write_erases += *flash_erase_stat;
+
+		do {
+			err = nvs_gc_step(&fixture->fs);
+			zassert_true(err >= 0, "nvs_gc_step call failure: %d", err);
+		} while (err > 0);
+	}
+
+	zassert_equal(write_erases, 0, "sectors erased by writes: %u", write_erases);
+
+	nvs_gc_stats_get(&fixture->fs, &stats, false);
+	zassert_true(stats.bg_erase_count > 0, "no sector erased in background");
+	zassert_true(stats.bg_move_count > 0, "no entry moved in background");
+	zassert_equal(stats.write_count, i, "incorrect write count: %u", stats.write_count);
+	zassert_true(stats.write_max_cycles > 0, "write latency not recorded");
+
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	for (id = 0; id < max_id; id++) {
+		len = nvs_read(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(len, sizeof(data), "nvs_read call failure: %d", len);
+		zassert_equal(data, last[id], "incorrect data read");
+	}
+#endif
+}
+
 /*
  * Test NVS bad region initialization recovery.
  */
@@ -833,6 +833,174 @@ ZTEST_F(zms, test_zms_cache_gc)
 #endif
 }
 
+/*
+ * Test that a batch write updates either all or none of its entries when
+ * power is lost while it is written.
+ */
+ZTEST_F(zms, test_zms_write_batch)
+{
+#ifdef CONFIG_ZMS_WRITE_BATCH
+	struct zms_batch_entry entries[3];
+	uint8_t values[ARRAY_SIZE(entries)][16];
+	uint8_t data[16];
+	uint32_t *flash_write_stat;
+	uint32_t *flash_max_write_calls;
+	uint32_t batch_writes;
+	uint64_t ate_wra;
+	ssize_t len;
+	int err;
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	stats_walk(fixture->sim_thresholds, flash_sim_max_write_calls_find, &flash_max_write_calls);
+	stats_walk(fixture->sim_stats, flash_sim_write_calls_find, &flash_write_stat);
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		memset(values[i], i, sizeof(values[i]));
+		entries[i].id = TEST_DATA_ID + i;
+		entries[i].len = sizeof(values[i]);
+		entries[i].data = values[i];
+	}
+
+	*flash_write_stat = 0;
+	len = zms_write_batch(&fixture->fs, entries, ARRAY_SIZE(entries));
+	zassert_equal(len, ARRAY_SIZE(entries), "zms_write_batch call failure: %d", len);
+	batch_writes = *flash_write_stat;
+
+	/* Lose power after the batch ATE and the first member ATE are
+	 * written: the batch is completed on mount.
+	 */
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		memset(values[i], 0x10 + i, sizeof(values[i]));
+	}
+
+	*flash_max_write_calls = batch_writes - 1;
+	*flash_write_stat = 0;
+	len = zms_write_batch(&fixture->fs, entries, ARRAY_SIZE(entries));
+	zassert_equal(len, ARRAY_SIZE(entries), "zms_write_batch call failure: %d", len);
+	*flash_max_write_calls = 0;
+
+	memset(&fixture->fs, 0, sizeof(fixture->fs));
+	(void)setup();
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		len = zms_read(&fixture->fs, entries[i].id, data, sizeof(data));
+		zassert_equal(len, sizeof(data), "zms_read call failure: %d", len);
+		zassert_mem_equal(data, values[i], sizeof(data),
+				  "committed batch entry %d not updated", i);
+	}
+
+	/* Completing the batch is done only once */
+	ate_wra = fixture->fs.ate_wra;
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+	zassert_equal(fixture->fs.ate_wra, ate_wra, "batch completed twice");
+
+	/* Lose power before the batch ATE is written: the write of the batch
+	 * ATE and of the member ATEs, one flash write each, are dropped.
+	 */
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		memset(values[i], 0x20 + i, sizeof(values[i]));
+	}
+
+	*flash_max_write_calls = batch_writes - ARRAY_SIZE(entries);
+	*flash_write_stat = 0;
+	len = zms_write_batch(&fixture->fs, entries, ARRAY_SIZE(entries));
+	zassert_equal(len, ARRAY_SIZE(entries), "zms_write_batch call failure: %d", len);
+	*flash_max_write_calls = 0;
+
+	memset(&fixture->fs, 0, sizeof(fixture->fs));
+	(void)setup();
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		len = zms_read(&fixture->fs, entries[i].id, data, sizeof(data));
+		zassert_equal(len, sizeof(data), "zms_read call failure: %d", len);
+		zassert_equal(data[0], 0x10 + i, "uncommitted batch entry %d updated", i);
+	}
+#endif
+}
+
+#ifdef CONFIG_ZMS_GC_BACKGROUND
+static int flash_sim_erase_calls_find(struct stats_hdr *hdr, void *arg, const char *name,
+				      uint16_t off)
+{
+	if (!strcmp(name, "flash_erase_calls")) {
+		uint32_t **flash_erase_stat = (uint32_t **)arg;
+		*flash_erase_stat = (uint32_t *)((uint8_t *)hdr + off);
+	}
+
+	return 0;
+}
+#endif
+
+/*
+ * Test that writes do not erase sectors when background garbage collection
+ * is given the time to drain the next sector, and that no data is lost.
+ */
+ZTEST_F(zms, test_zms_gc_background)
+{
+#ifdef CONFIG_ZMS_GC_BACKGROUND
+	const uint32_t max_id = 10;
+	uint32_t last[10];
+	uint32_t buf[4];
+	struct zms_gc_stats stats;
+	uint32_t *flash_erase_stat;
+	uint32_t i, id, write_erases;
+	ssize_t len;
+	int err;
+
+	fixture->fs.sector_count = 4;
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	stats_walk(fixture->sim_stats, flash_sim_erase_calls_find, &flash_erase_stat);
+	zms_gc_stats_get(&fixture->fs, &stats, true);
+
+	/* Write enough to wrap around the sectors several times, running
+	 * background GC to completion after each write.
+	 */
+	write_erases = 0;
+	for (i = 0; i < 3 * fixture->fs.sector_count * fixture->fs.sector_size / 32; i++) {
+		id = i % max_id;
+		last[id] = i;
+		memset(buf, 0, sizeof(buf));
+		buf[0] = i;
+
+		*flash_erase_stat = 0;
+		len = zms_write(&fixture->fs, id, buf, sizeof(buf));
+		zassert_equal(len, sizeof(buf), "zms_write call failure: %d", len);
+		write_erases += *flash_erase_stat;
+
+		do {
+			err = zms_gc_step(&fixture->fs);
+			zassert_true(err >= 0, "zms_gc_step call failure: %d", err);
+		} while (err > 0);
+	}
+
+	zassert_equal(write_erases, 0, "sectors erased by writes: %u", write_erases);
+
+	zms_gc_stats_get(&fixture->fs, &stats, false);
+	zassert_true(stats.bg_erase_count > 0, "no sector erased in background");
+	zassert_true(stats.bg_move_count > 0, "no entry moved in background");
+	zassert_equal(stats.write_count, i, "incorrect write count: %u", stats.write_count);
+	zassert_true(stats.write_max_cycles > 0, "write latency not recorded");
+
+	err = zms_mount(&fixture->fs);
+	zassert_true(err == 0, "zms_mount call failure: %d", err);
+
+	for (id = 0; id < max_id; id++) {
+		len = zms_read(&fixture->fs, id, buf, sizeof(buf));
+		zassert_equal(len, sizeof(buf), "zms_read call failure: %d", len);
+		zassert_equal(buf[0], last[id], "incorrect data read");
+	}
+#endif
+}
+
 /*
  * Test ZMS lookup cache hash quality.
  */
@@ -426,6 +426,106 @@ ZTEST(lib_stream_flash, test_stream_flash_buffered_write_whole_page)
 }
 #endif
 
+#ifdef CONFIG_STREAM_FLASH_ASYNC
+static uint8_t prog_buf[BUF_LEN];
+
+ZTEST(lib_stream_flash, test_stream_flash_async_write)
+{
+	int rc;
+	size_t total = page_size * 2 + 128;
+
+	init_target();
+
+	rc = stream_flash_async_enable(&ctx, prog_buf);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, total, false);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx) + stream_flash_bytes_buffered(&ctx), total,
+		      "all bytes should be accounted for");
+
+	/* The flush waits for the background programming */
+	rc = stream_flash_buffered_write(&ctx, NULL, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx), total, "all bytes should be written");
+	zassert_equal(stream_flash_bytes_buffered(&ctx), 0, "no bytes should be buffered");
+
+	VERIFY_WRITTEN(0, total);
+}
+
+ZTEST(lib_stream_flash, test_stream_flash_async_erase_ahead)
+{
+	int rc;
+
+	init_target();
+
+	rc = stream_flash_async_enable(&ctx, prog_buf);
+	zassert_equal(rc, 0, "expected success");
+
+	/* Fill the first page, the buffer that ends it is programmed last */
+	rc = stream_flash_buffered_write(&ctx, write_buf, page_size, false);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_async_wait(&ctx);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx), page_size, "first page should be written");
+	VERIFY_WRITTEN(0, page_size);
+
+#ifdef CONFIG_STREAM_FLASH_ERASE
+	const struct flash_parameters *fparams = flash_get_parameters(fdev);
+
+	/* The page the next buffer goes to is already erased */
+	if (flash_params_get_erase_cap(fparams) & FLASH_ERASE_C_EXPLICIT) {
+		zassert_equal(ctx.erased_up_to, 2 * page_size, "next page should be erased");
+	}
+#endif
+}
+
+ZTEST(lib_stream_flash, test_stream_flash_async_error)
+{
+	int rc;
+	struct device fake_dev;
+	struct flash_driver_api fake_api;
+
+	init_target();
+
+	fake_dev = *ctx.fdev;
+	fake_api = *(struct flash_driver_api *)ctx.fdev->api;
+	fake_api.write = bad_write;
+	fake_dev.api = &fake_api;
+	ctx.fdev = &fake_dev;
+
+	rc = stream_flash_async_enable(&ctx, prog_buf);
+	zassert_equal(rc, 0, "expected success");
+
+	/* The filled buffer is accepted, its programming fails later */
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN, false);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_buffered_write(&ctx, NULL, 0, true);
+	zassert_equal(rc, -EINVAL, "expected failure from the background programming");
+	zassert_equal(stream_flash_bytes_written(&ctx), 0, "no bytes should be written");
+	zassert_equal(stream_flash_bytes_buffered(&ctx), 0, "failed bytes should be dropped");
+
+	/* The error sticks until the context is initialized again */
+	rc = stream_flash_buffered_write(&ctx, write_buf, 1, false);
+	zassert_equal(rc, -EINVAL, "expected failure after a background error");
+	rc = stream_flash_buffered_write(&ctx, NULL, 0, true);
+	zassert_equal(rc, -EINVAL, "expected failure after a background error");
+	rc = stream_flash_async_wait(&ctx);
+	zassert_equal(rc, -EINVAL, "expected failure after a background error");
+	zassert_equal(stream_flash_bytes_buffered(&ctx), 0, "no bytes should be accepted");
+
+	init_target();
+
+	rc = stream_flash_async_enable(&ctx, prog_buf);
+	zassert_equal(rc, 0, "expected success");
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN, true);
+	zassert_equal(rc, 0, "expected success");
+	VERIFY_WRITTEN(0, BUF_LEN);
+}
+#endif /* CONFIG_STREAM_FLASH_ASYNC */
+
 static size_t write_and_save_progress(size_t bytes, const char *save_key)
 {
 	int rc;
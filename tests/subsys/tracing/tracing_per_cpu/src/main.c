@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Alif Semiconductor
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/tracing/tracing_format.h>
+#include <tracing_core.h>
+
+#define NUM_WRITERS 2
+#define NUM_RECORDS 32
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+#define MARKER "per_cpu_order_"
+#define MARKER_LEN (sizeof(MARKER) - 1)
+
+/* Output of the RAM backend */
+extern uint8_t ram_tracing[CONFIG_RAM_TRACING_BUFFER_SIZE];
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_WRITERS, STACK_SIZE);
+static struct k_thread threads[NUM_WRITERS];
+
+/* Index of the next record to write */
+static atomic_t turn;
+
+/* Larger than a per-CPU buffer, so it can never be queued */
+static uint8_t oversized[CONFIG_TRACING_BUFFER_SIZE + 1];
+
+static void writer(void *p1, void *p2, void *p3)
+{
+	unsigned int cpu = POINTER_TO_UINT(p1);
+	uint8_t marker[] = MARKER "00";
+	unsigned int key;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	key = arch_irq_lock();
+	zassert_equal(arch_curr_cpu()->id, cpu, "Writer not running on CPU %u", cpu);
+	arch_irq_unlock(key);
+
+	/* The writers take turns, so consecutive records are in the buffers
+	 * of different CPUs. Both CPUs are kept busy until all records are
+	 * written, which keeps the tracing thread from draining the buffers
+	 * in between.
+	 */
+	for (unsigned int i = cpu; i < NUM_RECORDS; i += NUM_WRITERS) {
+		while (atomic_get(&turn) != (atomic_val_t)i) {
+			arch_spin_relax();
+		}
+
+		marker[MARKER_LEN] = '0' + i / 10U;
+		marker[MARKER_LEN + 1] = '0' + i % 10U;
+		tracing_format_raw_data(marker, sizeof(marker) - 1);
+
+		atomic_set(&turn, i + 1);
+	}
+}
+
+/**
+ * @brief Test records written on several CPUs are output in order
+ *
+ * @details Two threads pinned to different CPUs write records in turn to
+ * their per-CPU buffer, the tracing thread must merge them back in the
+ * order they were written.
+ */
+ZTEST(tracing_per_cpu, test_tracing_per_cpu_order)
+{
+	int next = 0;
+
+	for (unsigned int cpu = 0; cpu < NUM_WRITERS; cpu++) {
+		k_thread_create(&threads[cpu], stacks[cpu], STACK_SIZE, writer,
+				UINT_TO_POINTER(cpu), NULL, NULL, K_PRIO_COOP(1), 0, K_FOREVER);
+		zassert_ok(k_thread_cpu_pin(&threads[cpu], cpu));
+	}
+
+	for (unsigned int cpu = 0; cpu < NUM_WRITERS; cpu++) {
+		k_thread_start(&threads[cpu]);
+	}
+
+	for (unsigned int cpu = 0; cpu < NUM_WRITERS; cpu++) {
+		k_thread_join(&threads[cpu], K_FOREVER);
+	}
+
+	/* Let the tracing thread output everything */
+	k_sleep(K_MSEC(100));
+
+	for (size_t pos = 0; pos + MARKER_LEN + 2 <= sizeof(ram_tracing); pos++) {
+		int i;
+
+		if (memcmp(&ram_tracing[pos], MARKER, MARKER_LEN) != 0) {
+			continue;
+		}
+
+		i = (ram_tracing[pos + MARKER_LEN] - '0') * 10 +
+		    (ram_tracing[pos + MARKER_LEN + 1] - '0');
+		zassert_equal(i, next, "Record %d output before record %d", i, next);
+		next++;
+	}
+
+	zassert_equal(next, NUM_RECORDS, "Only %d records output", next);
+}
+
+static void dropper(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	tracing_format_raw_data(oversized, sizeof(oversized));
+}
+
+/**
+ * @brief Test dropped packets are counted on the CPU that dropped them
+ */
+ZTEST(tracing_per_cpu, test_tracing_per_cpu_drop)
+{
+	uint32_t before[NUM_WRITERS];
+
+	for (unsigned int cpu = 0; cpu < NUM_WRITERS; cpu++) {
+		before[cpu] = tracing_packet_drop_get(cpu);
+	}
+
+	k_thread_create(&threads[0], stacks[0], STACK_SIZE, dropper,
+			NULL, NULL, NULL, K_PRIO_COOP(1), 0, K_FOREVER);
+	zassert_ok(k_thread_cpu_pin(&threads[0], 1));
+	k_thread_start(&threads[0]);
+	k_thread_join(&threads[0], K_FOREVER);
+
+	zassert_equal(tracing_packet_drop_get(0), before[0],
+		      "Drop counted on CPU 0");
+	zassert_equal(tracing_packet_drop_get(1), before[1] + 1,
+		      "Drop not counted on CPU 1");
+}
+
+ZTEST_SUITE(tracing_per_cpu, NULL, NULL, NULL, NULL, NULL);